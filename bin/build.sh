@@ -3,7 +3,7 @@ set -euo pipefail
 
 usage() {
   echo "Usage: bin/build.sh [--clean] [--release]"
-  echo "  Cross-compiles Windows .exe files (game.exe, tests.exe) into build/"
+  echo "  Cross-compiles Windows .exe files (game.exe, tests.exe, replay.exe) into build/"
   echo "  --clean: Force full rebuild (default: incremental)"
   echo "  --release: Build in Release mode (default: RelWithDebInfo)"
 }
@@ -57,3 +57,4 @@ echo ""
 echo "Build complete!"
 echo "  Game: $build_dir/game.exe"
 echo "  Tests: $build_dir/tests.exe"
+echo "  Replay: $build_dir/replay.exe"
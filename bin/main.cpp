@@ -2,12 +2,25 @@
 #include "raymath.h"
 #include "rlgl.h"
 #include <stdlib.h>
+#include <string.h>
 #include <cstdio>
 
 #include "engine/platform/engine.h"
 #include "game/game.h"
 
-int main(void) {
+int main(int argc, char** argv) {
+    // --record <path>: capture this session's input for bin/replay
+    // --bacteria <n>: ambient swarm size
+    const char* record_path = NULL;
+    int ambient_bacteria = 100000;
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (strcmp(argv[i], "--record") == 0) {
+            record_path = argv[i + 1];
+        } else if (strcmp(argv[i], "--bacteria") == 0) {
+            ambient_bacteria = atoi(argv[i + 1]);
+        }
+    }
+
     #if defined(__linux__)
     setenv("MESA_LOADER_DRIVER_OVERRIDE", "zink", 0);
     #endif
@@ -20,14 +33,17 @@ int main(void) {
         .target_fps = 60,
         .tick_hz = 60,
         .vsync = true,
-        .dev_mode = true
+        .dev_mode = true,
+        .background_tick_hz = 10,
+        .hidden_after_s = 60.0
     };
 
     InitWindow(cfg.window_w, cfg.window_h, "Micro-Idle");
     if (cfg.vsync) {
         SetWindowState(FLAG_VSYNC_HINT);
     }
-    SetTargetFPS(cfg.target_fps);
+    // The engine frame pacer enforces target_fps; raylib's own wait would double-pace
+    SetTargetFPS(0);
 
     EngineContext engine = {0};
     engine_init(&engine, cfg);
@@ -44,13 +60,59 @@ int main(void) {
         CloseWindow();
         return 1;
     }
+    game_set_ambient_bacteria(game, ambient_bacteria);
+    if (record_path && !game_start_recording(game, record_path, cfg.tick_hz)) {
+        fprintf(stderr, "Could not start input recording to %s\n", record_path);
+    }
 
     int prev_screen_w = GetRenderWidth();
     int prev_screen_h = GetRenderHeight();
+    GameSimMode sim_mode = GAME_SIM_FULL;
+
+    // Dev mode: F3 step-count heatmap, F4 over-relaxed sphere tracing. Either
+    // one turns on the raymarch counters, logged once a second for comparison.
+    bool raymarch_heatmap = false;
+    bool raymarch_relaxed = false;
+    double raymarch_log_time = 0.0;
+    // Dev mode: F5 logs input -> present and cursor latch -> present once a second
+    bool latency_log = false;
+    double latency_log_time = 0.0;
 
     while (!WindowShouldClose()) {
-        float real_dt = GetFrameTime();
-        (void)real_dt;
+        // Timing comes from the pacer: GetFrameTime() only advances inside EndDrawing(),
+        // which is skipped in the background
+        float real_dt = (float)frame_pacer_begin_frame(&engine.pacer, frame_pacer_now());
+
+        PowerMode previous_power = engine.power.mode;
+        PowerMode power = engine_power_update(&engine, IsWindowMinimized(), IsWindowFocused(), real_dt);
+        GameSimMode wanted_mode = (power == POWER_MODE_ACTIVE) ? GAME_SIM_FULL : GAME_SIM_REDUCED;
+        if (wanted_mode != sim_mode) {
+            game_set_sim_mode(game, wanted_mode);
+            sim_mode = wanted_mode;
+            if (sim_mode == GAME_SIM_FULL) {
+                // Background sleeps are not representative of foreground pacing
+                frame_pacer_reset_stats(&engine.pacer);
+            }
+        }
+
+        if (power == POWER_MODE_HIDDEN) {
+            // Nothing ticks while hidden; the time is banked and fast-forwarded on restore.
+            // The frame that goes dark is not banked, so it runs its coarse ticks here.
+            if (previous_power != POWER_MODE_HIDDEN) {
+                int steps = engine_time_update(&engine, real_dt);
+                for (int i = 0; i < steps; ++i) {
+                    game_update_fixed(game, (float)engine.time.tick_dt);
+                }
+            }
+            PollInputEvents();
+            frame_pacer_sleep_until(frame_pacer_now() + power_idle_interval(&engine.power), 0.0);
+            continue;
+        }
+
+        double hidden_time = power_take_hidden_time(&engine.power);
+        if (hidden_time > 0.0) {
+            game_fast_forward(game, hidden_time);
+        }
 
         int screen_w = GetRenderWidth();
         int screen_h = GetRenderHeight();
@@ -63,20 +125,67 @@ int main(void) {
         }
 
         int steps = engine_time_update(&engine, real_dt);
-        game_handle_input(game, camera, real_dt, screen_w, screen_h);
+        if (power == POWER_MODE_ACTIVE) {
+            frame_pacer_mark_input(&engine.pacer, frame_pacer_now());
+            game_handle_input(game, camera, real_dt, screen_w, screen_h);
+
+            if (cfg.dev_mode && (IsKeyPressed(KEY_F3) || IsKeyPressed(KEY_F4))) {
+                raymarch_heatmap ^= IsKeyPressed(KEY_F3);
+                raymarch_relaxed ^= IsKeyPressed(KEY_F4);
+                game_set_raymarch_debug(game, raymarch_heatmap, raymarch_relaxed,
+                                        raymarch_heatmap || raymarch_relaxed);
+            }
+            if (cfg.dev_mode && IsKeyPressed(KEY_F5)) {
+                latency_log = !latency_log;
+                frame_pacer_reset_stats(&engine.pacer);
+            }
+        }
         for (int i = 0; i < steps; ++i) {
             game_update_fixed(game, (float)engine.time.tick_dt);
         }
 
+        if (power == POWER_MODE_BACKGROUND) {
+            // No presentation in the background: service the OS and sleep until the next tick
+            PollInputEvents();
+            frame_pacer_sleep_until(frame_pacer_now() + power_idle_interval(&engine.power), 0.0);
+            continue;
+        }
+
+        if (power == POWER_MODE_ACTIVE) {
+            // Re-read the cursor as late as possible: the reticle and hover
+            // highlights draw from this sample. Input latency is still measured
+            // from the poll above; the latch gets its own stat.
+            game_latch_cursor(game, camera);
+            frame_pacer_mark_latch(&engine.pacer, frame_pacer_now());
+        }
+
         BeginDrawing();
         rlViewport(0, 0, screen_w, screen_h);
         ClearBackground((Color){18, 44, 52, 255});
         game_render(game, camera, engine_time_alpha(&engine));
         game_render_ui(game, screen_w, screen_h);
         EndDrawing();
+        frame_pacer_mark_present(&engine.pacer, frame_pacer_now());
+
+        GameRaymarchStats raymarch;
+        if (GetTime() - raymarch_log_time >= 1.0 && game_get_raymarch_stats(game, &raymarch) &&
+            raymarch.pixels > 0.0) {
+            raymarch_log_time = GetTime();
+            printf("raymarch (%s): %.0f px, %.1f%% hit, %.2f steps/px, %.2f evals/px\n",
+                   raymarch_relaxed ? "relaxed" : "fixed", raymarch.pixels,
+                   100.0 * raymarch.hits / raymarch.pixels, raymarch.steps / raymarch.pixels,
+                   raymarch.evaluations / raymarch.pixels);
+        }
+
+        const FramePacerStats* pacing = &engine.pacer.stats;
+        if (latency_log && GetTime() - latency_log_time >= 1.0 && pacing->latch_presents > 0) {
+            latency_log_time = GetTime();
+            printf("latency: input->present %.2f ms (max %.2f), latch->present %.2f ms (max %.2f)\n",
+                   pacing->input_latency_mean * 1000.0, pacing->input_latency_max * 1000.0,
+                   pacing->latch_latency_mean * 1000.0, pacing->latch_latency_max * 1000.0);
+        }
 
-        static int frameCount = 0;
-        frameCount++;
+        frame_pacer_wait(&engine.pacer);
     }
 
     game_destroy(game);
@@ -0,0 +1,72 @@
+// Headless scenario / input-recording runner for reproducible perf comparisons.
+//
+//   replay <scenario-or-recording> [--repeat N] [--no-timing]
+//
+// Prints deterministic metrics (identical on every run of a build) followed by
+// timing.* lines. With --repeat, every run must produce the same metrics; a
+// mismatch exits with status 2.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "src/replay/ReplayRunner.h"
+#include "src/replay/Scenario.h"
+
+using namespace micro_idle::replay;
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    int repeat = 1;
+    bool showTiming = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--no-timing") == 0) {
+            showTiming = false;
+        } else if (argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            path = nullptr;
+            break;
+        }
+    }
+    if (!path || repeat < 1) {
+        std::fprintf(stderr, "usage: %s <scenario> [--repeat N] [--no-timing]\n", argv[0]);
+        return 1;
+    }
+
+    Scenario scenario;
+    std::string error;
+    if (!loadScenario(path, scenario, &error)) {
+        std::fprintf(stderr, "replay: %s: %s\n", path, error.c_str());
+        return 1;
+    }
+
+    ReplayMetrics first;
+    for (int run = 0; run < repeat; run++) {
+        ReplayMetrics metrics;
+        ReplayTiming timing;
+        if (!runScenario(scenario, metrics, &timing, &error)) {
+            std::fprintf(stderr, "replay: %s\n", error.c_str());
+            return 1;
+        }
+
+        if (run == 0) {
+            first = metrics;
+            printMetrics(stdout, scenario, metrics);
+        } else if (!metricsEqual(first, metrics)) {
+            std::fprintf(stderr, "replay: run %d diverged from run 0\n", run);
+            printMetrics(stderr, scenario, metrics);
+            return 2;
+        }
+
+        if (showTiming) {
+            std::printf("timing.run=%d\n", run);
+            printTiming(stdout, timing);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,38 @@
+#version 330
+
+// Instanced impostor for the ambient bacteria swarm
+// One unit quad per agent, laid flat on the dish floor and oriented along the
+// agent's heading. Per-instance data comes straight from the swarm's SoA arrays.
+
+layout(location = 0) in vec2 corner;          // Quad corner in [-1, 1]
+layout(location = 1) in float instanceX;
+layout(location = 2) in float instanceZ;
+layout(location = 3) in float instanceDirX;
+layout(location = 4) in float instanceDirZ;
+layout(location = 5) in float instanceType;   // 0 = coccus, 1 = bacillus
+
+uniform mat4 mvp;
+uniform float agentRadius;
+uniform float floorHeight;
+
+out vec2 localPos;      // Position inside the impostor, in world units
+out float halfLength;   // Half length of the capsule core
+out float agentType;
+out float tint;         // Per-instance variation
+
+void main()
+{
+    vec2 dir = vec2(instanceDirX, instanceDirZ);
+    dir = dot(dir, dir) > 1e-8 ? normalize(dir) : vec2(1.0, 0.0);
+    vec2 side = vec2(-dir.y, dir.x);
+
+    agentType = instanceType;
+    halfLength = instanceType > 0.5 ? agentRadius * 1.6 : 0.0;
+
+    localPos = vec2(corner.x * (halfLength + agentRadius), corner.y * agentRadius);
+    vec2 offset = dir * localPos.x + side * localPos.y;
+
+    tint = fract(sin(float(gl_InstanceID) * 12.9898) * 43758.5453);
+
+    gl_Position = mvp * vec4(instanceX + offset.x, floorHeight, instanceZ + offset.y, 1.0);
+}
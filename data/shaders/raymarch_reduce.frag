@@ -0,0 +1,31 @@
+#version 330
+
+// Sums one tile of the raymarch counts G-buffer per output texel, so only a
+// small target has to be read back for the stats
+in vec2 fragTexCoord;
+
+uniform sampler2D counts;   // steps, SDF evaluations, marched pixels, hits
+uniform ivec2 tileSize;
+
+out vec4 finalColor;
+
+void main()
+{
+    ivec2 size = textureSize(counts, 0);
+    ivec2 origin = ivec2(gl_FragCoord.xy) * tileSize;
+    vec4 sum = vec4(0.0);
+    for (int y = 0; y < tileSize.y; y++) {
+        int py = origin.y + y;
+        if (py >= size.y) {
+            break;
+        }
+        for (int x = 0; x < tileSize.x; x++) {
+            int px = origin.x + x;
+            if (px >= size.x) {
+                break;
+            }
+            sum += texelFetch(counts, ivec2(px, py), 0);
+        }
+    }
+    finalColor = sum;
+}
@@ -0,0 +1,30 @@
+#version 330
+
+// Instanced resource drop: a glowing disc lying on the dish floor
+// Per-instance data comes straight from the ResourceDrops SoA arrays.
+
+layout(location = 0) in vec2 corner;          // Quad corner in [-1, 1]
+layout(location = 1) in float instanceX;
+layout(location = 2) in float instanceZ;
+layout(location = 3) in float instanceLife;   // Seconds remaining
+layout(location = 4) in float instanceType;   // ResourceType
+
+uniform mat4 mvp;
+uniform float dropRadius;
+uniform float floorHeight;
+uniform float fadeTime;                       // Drops fade out over their last seconds
+uniform vec3 typeColors[7];
+
+out vec2 localPos;
+out vec3 dropColor;
+out float fade;
+
+void main()
+{
+    localPos = corner;
+    dropColor = typeColors[clamp(int(instanceType + 0.5), 0, 6)];
+    fade = clamp(instanceLife / fadeTime, 0.0, 1.0);
+
+    vec2 offset = corner * dropRadius;
+    gl_Position = mvp * vec4(instanceX + offset.x, floorHeight, instanceZ + offset.y, 1.0);
+}
@@ -0,0 +1,58 @@
+#version 330
+
+// Lighting pass for the SDF membranes: shades each G-buffer pixel once,
+// whatever the number of overlapping proxies that wrote it
+in vec2 fragTexCoord;
+
+uniform sampler2D gAlbedo;      // rgb albedo, a ambient occlusion
+uniform sampler2D gNormal;      // xyz world normal, w microbe id (0 = empty)
+uniform sampler2D gDepth;
+uniform vec3 viewPos;
+uniform mat4 invViewProj;
+uniform int debugMode;      // 1 = show the step-count heatmap unlit
+
+out vec4 finalColor;
+
+void main()
+{
+    vec4 normalId = texture(gNormal, fragTexCoord);
+    if (normalId.w < 0.5) {
+        discard;
+    }
+
+    // Pass the membrane depth through so it composites against shells and spines
+    float depth = texture(gDepth, fragTexCoord).r;
+    gl_FragDepth = depth;
+
+    vec4 world = invViewProj * vec4(fragTexCoord * 2.0 - 1.0, depth * 2.0 - 1.0, 1.0);
+    vec3 p = world.xyz / world.w;
+    vec3 n = normalize(normalId.xyz);
+    vec4 albedoAo = texture(gAlbedo, fragTexCoord);
+    if (debugMode != 0) {
+        finalColor = vec4(albedoAo.rgb, 1.0);
+        return;
+    }
+    vec3 albedo = albedoAo.rgb;
+    float ao = albedoAo.a;
+
+    vec3 lightDir = normalize(vec3(0.45, 0.85, 0.25));
+    vec3 fillDir = normalize(vec3(-0.35, 0.65, -0.65));
+    vec3 viewDir = normalize(viewPos - p);
+    float wrap = 0.35;
+    float diff = clamp((dot(n, lightDir) + wrap) / (1.0 + wrap), 0.0, 1.0);
+    float diffFill = clamp((dot(n, fillDir) + 0.15) / 1.15, 0.0, 1.0);
+    float spec = pow(max(dot(reflect(-lightDir, n), viewDir), 0.0), 20.0);
+    float specFill = pow(max(dot(reflect(-fillDir, n), viewDir), 0.0), 26.0) * 0.4;
+    float rim = pow(1.0 - max(dot(n, viewDir), 0.0), 2.1);
+
+    vec3 gelTint = vec3(0.85, 0.95, 0.9);
+    vec3 subsurface = albedo * 0.55 * pow(max(dot(n, -lightDir), 0.0), 1.05);
+    float fresnel = pow(1.0 - max(dot(n, viewDir), 0.0), 1.6);
+    float lighting = 0.25 + diff * 0.55 + diffFill * 0.2;
+    vec3 color = mix(albedo, gelTint, 0.08 + 0.22 * fresnel) * lighting * ao;
+    color += subsurface * 0.55;
+    color += vec3(0.95) * (spec * 0.32 + specFill * 0.18);
+    color += vec3(0.18, 0.28, 0.22) * rim;
+
+    finalColor = vec4(color, 1.0);
+}
@@ -1,12 +1,21 @@
 #version 330
 
-// SDF-based organic microbe rendering
+// The stored depth is never nearer than the proxy face, so early-z can still
+// reject fragments behind already-written membranes where this is supported
+#ifdef GL_ARB_conservative_depth
+#extension GL_ARB_conservative_depth : enable
+layout(depth_greater) out float gl_FragDepth;
+#endif
+
+// SDF-based organic microbe rendering: geometry pass writing the G-buffer
+// (albedo + AO, normal + microbe id, depth); sdf_lighting.frag shades it
 in vec2 fragTexCoord;
 in vec3 fragNormal;
 in vec4 fragColor;
 in vec3 fragWorldPos;
 
 uniform vec3 viewPos;
+uniform mat4 mvp;       // Proxy cube is drawn untransformed, so this is view-projection
 uniform vec3 microbeColor;
 uniform vec3 skeletonPoints[64];
 uniform int pointCount;
@@ -16,12 +25,21 @@ uniform vec3 podDirs[4];
 uniform float podExtents[4];
 uniform vec3 podAnchors[4];
 uniform int podCount;
+uniform float microbeId;  // 1-based; 0 marks an empty G-buffer pixel
+uniform int debugMode;      // 1 = step-count heatmap instead of albedo
+uniform int relaxedTracing; // 1 = over-relaxed sphere tracing
+uniform int collectStats;   // 1 = counts attachment is summed, so misses write it too
 
-out vec4 finalColor;
+layout(location = 0) out vec4 gAlbedo;
+layout(location = 1) out vec4 gNormal;
+layout(location = 2) out vec4 gCounts;  // steps, SDF evaluations, 1 per marched pixel, 1 per hit
 
 const int MAX_STEPS = 128;
 const float MAX_DIST = 45.0;
 const float FLATTEN = 2.0;
+const float RELAXATION = 1.6;    // Step scale over the safe half-distance step
+
+int gEvalCount = 0;
 
 float sdMembrane(vec3 p);
 
@@ -79,25 +97,15 @@ float fbm(vec3 p) {
     return v;
 }
 
-float softShadow(vec3 ro, vec3 rd, float maxDist) {
-    float res = 1.0;
-    float t = 0.02;
-    for (int i = 0; i < 12; i++) {
-        float h = sdMembrane(ro + rd * t);
-        if (h < 0.001) {
-            return 0.0;
-        }
-        res = min(res, 10.0 * h / t);
-        t += clamp(h, 0.02, 0.2);
-        if (t > maxDist) {
-            break;
-        }
-    }
-    return clamp(res, 0.0, 1.0);
+// Blue (few steps) through green and yellow to red (MAX_STEPS)
+vec3 heatColor(float x) {
+    x = clamp(x, 0.0, 1.0);
+    return clamp(vec3(1.5 - abs(4.0 * x - 3.0), 1.5 - abs(4.0 * x - 2.0), 1.5 - abs(4.0 * x - 1.0)), 0.0, 1.0);
 }
 
 // SDF for microbe membrane using skeleton points
 float sdMembrane(vec3 p) {
+    gEvalCount++;
     float d = 1e10;
     int count = pointCount;
     if (count > 64) {
@@ -288,36 +296,66 @@ void main()
     float surfDist = max(0.003, baseRadius * 0.02);
     float t = 0.0;
     float hit = -1.0;
+    int steps = 0;
+    // Over-relaxation (Keinert et al. 2014): step further than the safe
+    // distance while consecutive unbounding spheres still overlap; once they
+    // don't, back off to the safe step for the rest of the ray
+    float omega = relaxedTracing != 0 ? RELAXATION : 1.0;
+    float prevRadius = 0.0;
+    float stepLen = 0.0;
     for (int i = 0; i < MAX_STEPS; i++) {
+        steps++;
         vec3 p = ro + rd * t;
         float d = sdMembrane(p);
-        if (d < surfDist) {
-            hit = t;
-            break;
+        // The warped SDF overestimates distance, so half of it is the safe step
+        float radius = d * 0.5;
+        bool overshot = omega > 1.0 && (abs(radius) + prevRadius) < stepLen;
+        if (overshot) {
+            // Lands back inside the previous safe sphere
+            stepLen -= omega * stepLen;
+            omega = 1.0;
+        } else {
+            if (d < surfDist) {
+                hit = t;
+                break;
+            }
+            stepLen = clamp(radius * omega, surfDist * 0.5, 1.0);
         }
-        float step = clamp(d * 0.5, surfDist * 0.5, 1.0);
-        t += step;
+        prevRadius = abs(radius);
+        t += stepLen;
         if (t > MAX_DIST) {
             break;
         }
     }
 
     if (hit < 0.0) {
-        discard;
+        if (debugMode == 0 && collectStats == 0) {
+            discard;
+        }
+        gCounts = vec4(float(steps), float(gEvalCount), 1.0, 0.0);
+        if (debugMode != 0) {
+            // Misses show in the heatmap too, behind every hit
+            gl_FragDepth = max(gl_FragCoord.z, 0.99999);
+            gAlbedo = vec4(heatColor(float(steps) / float(MAX_STEPS)), 1.0);
+            gNormal = vec4(0.0, 1.0, 0.0, microbeId);
+        } else {
+            // Only the work is recorded: id 0 on the far plane leaves the
+            // colour targets as cleared, and lighting skips the pixel
+            gl_FragDepth = 1.0;
+            gAlbedo = vec4(0.0);
+            gNormal = vec4(0.0, 1.0, 0.0, 0.0);
+        }
+        return;
     }
 
     vec3 p = ro + rd * hit;
+
+    // Depth of the raymarched surface rather than the proxy cube, so rasterized
+    // shells and spines intersect the membrane correctly
+    vec4 clip = mvp * vec4(p, 1.0);
+    gl_FragDepth = (clip.z / clip.w) * 0.5 + 0.5;
+
     vec3 n = calcNormal(p);
-    vec3 lightDir = normalize(vec3(0.45, 0.85, 0.25));
-    vec3 fillDir = normalize(vec3(-0.35, 0.65, -0.65));
-    vec3 viewDir = normalize(viewPos - p);
-    float wrap = 0.35;
-    float shadow = pow(softShadow(p + n * 0.01, lightDir, 4.0), 1.35);
-    float diff = clamp((dot(n, lightDir) + wrap) / (1.0 + wrap), 0.0, 1.0) * shadow;
-    float diffFill = clamp((dot(n, fillDir) + 0.15) / 1.15, 0.0, 1.0);
-    float spec = pow(max(dot(reflect(-lightDir, n), viewDir), 0.0), 20.0) * shadow;
-    float specFill = pow(max(dot(reflect(-fillDir, n), viewDir), 0.0), 26.0) * 0.4;
-    float rim = pow(1.0 - max(dot(n, viewDir), 0.0), 2.1);
 
     float occ = 0.0;
     for (int i = 1; i <= 4; i++) {
@@ -327,17 +365,12 @@ void main()
     }
     float ao = clamp(1.0 - occ * 0.5, 0.35, 1.0);
 
+    // View-independent surface colour; lighting, fresnel gel tint and
+    // subsurface are applied once per pixel in the lighting pass
     float cellNoise = fbm(p * 2.0 + vec3(0.0, 1.7, 3.1) + time * 0.05);
     float membrane = fbm(p * 6.0 + vec3(2.4, 0.3, 1.1) + time * 0.1);
     vec3 base = microbeColor * (0.8 + 0.2 * cellNoise);
-    vec3 gelTint = vec3(0.85, 0.95, 0.9);
-    float coreDepth = clamp(1.0 - length(p - center) / (baseRadius * 1.4), 0.0, 1.0);
-    vec3 coreTint = mix(vec3(1.0, 0.85, 0.75), microbeColor, 0.65);
-    vec3 subsurface = microbeColor * 0.55 * pow(max(dot(n, -lightDir), 0.0), 1.05);
-    float fresnel = pow(1.0 - max(dot(n, viewDir), 0.0), 1.6);
-    vec3 membraneTint = mix(base, base * 1.15, membrane * 0.6);
-    float lighting = 0.25 + diff * 0.55 + diffFill * 0.2;
-    vec3 color = mix(membraneTint, gelTint, 0.08 + 0.22 * fresnel) * lighting * ao;
+    vec3 color = mix(base, base * 1.15, membrane * 0.6);
     vec3 nucleusDir = normalize(vec3(
         hash3(center + vec3(1.3, 2.1, 3.7)) - 0.5,
         hash3(center + vec3(2.9, 0.7, 1.1)) - 0.5,
@@ -347,10 +380,11 @@ void main()
     float nucleusDist = length(p - nucleusPos);
     float nucleus = smoothstep(baseRadius * 0.25, baseRadius * 0.1, nucleusDist);
     color = mix(color, vec3(0.95, 0.86, 0.8), nucleus * 0.3);
+    float coreDepth = clamp(1.0 - length(p - center) / (baseRadius * 1.4), 0.0, 1.0);
+    vec3 coreTint = mix(vec3(1.0, 0.85, 0.75), microbeColor, 0.65);
     color = mix(coreTint, color, 0.4 + 0.6 * (1.0 - coreDepth));
-    color += subsurface * 0.55;
-    color += vec3(0.95) * (spec * 0.32 + specFill * 0.18);
-    color += vec3(0.18, 0.28, 0.22) * rim;
 
-    finalColor = vec4(color, 1.0);
+    gAlbedo = debugMode != 0 ? vec4(heatColor(float(steps) / float(MAX_STEPS)), 1.0) : vec4(color, ao);
+    gNormal = vec4(n, microbeId);
+    gCounts = vec4(float(steps), float(gEvalCount), 1.0, 1.0);
 }
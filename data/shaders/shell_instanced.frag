@@ -0,0 +1,32 @@
+#version 330
+
+// Lighting matches the SDF membranes so shells and membranes sit together
+
+in vec3 fragWorldPos;
+in vec3 fragNormal;
+in vec3 fragColor;
+
+uniform vec3 viewPos;
+
+out vec4 finalColor;
+
+void main()
+{
+    vec3 n = normalize(fragNormal);
+    vec3 lightDir = normalize(vec3(0.45, 0.85, 0.25));
+    vec3 fillDir = normalize(vec3(-0.35, 0.65, -0.65));
+    vec3 viewDir = normalize(viewPos - fragWorldPos);
+
+    float wrap = 0.35;
+    float diff = clamp((dot(n, lightDir) + wrap) / (1.0 + wrap), 0.0, 1.0);
+    float diffFill = clamp((dot(n, fillDir) + 0.15) / 1.15, 0.0, 1.0);
+    float spec = pow(max(dot(reflect(-lightDir, n), viewDir), 0.0), 40.0);
+    float rim = pow(1.0 - max(dot(n, viewDir), 0.0), 2.1);
+
+    // Silica and protein coats are glassier than membranes
+    vec3 color = fragColor * (0.25 + diff * 0.55 + diffFill * 0.2);
+    color += vec3(0.95) * spec * 0.45;
+    color += vec3(0.18, 0.28, 0.22) * rim;
+
+    finalColor = vec4(color, 1.0);
+}
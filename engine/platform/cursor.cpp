@@ -0,0 +1,30 @@
+#include "engine/platform/cursor.h"
+
+#if defined(_WIN32)
+// Declared by hand: windows.h clashes with raylib's names (Rectangle, CloseWindow, ...)
+extern "C" {
+struct CursorPoint {
+    long x;
+    long y;
+};
+__declspec(dllimport) int __stdcall GetCursorPos(CursorPoint *point);
+__declspec(dllimport) int __stdcall ScreenToClient(void *window, CursorPoint *point);
+}
+
+bool cursor_query(void *native_window, float *x, float *y) {
+    CursorPoint point;
+    if (!native_window || !GetCursorPos(&point) || !ScreenToClient(native_window, &point)) {
+        return false;
+    }
+    *x = (float)point.x;
+    *y = (float)point.y;
+    return true;
+}
+#else
+bool cursor_query(void *native_window, float *x, float *y) {
+    (void)native_window;
+    (void)x;
+    (void)y;
+    return false;
+}
+#endif
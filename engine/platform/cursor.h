@@ -0,0 +1,13 @@
+#ifndef MICRO_IDLE_CURSOR_H
+#define MICRO_IDLE_CURSOR_H
+
+#include <stdbool.h>
+
+// Live cursor position in window client pixels, read straight from the OS.
+// Unlike polling input events, this does not advance raylib's input state, so
+// it can be called late in a frame without swallowing pressed/released edges.
+// Returns false where unsupported (or without a window); callers then fall
+// back to the position from the last event poll.
+bool cursor_query(void *native_window, float *x, float *y);
+
+#endif
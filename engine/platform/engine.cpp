@@ -1,9 +1,13 @@
 #include "engine/platform/engine.h"
 #include "engine/platform/time.h"
+#include "engine/platform/power.h"
+#include "engine/platform/frame_pacer.h"
 
 void engine_init(EngineContext *ctx, EngineConfig cfg) {
     ctx->cfg = cfg;
     time_init(&ctx->time, cfg.tick_hz);
+    power_init(&ctx->power, cfg.background_tick_hz, cfg.hidden_after_s);
+    frame_pacer_init(&ctx->pacer, cfg.target_fps);
 }
 
 int engine_time_update(EngineContext *ctx, double real_dt) {
@@ -13,3 +17,17 @@ int engine_time_update(EngineContext *ctx, double real_dt) {
 float engine_time_alpha(const EngineContext *ctx) {
     return time_alpha(&ctx->time);
 }
+
+PowerMode engine_power_update(EngineContext *ctx, bool minimized, bool focused, double real_dt) {
+    PowerMode previous = ctx->power.mode;
+    PowerMode mode = power_update(&ctx->power, minimized, focused, real_dt);
+    if (mode != previous) {
+        int hz = (mode == POWER_MODE_ACTIVE) ? ctx->cfg.tick_hz : ctx->power.background_tick_hz;
+        time_set_tick_hz(&ctx->time, hz);
+    }
+    return mode;
+}
+
+const FramePacerStats *engine_frame_stats(const EngineContext *ctx) {
+    return &ctx->pacer.stats;
+}
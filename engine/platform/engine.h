@@ -3,23 +3,31 @@
 
 #include <stdbool.h>
 #include "engine/platform/time.h"
+#include "engine/platform/power.h"
+#include "engine/platform/frame_pacer.h"
 
 typedef struct EngineConfig {
     int window_w;
     int window_h;
-    int target_fps;
+    int target_fps;             // Frame cap enforced by the frame pacer (0 = uncapped)
     int tick_hz;
     bool vsync;
     bool dev_mode;
+    int background_tick_hz;     // Reduced tick rate while unfocused/minimized (0 = default)
+    double hidden_after_s;      // Minimized seconds before statistical fast-forward
 } EngineConfig;
 
 typedef struct EngineContext {
     EngineConfig cfg;
     TimeState time;
+    PowerState power;
+    FramePacer pacer;
 } EngineContext;
 
 void engine_init(EngineContext *ctx, EngineConfig cfg);
 int engine_time_update(EngineContext *ctx, double real_dt);
 float engine_time_alpha(const EngineContext *ctx);
+PowerMode engine_power_update(EngineContext *ctx, bool minimized, bool focused, double real_dt);
+const FramePacerStats *engine_frame_stats(const EngineContext *ctx);
 
 #endif
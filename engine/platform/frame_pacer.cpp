@@ -0,0 +1,159 @@
+#include "engine/platform/frame_pacer.h"
+#include <chrono>
+#include <thread>
+
+// Weight of the newest sample in the moving statistics (~32 frame window)
+static const double STATS_ALPHA = 1.0 / 32.0;
+
+// Windows sleeps in ~1 ms quanta once raylib raises the timer resolution;
+// spinning the last 2 ms absorbs that jitter without burning a whole core.
+static const double DEFAULT_SPIN_THRESHOLD = 0.002;
+
+static void stats_push(double *mean, double *variance, double sample, uint64_t count) {
+    if (count == 0) {
+        *mean = sample;
+        if (variance) {
+            *variance = 0.0;
+        }
+        return;
+    }
+    double delta = sample - *mean;
+    *mean += STATS_ALPHA * delta;
+    if (variance) {
+        *variance = (1.0 - STATS_ALPHA) * (*variance + STATS_ALPHA * delta * delta);
+    }
+}
+
+double frame_pacer_now(void) {
+    auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(since_epoch).count();
+}
+
+void frame_pacer_init(FramePacer *pacer, int fps_cap) {
+    pacer->spin_threshold = DEFAULT_SPIN_THRESHOLD;
+    pacer->last_frame_start = -1.0;
+    pacer->next_deadline = 0.0;
+    pacer->input_time = 0.0;
+    pacer->input_pending = false;
+    pacer->latch_time = 0.0;
+    pacer->latch_pending = false;
+    frame_pacer_set_cap(pacer, fps_cap);
+    frame_pacer_reset_stats(pacer);
+}
+
+void frame_pacer_set_cap(FramePacer *pacer, int fps_cap) {
+    pacer->target_interval = (fps_cap > 0) ? (1.0 / (double)fps_cap) : 0.0;
+}
+
+void frame_pacer_reset_stats(FramePacer *pacer) {
+    pacer->stats.frames = 0;
+    pacer->stats.presents = 0;
+    pacer->stats.waits = 0;
+    pacer->stats.frame_time_mean = 0.0;
+    pacer->stats.frame_time_variance = 0.0;
+    pacer->stats.input_latency_mean = 0.0;
+    pacer->stats.input_latency_max = 0.0;
+    pacer->stats.latch_presents = 0;
+    pacer->stats.latch_latency_mean = 0.0;
+    pacer->stats.latch_latency_max = 0.0;
+    pacer->stats.oversleep_mean = 0.0;
+}
+
+double frame_pacer_begin_frame(FramePacer *pacer, double now) {
+    if (pacer->last_frame_start < 0.0) {
+        pacer->last_frame_start = now;
+        pacer->next_deadline = now;
+        return 0.0;
+    }
+
+    double real_dt = now - pacer->last_frame_start;
+    if (real_dt < 0.0) {
+        real_dt = 0.0;
+    }
+    pacer->last_frame_start = now;
+
+    stats_push(&pacer->stats.frame_time_mean, &pacer->stats.frame_time_variance,
+               real_dt, pacer->stats.frames);
+    pacer->stats.frames++;
+    return real_dt;
+}
+
+void frame_pacer_mark_input(FramePacer *pacer, double now) {
+    pacer->input_time = now;
+    pacer->input_pending = true;
+}
+
+void frame_pacer_mark_latch(FramePacer *pacer, double now) {
+    pacer->latch_time = now;
+    pacer->latch_pending = true;
+}
+
+static void latency_push(double *mean, double *max, uint64_t *count, double sample_time, double now) {
+    double latency = now - sample_time;
+    if (latency < 0.0) {
+        latency = 0.0;
+    }
+    stats_push(mean, NULL, latency, *count);
+    (*count)++;
+    if (latency > *max) {
+        *max = latency;
+    }
+}
+
+void frame_pacer_mark_present(FramePacer *pacer, double now) {
+    if (pacer->input_pending) {
+        pacer->input_pending = false;
+        latency_push(&pacer->stats.input_latency_mean, &pacer->stats.input_latency_max,
+                     &pacer->stats.presents, pacer->input_time, now);
+    }
+    if (pacer->latch_pending) {
+        pacer->latch_pending = false;
+        latency_push(&pacer->stats.latch_latency_mean, &pacer->stats.latch_latency_max,
+                     &pacer->stats.latch_presents, pacer->latch_time, now);
+    }
+}
+
+double frame_pacer_next_deadline(FramePacer *pacer, double now) {
+    if (pacer->target_interval <= 0.0) {
+        pacer->next_deadline = now;
+        return now;
+    }
+
+    pacer->next_deadline += pacer->target_interval;
+    // More than a frame behind (hitch, breakpoint, window drag): resync the
+    // phase instead of rushing a burst of frames to catch up
+    if (pacer->next_deadline + pacer->target_interval < now) {
+        pacer->next_deadline = now;
+    }
+    return pacer->next_deadline;
+}
+
+void frame_pacer_sleep_until(double deadline, double spin_threshold) {
+    double remaining = deadline - frame_pacer_now();
+    if (remaining <= 0.0) {
+        return;
+    }
+
+    if (remaining > spin_threshold) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(remaining - spin_threshold));
+    }
+    while (frame_pacer_now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+void frame_pacer_wait(FramePacer *pacer) {
+    if (pacer->target_interval <= 0.0) {
+        return;
+    }
+
+    double deadline = frame_pacer_next_deadline(pacer, frame_pacer_now());
+    frame_pacer_sleep_until(deadline, pacer->spin_threshold);
+
+    double oversleep = frame_pacer_now() - deadline;
+    if (oversleep < 0.0) {
+        oversleep = 0.0;
+    }
+    stats_push(&pacer->stats.oversleep_mean, NULL, oversleep, pacer->stats.waits);
+    pacer->stats.waits++;
+}
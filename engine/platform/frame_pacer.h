@@ -0,0 +1,58 @@
+#ifndef MICRO_IDLE_FRAME_PACER_H
+#define MICRO_IDLE_FRAME_PACER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Frame pacing and latency measurement. All times are seconds on the
+// monotonic clock returned by frame_pacer_now(); every function that needs
+// "now" takes it as a parameter so the pacer can be driven synthetically.
+typedef struct FramePacerStats {
+    uint64_t frames;              // Frame-time samples recorded
+    uint64_t presents;            // Input -> present latency samples recorded
+    uint64_t waits;               // Capped waits recorded
+    double frame_time_mean;       // Exponential moving average of frame-to-frame time
+    double frame_time_variance;   // Exponential moving variance of frame-to-frame time
+    double input_latency_mean;    // Input sample -> present, moving average
+    double input_latency_max;     // Worst input sample -> present since last reset
+    uint64_t latch_presents;      // Cursor latch -> present samples recorded
+    double latch_latency_mean;    // Late cursor latch -> present, moving average
+    double latch_latency_max;     // Worst latch -> present since last reset
+    double oversleep_mean;        // How far past the deadline the pacer woke up
+} FramePacerStats;
+
+typedef struct FramePacer {
+    double target_interval;       // Seconds per frame; 0 = uncapped (vsync or nothing paces)
+    double spin_threshold;        // Final stretch before a deadline that is spun, not slept
+    double last_frame_start;      // < 0 until the first frame
+    double next_deadline;
+    double input_time;
+    bool input_pending;
+    double latch_time;
+    bool latch_pending;
+    FramePacerStats stats;
+} FramePacer;
+
+double frame_pacer_now(void);
+
+void frame_pacer_init(FramePacer *pacer, int fps_cap);
+void frame_pacer_set_cap(FramePacer *pacer, int fps_cap);
+void frame_pacer_reset_stats(FramePacer *pacer);
+
+// Returns the real delta since the previous frame start and records it
+double frame_pacer_begin_frame(FramePacer *pacer, double now);
+void frame_pacer_mark_input(FramePacer *pacer, double now);
+// The cursor was re-sampled for drawing; measured to present separately from input
+void frame_pacer_mark_latch(FramePacer *pacer, double now);
+void frame_pacer_mark_present(FramePacer *pacer, double now);
+
+// Advances the cap deadline past a present at `now`; returns `now` when uncapped
+double frame_pacer_next_deadline(FramePacer *pacer, double now);
+
+// Coarse OS sleep followed by a short spin so wakeup lands on the deadline
+void frame_pacer_sleep_until(double deadline, double spin_threshold);
+
+// Sleeps until the next cap deadline (no-op when uncapped)
+void frame_pacer_wait(FramePacer *pacer);
+
+#endif
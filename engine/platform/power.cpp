@@ -0,0 +1,54 @@
+#include "engine/platform/power.h"
+
+void power_init(PowerState *state, int background_tick_hz, double hidden_after_s) {
+    state->mode = POWER_MODE_ACTIVE;
+    state->background_time = 0.0;
+    state->hidden_time = 0.0;
+    state->hidden_after = (hidden_after_s > 0.0) ? hidden_after_s : 0.0;
+    state->background_tick_hz = (background_tick_hz > 0) ? background_tick_hz : 10;
+}
+
+PowerMode power_update(PowerState *state, bool minimized, bool focused, double real_dt) {
+    if (real_dt < 0.0) {
+        real_dt = 0.0;
+    }
+
+    if (!minimized && focused) {
+        state->mode = POWER_MODE_ACTIVE;
+        state->background_time = 0.0;
+        return state->mode;
+    }
+
+    state->background_time += real_dt;
+
+    // Only a minimized window may go fully dark; an unfocused but visible
+    // window stays in BACKGROUND so the simulation keeps advancing in real
+    // time instead of in statistical jumps.
+    if (minimized && state->background_time >= state->hidden_after) {
+        if (state->mode == POWER_MODE_HIDDEN) {
+            state->hidden_time += real_dt;
+        }
+        state->mode = POWER_MODE_HIDDEN;
+    } else {
+        state->mode = POWER_MODE_BACKGROUND;
+    }
+    return state->mode;
+}
+
+double power_take_hidden_time(PowerState *state) {
+    double banked = state->hidden_time;
+    state->hidden_time = 0.0;
+    return banked;
+}
+
+double power_idle_interval(const PowerState *state) {
+    switch (state->mode) {
+        case POWER_MODE_BACKGROUND:
+            return 1.0 / (double)state->background_tick_hz;
+        case POWER_MODE_HIDDEN:
+            // Only polling the OS for restore events; four wakeups a second is plenty
+            return 0.25;
+        default:
+            return 0.0;
+    }
+}
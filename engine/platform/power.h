@@ -0,0 +1,29 @@
+#ifndef MICRO_IDLE_POWER_H
+#define MICRO_IDLE_POWER_H
+
+#include <stdbool.h>
+
+// Runtime power mode, derived from window visibility and focus.
+// ACTIVE renders and ticks at full fidelity. BACKGROUND stops rendering and
+// ticks at a reduced rate. HIDDEN stops ticking entirely; the elapsed time is
+// banked and handed to the game as a statistical fast-forward on wake.
+typedef enum PowerMode {
+    POWER_MODE_ACTIVE = 0,
+    POWER_MODE_BACKGROUND = 1,
+    POWER_MODE_HIDDEN = 2
+} PowerMode;
+
+typedef struct PowerState {
+    PowerMode mode;
+    double background_time;   // Seconds spent continuously out of ACTIVE
+    double hidden_time;       // Seconds banked while HIDDEN, not yet fast-forwarded
+    double hidden_after;      // Background seconds before switching to HIDDEN
+    int background_tick_hz;   // Fixed tick rate while in BACKGROUND
+} PowerState;
+
+void power_init(PowerState *state, int background_tick_hz, double hidden_after_s);
+PowerMode power_update(PowerState *state, bool minimized, bool focused, double real_dt);
+double power_take_hidden_time(PowerState *state);
+double power_idle_interval(const PowerState *state);
+
+#endif
@@ -33,3 +33,11 @@ float time_alpha(const TimeState *state) {
     }
     return (float)(state->accumulator / state->tick_dt);
 }
+
+void time_set_tick_hz(TimeState *state, int tick_hz) {
+    state->tick_dt = (tick_hz > 0) ? (1.0 / (double)tick_hz) : (1.0 / 60.0);
+    // Drop partial progress that would otherwise turn into a burst at the new rate
+    if (state->accumulator > state->tick_dt) {
+        state->accumulator = state->tick_dt;
+    }
+}
@@ -13,5 +13,6 @@ typedef struct TimeState {
 void time_init(TimeState *state, int tick_hz);
 int time_update(TimeState *state, double real_dt);
 float time_alpha(const TimeState *state);
+void time_set_tick_hz(TimeState *state, int tick_hz);
 
 #endif
@@ -1,5 +1,9 @@
 #include "engine/util/rng.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 static uint64_t xorshift64(uint64_t *state) {
     uint64_t x = *state;
     x ^= x << 13;
@@ -9,6 +13,14 @@ static uint64_t xorshift64(uint64_t *state) {
     return x;
 }
 
+uint64_t rng_mix64(uint64_t x) {
+    // splitmix64 finalizer
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
 void rng_seed(Rng *rng, uint64_t seed) {
     if (seed == 0) {
         seed = 0x9E3779B97F4A7C15ULL;
@@ -16,6 +28,14 @@ void rng_seed(Rng *rng, uint64_t seed) {
     rng->state = seed;
 }
 
+void rng_seed_stream(Rng *rng, uint64_t seed, uint64_t stream_id) {
+    rng_seed(rng, rng_mix64(seed ^ rng_mix64(stream_id)));
+}
+
+void rng_split(const Rng *parent, uint64_t stream_id, Rng *out) {
+    rng_seed_stream(out, parent->state, stream_id);
+}
+
 uint32_t rng_next_u32(Rng *rng) {
     return (uint32_t)(xorshift64(&rng->state) & 0xFFFFFFFFu);
 }
@@ -35,3 +55,115 @@ int rng_range_i(Rng *rng, int min, int max_inclusive) {
     uint32_t span = (uint32_t)(max_inclusive - min + 1);
     return min + (int)(rng_next_u32(rng) % span);
 }
+
+void rng8_seed(Rng8 *rng, uint64_t seed, uint64_t stream_id) {
+    uint64_t x = seed ^ rng_mix64(stream_id);
+    for (int lane = 0; lane < 8; lane++) {
+        for (int k = 0; k < 4; k += 2) {
+            x = rng_mix64(x);
+            rng->s[k][lane] = (uint32_t)x;
+            rng->s[k + 1][lane] = (uint32_t)(x >> 32);
+        }
+        // xoshiro must never sit in the all-zero state
+        if ((rng->s[0][lane] | rng->s[1][lane] | rng->s[2][lane] | rng->s[3][lane]) == 0) {
+            rng->s[0][lane] = 1;
+        }
+    }
+}
+
+static inline uint32_t rotl32(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+void rng8_next_u32(Rng8 *rng, uint32_t out[8]) {
+#if defined(__AVX2__)
+    __m256i s0 = _mm256_loadu_si256((const __m256i *)rng->s[0]);
+    __m256i s1 = _mm256_loadu_si256((const __m256i *)rng->s[1]);
+    __m256i s2 = _mm256_loadu_si256((const __m256i *)rng->s[2]);
+    __m256i s3 = _mm256_loadu_si256((const __m256i *)rng->s[3]);
+
+    __m256i result = _mm256_add_epi32(s0, s3);
+    __m256i t = _mm256_slli_epi32(s1, 9);
+    s2 = _mm256_xor_si256(s2, s0);
+    s3 = _mm256_xor_si256(s3, s1);
+    s1 = _mm256_xor_si256(s1, s2);
+    s0 = _mm256_xor_si256(s0, s3);
+    s2 = _mm256_xor_si256(s2, t);
+    s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+
+    _mm256_storeu_si256((__m256i *)rng->s[0], s0);
+    _mm256_storeu_si256((__m256i *)rng->s[1], s1);
+    _mm256_storeu_si256((__m256i *)rng->s[2], s2);
+    _mm256_storeu_si256((__m256i *)rng->s[3], s3);
+    _mm256_storeu_si256((__m256i *)out, result);
+#else
+    for (int lane = 0; lane < 8; lane++) {
+        uint32_t s0 = rng->s[0][lane];
+        uint32_t s1 = rng->s[1][lane];
+        uint32_t s2 = rng->s[2][lane];
+        uint32_t s3 = rng->s[3][lane];
+
+        out[lane] = s0 + s3;
+        uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = rotl32(s3, 11);
+
+        rng->s[0][lane] = s0;
+        rng->s[1][lane] = s1;
+        rng->s[2][lane] = s2;
+        rng->s[3][lane] = s3;
+    }
+#endif
+}
+
+void rng8_fill_u32(Rng8 *rng, uint32_t *out, int count) {
+    uint32_t block[8];
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        rng8_next_u32(rng, out + i);
+    }
+    if (i < count) {
+        rng8_next_u32(rng, block);
+        for (int lane = 0; i < count; i++, lane++) {
+            out[i] = block[lane];
+        }
+    }
+}
+
+void rng8_fill_range(Rng8 *rng, float *out, int count, float min, float max) {
+    // xoshiro128+ has weak low bits; floats take the top 24
+    const float scale = (max - min) * (1.0f / 16777216.0f);
+    uint32_t block[8];
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vmin = _mm256_set1_ps(min);
+    for (; i + 8 <= count; i += 8) {
+        rng8_next_u32(rng, block);
+        __m256i bits = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i *)block), 8);
+        __m256 f = _mm256_cvtepi32_ps(bits);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(vmin, _mm256_mul_ps(f, vscale)));
+    }
+#else
+    for (; i + 8 <= count; i += 8) {
+        rng8_next_u32(rng, block);
+        for (int lane = 0; lane < 8; lane++) {
+            out[i + lane] = min + (float)(block[lane] >> 8) * scale;
+        }
+    }
+#endif
+    if (i < count) {
+        rng8_next_u32(rng, block);
+        for (int lane = 0; i < count; i++, lane++) {
+            out[i] = min + (float)(block[lane] >> 8) * scale;
+        }
+    }
+}
+
+void rng8_fill_f01(Rng8 *rng, float *out, int count) {
+    rng8_fill_range(rng, out, count, 0.0f, 1.0f);
+}
@@ -3,14 +3,39 @@
 
 #include <stdint.h>
 
+// Single source of randomness for engine and game code.
+//
+// Rng is a small scalar stream (xorshift64). Independent streams are derived
+// with rng_seed_stream()/rng_split() by hashing (seed, stream id) through
+// splitmix64, so per-system and per-entity streams never depend on how much
+// any other stream has been consumed.
+//
+// Rng8 is an 8-lane xoshiro128+ generator for bulk fills. It uses AVX2 when
+// the target supports it and an equivalent scalar path otherwise; both produce
+// the same integer sequence for the same seed.
+
 typedef struct Rng {
     uint64_t state;
 } Rng;
 
+typedef struct Rng8 {
+    uint32_t s[4][8];   // State word k for lane i lives in s[k][i]
+} Rng8;
+
+uint64_t rng_mix64(uint64_t x);
+
 void rng_seed(Rng *rng, uint64_t seed);
+void rng_seed_stream(Rng *rng, uint64_t seed, uint64_t stream_id);
+void rng_split(const Rng *parent, uint64_t stream_id, Rng *out);
 uint32_t rng_next_u32(Rng *rng);
 float rng_next_f01(Rng *rng);
 float rng_range(Rng *rng, float min, float max);
 int rng_range_i(Rng *rng, int min, int max_inclusive);
 
+void rng8_seed(Rng8 *rng, uint64_t seed, uint64_t stream_id);
+void rng8_next_u32(Rng8 *rng, uint32_t out[8]);
+void rng8_fill_u32(Rng8 *rng, uint32_t *out, int count);
+void rng8_fill_f01(Rng8 *rng, float *out, int count);
+void rng8_fill_range(Rng8 *rng, float *out, int count, float min, float max);
+
 #endif
@@ -5,12 +5,24 @@
 #include "src/World.h"
 #include "src/components/Transform.h"
 #include "src/components/WorldState.h"
+#include "src/components/Input.h"
+#include "src/components/Rendering.h"
+#include "src/components/Microbe.h"
+#include "src/components/RenderPacket.h"
+#include "src/replay/InputRecording.h"
+#include "src/systems/SpawnSystem.h"
+#include "src/systems/RenderPacketSystem.h"
 #include <stdint.h>
+#include <cstddef>
+#include <string>
 #include "raymath.h"
 
 struct GameState {
     micro_idle::World* world;
     uint64_t seed;
+    int tick;                                   // Fixed ticks completed
+    micro_idle::replay::InputRecorder recorder;
+    std::string recordingPath;
 };
 
 // Calculate world dimensions from camera view frustum
@@ -48,10 +60,10 @@ static void calculateWorldDimensions(Camera3D camera, int screen_w, int screen_h
 }
 
 GameState* game_create(uint64_t seed) {
-    srand((unsigned int)seed);
     GameState* state = new GameState();
     state->seed = seed;
-    state->world = new micro_idle::World();
+    state->tick = 0;
+    state->world = new micro_idle::World(seed);
 
     // Calculate initial world dimensions based on camera view
     Camera3D camera = {0};
@@ -74,16 +86,13 @@ GameState* game_create(uint64_t seed) {
         worldState->spawnEnabled = false;
     }
 
-    // Create amoebas inside boundaries with EC&M locomotion
-    float spawnOffsetX = worldWidth * 0.25f;
-    float spawnOffsetZ = worldHeight * 0.25f;
-    state->world->createAmoeba({-spawnOffsetX, 1.5f, -spawnOffsetZ}, 0.28f, (Color){120, 200, 170, 255});
-    state->world->createAmoeba({spawnOffsetX, 1.5f, spawnOffsetZ}, 0.24f, (Color){90, 180, 140, 255});
+    state->world->createStarterMicrobes(worldWidth, worldHeight);
 
     return state;
 }
 
 void game_destroy(GameState* state) {
+    game_stop_recording(state);
     delete state->world;
     delete state;
 }
@@ -97,6 +106,10 @@ void game_handle_input(GameState* game, Camera3D camera, float dt, int screen_w,
     game->world->handleInput(camera, dt, screen_w, screen_h);
 }
 
+void game_latch_cursor(GameState* game, Camera3D camera) {
+    game->world->latchCursor(camera);
+}
+
 void game_handle_resize(GameState* game, int screen_w, int screen_h, Camera3D camera) {
     // Recalculate world dimensions (accounts for 32px margin)
     float worldWidth, worldHeight;
@@ -105,6 +118,7 @@ void game_handle_resize(GameState* game, int screen_w, int screen_h, Camera3D ca
     // Update boundaries and reposition out-of-bounds amoebas
     game->world->updateScreenBoundaries(worldWidth, worldHeight);
     game->world->repositionMicrobesInBounds(worldWidth, worldHeight);
+    game->recorder.recordDish(game->tick, worldWidth, worldHeight);
 
     // Update world state singleton with screen dimensions
     auto worldState = game->world->getWorld().get_mut<components::WorldState>();
@@ -116,6 +130,14 @@ void game_handle_resize(GameState* game, int screen_w, int screen_h, Camera3D ca
 
 void game_update_fixed(GameState* game, float dt) {
     game->world->update(dt);
+
+    if (game->recorder.isActive()) {
+        auto input = game->world->getWorld().get<components::InputState>();
+        if (input) {
+            game->recorder.recordTick(game->tick, *input);
+        }
+    }
+    game->tick++;
 }
 
 void game_render(const GameState* game, Camera3D camera, float alpha) {
@@ -126,29 +148,157 @@ void game_render_ui(GameState* game, int screen_w, int screen_h) {
     game->world->renderUI(screen_w, screen_h);
 }
 
+void game_set_sim_mode(GameState* game, GameSimMode mode) {
+    game->world->setReducedFidelity(mode == GAME_SIM_REDUCED);
+    game->recorder.recordSimMode(game->tick, mode == GAME_SIM_REDUCED);
+}
+
+void game_fast_forward(GameState* game, double seconds) {
+    game->world->fastForward((float)seconds);
+    game->recorder.recordFastForward(game->tick, (float)seconds);
+}
+
+void game_set_ambient_bacteria(GameState* game, int count) {
+    if (count < 0) {
+        count = 0;
+    }
+    if (count > GAME_GPU_ENTITY_COUNT) {
+        count = GAME_GPU_ENTITY_COUNT;
+    }
+    game->world->setAmbientBacteria(count);
+}
+
+int game_get_ambient_bacteria(const GameState* game) {
+    return game->world->getAmbientBacteriaCount();
+}
+
+void game_set_raymarch_debug(GameState* game, bool heatmap, bool relaxed, bool collect_stats) {
+    components::RaymarchDebug debug;
+    debug.heatmap = heatmap;
+    debug.relaxedTracing = relaxed;
+    debug.collectStats = collect_stats;
+    game->world->getWorld().set<components::RaymarchDebug>(debug);
+}
+
+bool game_get_raymarch_stats(const GameState* game, GameRaymarchStats* out) {
+    const micro_idle::rendering::RaymarchStats& stats = game->world->getRaymarchStats();
+    if (!out || !stats.valid) {
+        return false;
+    }
+    out->pixels = stats.pixels;
+    out->hits = stats.hits;
+    out->steps = stats.steps;
+    out->evaluations = stats.evaluations;
+    return true;
+}
+
+bool game_start_recording(GameState* game, const char* path, int tick_hz) {
+    // Replays start from a freshly created world, so the recording must too
+    if (!path || tick_hz <= 0 || game->tick != 0 || game->recorder.isActive()) {
+        return false;
+    }
+
+    flecs::world& world = game->world->getWorld();
+    auto worldState = world.get<components::WorldState>();
+
+    micro_idle::replay::Scenario header;
+    header.name = "recording";
+    header.seed = game->seed;
+    header.tickHz = tick_hz;
+    header.starters = true;
+    header.spawnRate = micro_idle::SpawnSystem::getSpawnRate(world);
+    header.ambientBacteria = game->world->getAmbientBacteriaCount();
+    if (worldState) {
+        header.dishWidth = worldState->worldWidth;
+        header.dishHeight = worldState->worldHeight;
+        header.spawnEnabled = worldState->spawnEnabled;
+    }
+
+    game->recordingPath = path;
+    game->recorder.begin(header);
+    return true;
+}
+
+bool game_stop_recording(GameState* game) {
+    if (!game->recorder.isActive()) {
+        return false;
+    }
+    const micro_idle::replay::Scenario& recording = game->recorder.finish(game->tick);
+    return micro_idle::replay::saveScenario(game->recordingPath.c_str(), recording);
+}
+
 // Test helpers
 int game_get_particle_count(const GameState* game) {
     return 0; // TODO: implement with Jolt physics
 }
 
 int game_get_microbe_count(const GameState* game) {
-    // Count entities with Transform component
-    return game->world->getWorld().count<components::Transform>();
+    return game->world->getWorld().count<components::Microbe>();
+}
+
+// game_get_render_packets hands out the internal array as-is
+static_assert(sizeof(GameRenderPacket) == sizeof(components::RenderPacket), "render packet layout");
+static_assert(offsetof(GameRenderPacket, position) == offsetof(components::RenderPacket, position), "render packet layout");
+static_assert(offsetof(GameRenderPacket, rotation) == offsetof(components::RenderPacket, rotation), "render packet layout");
+static_assert(offsetof(GameRenderPacket, color) == offsetof(components::RenderPacket, color), "render packet layout");
+static_assert(offsetof(GameRenderPacket, vertex_count) == offsetof(components::RenderPacket, vertexCount), "render packet layout");
+
+static const components::RenderPacket* findPacket(const GameState* game, int index) {
+    auto packets = game->world->getWorld().get<components::RenderPackets>();
+    if (!packets || index < 0 || index >= packets->size()) {
+        return nullptr;
+    }
+    return &packets->packets[(size_t)index];
+}
+
+int game_snapshot_microbes(const GameState* game, const GameMicrobeSnapshot* out, int capacity) {
+    micro_idle::MicrobeSnapshot arrays;
+    if (out && capacity > 0) {
+        arrays.entity = out->entity;
+        arrays.type = out->type;
+        arrays.x = out->x;
+        arrays.y = out->y;
+        arrays.z = out->z;
+        arrays.radius = out->radius;
+        arrays.health = out->health;
+        arrays.vertexCount = out->vertex_count;
+    } else {
+        capacity = 0;
+    }
+    return micro_idle::RenderPacketSystem::snapshot(game->world->getWorld(), arrays, capacity);
+}
+
+const GameRenderPacket* game_get_render_packets(const GameState* game, int* count) {
+    auto packets = game->world->getWorld().get<components::RenderPackets>();
+    int size = packets ? packets->size() : 0;
+    if (count) {
+        *count = size;
+    }
+    if (size == 0) {
+        return nullptr;
+    }
+    return reinterpret_cast<const GameRenderPacket*>(packets->packets.data());
 }
 
 float game_get_microbe_volume(const GameState* game, int index) {
-    return 0.0f; // TODO: implement
+    const components::RenderPacket* packet = findPacket(game, index);
+    if (!packet) {
+        return 0.0f;
+    }
+    return (4.0f / 3.0f) * PI * packet->radius * packet->radius * packet->radius;
 }
 
 float game_get_microbe_radius(const GameState* game, int index) {
-    return 0.0f; // TODO: implement
+    const components::RenderPacket* packet = findPacket(game, index);
+    return packet ? packet->radius : 0.0f;
 }
 
 void game_get_microbe_position(const GameState* game, int index, float* x, float* y, float* z) {
-    *x = 0.0f;
-    *y = 0.0f;
-    *z = 0.0f;
-    // TODO: implement
+    const components::RenderPacket* packet = findPacket(game, index);
+    Vector3 position = packet ? packet->position : Vector3{0.0f, 0.0f, 0.0f};
+    *x = position.x;
+    *y = position.y;
+    *z = position.z;
 }
 
 // Debug helper - direct world render access
@@ -9,16 +9,81 @@
 
 typedef struct GameState GameState;
 
+typedef enum GameSimMode {
+    GAME_SIM_FULL = 0,      // Foreground: full-fidelity locomotion and SDF extraction
+    GAME_SIM_REDUCED = 1    // Background: coarse locomotion, nothing prepared for rendering
+} GameSimMode;
+
 GameState *game_create(uint64_t seed);
 void game_destroy(GameState *game);
 bool game_init(GameState *game, uint64_t seed);
 void game_handle_input(GameState *game, Camera3D camera, float dt, int screen_w, int screen_h);
+// Late cursor sample for render-only feedback; call after the fixed updates, just before drawing
+void game_latch_cursor(GameState *game, Camera3D camera);
 void game_handle_resize(GameState *game, int screen_w, int screen_h, Camera3D camera);
 void game_update_fixed(GameState *game, float dt);
 void game_render(const GameState *game, Camera3D camera, float alpha);
 void game_render_ui(GameState *game, int screen_w, int screen_h);
 
-// Test helpers
+// Background/power-saving support
+void game_set_sim_mode(GameState *game, GameSimMode mode);
+void game_fast_forward(GameState *game, double seconds);
+
+// Ambient bacteria swarm (instanced, outside the ECS); clamped to GAME_GPU_ENTITY_COUNT
+void game_set_ambient_bacteria(GameState *game, int count);
+int game_get_ambient_bacteria(const GameState *game);
+
+// Input recording for the replay runner (bin/replay.cpp). Must start before the
+// first fixed tick; the recording is written as a scenario file when stopped
+// (or when the game is destroyed).
+bool game_start_recording(GameState *game, const char *path, int tick_hz);
+bool game_stop_recording(GameState *game);
+
+// SDF raymarch debugging. The heatmap replaces the shaded membranes with
+// per-pixel step counts; relaxed selects over-relaxed sphere tracing.
+typedef struct GameRaymarchStats {
+    double pixels;          // Proxy pixels that marched
+    double hits;            // ... and found the membrane
+    double steps;           // Raymarch loop iterations
+    double evaluations;     // SDF evaluations, including normal and AO taps
+} GameRaymarchStats;
+
+void game_set_raymarch_debug(GameState *game, bool heatmap, bool relaxed, bool collect_stats);
+// Totals of a recently sampled frame (one in 30, read back at the next
+// sample); false until the first sample after collection starts is read
+bool game_get_raymarch_stats(const GameState *game, GameRaymarchStats *out);
+
+// Bulk inspection for tools and tests. A snapshot fills caller-owned SoA arrays
+// (any may be NULL) with up to `capacity` microbes and returns the total count.
+typedef struct GameMicrobeSnapshot {
+    uint64_t *entity;
+    int32_t *type;              // MicrobeType
+    float *x;
+    float *y;
+    float *z;
+    float *radius;
+    float *health;
+    int32_t *vertex_count;      // SDF sample points
+} GameMicrobeSnapshot;
+
+int game_snapshot_microbes(const GameState *game, const GameMicrobeSnapshot *out, int capacity);
+
+// Render packets as of the last fixed tick, without copying. The array is owned
+// by the game and valid until the next game_update_fixed or game_destroy.
+typedef struct GameRenderPacket {
+    uint64_t entity;
+    Vector3 position;
+    float radius;
+    Quaternion rotation;
+    Color color;
+    int32_t type;               // MicrobeType
+    int32_t plan;               // Body plan kind
+    int32_t vertex_count;
+} GameRenderPacket;
+
+const GameRenderPacket *game_get_render_packets(const GameState *game, int *count);
+
+// Test helpers. Indexed getters read the render packets of the last tick.
 int game_get_particle_count(const GameState *game);
 int game_get_microbe_count(const GameState *game);
 float game_get_microbe_volume(const GameState *game, int index);
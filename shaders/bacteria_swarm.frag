@@ -0,0 +1,37 @@
+#version 330
+
+// Ambient bacteria impostor: 2D capsule (bacillus) or circle (coccus) SDF with
+// a fake spherical normal for shading
+
+in vec2 localPos;
+in float halfLength;
+in float agentType;
+in float tint;
+
+uniform float agentRadius;
+uniform vec3 coccusColor;
+uniform vec3 bacillusColor;
+
+out vec4 finalColor;
+
+void main()
+{
+    // Distance to the capsule core segment along the local x axis
+    vec2 q = vec2(max(abs(localPos.x) - halfLength, 0.0), localPos.y);
+    float d = length(q) - agentRadius;
+
+    float aa = fwidth(d);
+    float alpha = 1.0 - smoothstep(-aa, aa, d);
+    if (alpha <= 0.0) {
+        discard;
+    }
+
+    float r = clamp(length(q) / agentRadius, 0.0, 1.0);
+    vec3 normal = vec3(q / agentRadius, sqrt(1.0 - r * r));
+    float light = 0.45 + 0.55 * max(dot(normal, normalize(vec3(-0.3, 0.4, 0.86))), 0.0);
+
+    vec3 base = agentType > 0.5 ? bacillusColor : coccusColor;
+    base *= 0.85 + 0.3 * tint;
+
+    finalColor = vec4(base * light, alpha * 0.9);
+}
@@ -0,0 +1,11 @@
+#version 330
+
+// Attribute-less full-screen triangle: draw 3 vertices with an empty VAO
+out vec2 fragTexCoord;
+
+void main()
+{
+    vec2 uv = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+    fragTexCoord = uv;
+    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+}
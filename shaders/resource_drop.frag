@@ -0,0 +1,27 @@
+#version 330
+
+// Resource drop disc: bright core with a soft halo, faded by remaining lifetime
+
+in vec2 localPos;
+in vec3 dropColor;
+in float fade;
+
+out vec4 finalColor;
+
+void main()
+{
+    float r = length(localPos);
+    if (r >= 1.0) {
+        discard;
+    }
+
+    float core = 1.0 - smoothstep(0.35, 0.45, r);
+    float halo = (1.0 - r) * (1.0 - r);
+    vec3 color = mix(dropColor * 0.8, vec3(1.0), core * 0.35);
+    float alpha = max(core, halo * 0.6) * fade;
+    if (alpha <= 0.01) {
+        discard;
+    }
+
+    finalColor = vec4(color, alpha);
+}
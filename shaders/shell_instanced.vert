@@ -0,0 +1,30 @@
+#version 330
+
+// Instanced rigid shells (capsids, frustules, spines)
+// Row 3 of each instance matrix carries the colour (see InstancedShells)
+
+in vec3 vertexPosition;
+in vec3 vertexNormal;
+in mat4 instanceTransform;
+
+uniform mat4 mvp;
+
+out vec3 fragWorldPos;
+out vec3 fragNormal;
+out vec3 fragColor;
+
+void main()
+{
+    mat4 model = instanceTransform;
+    fragColor = vec3(model[0][3], model[1][3], model[2][3]);
+    model[0][3] = 0.0;
+    model[1][3] = 0.0;
+    model[2][3] = 0.0;
+    model[3][3] = 1.0;
+
+    vec4 world = model * vec4(vertexPosition, 1.0);
+    fragWorldPos = world.xyz;
+    fragNormal = mat3(model) * vertexNormal;
+
+    gl_Position = mvp * world;
+}
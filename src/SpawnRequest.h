@@ -3,6 +3,10 @@
 
 #include "raylib.h"
 
+namespace components {
+    enum class MicrobeType; // Forward declaration
+}
+
 namespace micro_idle {
 
 // Spawn request structure for deferred spawning
@@ -10,6 +14,7 @@ struct SpawnRequest {
     Vector3 position;
     float radius;
     Color color;
+    components::MicrobeType type{};     // Zero is Amoeba
 };
 
 } // namespace micro_idle
@@ -5,8 +5,15 @@
 #include "components/Rendering.h"
 #include "components/Input.h"
 #include "components/Microbe.h"
+#include "components/Appendage.h"
+#include "components/Adhesion.h"
+#include "components/Damage.h"
+#include "components/ChainReaction.h"
+#include "components/Killers.h"
+#include "components/StatusEffects.h"
 #include "systems/PhysicsSystem.h"
 #include "systems/SoftBodyFactory.h"
+#include "systems/BodyPlanFactory.h"
 #include "systems/ECMLocomotionSystem.h"
 #include "systems/InputSystem.h"
 #include "systems/TransformSyncSystem.h"
@@ -14,11 +21,31 @@
 #include "systems/SDFRenderSystem.h"
 #include "systems/SpawnSystem.h"
 #include "systems/DestructionSystem.h"
+#include "systems/ChainReactionSystem.h"
+#include "systems/KillerSystem.h"
+#include "systems/StatusEffectSystem.h"
 #include "systems/ResourceSystem.h"
+#include "systems/MicrobeIndexSystem.h"
+#include "systems/RenderPacketSystem.h"
+#include "systems/BacteriaSwarmSystem.h"
+#include "systems/AppendageSystem.h"
+#include "systems/ShellRenderSystem.h"
+#include "systems/MembraneContactSystem.h"
 #include "components/Resource.h"
+#include "components/Upgrades.h"
 #include "components/WorldState.h"
+#include "components/RandomStreams.h"
+#include "components/MicrobeIndex.h"
+#include "components/RenderPacket.h"
 #include "rendering/SDFShader.h"
 #include "rendering/RaymarchBounds.h"
+#include "rendering/InstancedBillboards.h"
+#include "rendering/InstancedShells.h"
+#include "swarm/BacteriaSwarm.h"
+#include "physics/RodSolver.h"
+#include "physics/MembraneContacts.h"
+#include "physics/AdhesionGraph.h"
+#include "engine/platform/cursor.h"
 #include <stdio.h>
 #include <cmath>
 #include <algorithm>
@@ -37,7 +64,7 @@ struct WorldBoundaries {
         north(), south(), east(), west(), floor() {}
 };
 
-World::World() {
+World::World(uint64_t seed) {
     // Initialize Jolt physics
     physics = new PhysicsSystemState();
 
@@ -47,6 +74,21 @@ World::World() {
     // Create render texture lazily when a window/context exists
     renderTexture.id = 0;
 
+    // Ambient swarm starts empty; its GPU buffers are created lazily in render()
+    swarm = new BacteriaSwarm(seed);
+    swarmBillboards = new rendering::InstancedBillboards();
+    shells = new rendering::InstancedShells();
+    dropBillboards = new rendering::InstancedBillboards();
+    deferredSdf = new rendering::DeferredSDF();
+
+    // Appendages rest on the dish floor (top of the floor box)
+    rods = new RodSolver();
+    rods->floorHeight = 0.2f;
+
+    // Jolt does not collide soft bodies with each other
+    membraneContacts = new MembraneContacts();
+    adhesion = new AdhesionGraph();
+
     // Register components and systems
     registerComponents();
     registerSystems();
@@ -54,9 +96,23 @@ World::World() {
 
     // Create singletons
     world.set<components::InputState>({});
+    world.set<components::CursorLatch>({});
     world.set<components::CameraState>({});
+    world.set<components::RaymarchDebug>({});
     world.set<components::ResourceInventory>({});
+    world.set<components::ResourceDrops>({});
+    world.set<components::PlayerUpgrades>({});
     world.set<components::WorldState>({});
+    world.set<components::MicrobeIndex>({});
+    world.set<components::DamageBuffer>({});
+    world.set<components::KillerAgents>({});
+    world.set<components::StatusEffects>({});
+    world.set<components::ChainReactions>({});
+    world.set<components::RenderPackets>({});
+
+    components::RandomStreams streams;
+    streams.reseed(seed);
+    world.set<components::RandomStreams>(streams);
 
     // Initialize boundaries
     boundaries = new WorldBoundaries();
@@ -67,6 +123,9 @@ World::World() {
 }
 
 World::~World() {
+    // Microbe bodies are released by their OnRemove observer, so drop the
+    // microbes while the physics world still exists
+    world.delete_with<components::Microbe>();
 
     // Clean up boundaries
     if (boundaries) {
@@ -86,7 +145,20 @@ World::~World() {
     if (sdfMembraneShader.id != 0) {
         UnloadShader(sdfMembraneShader);
     }
+    swarmBillboards->unload();
+    delete swarmBillboards;
+    shells->unload();
+    delete shells;
+    dropBillboards->unload();
+    delete dropBillboards;
+    deferredSdf->unload();
+    delete deferredSdf;
+    delete swarm;
+    delete rods;
+    delete membraneContacts;
+    delete adhesion;
     delete physics;
+    physics = nullptr;
 }
 
 void World::registerComponents() {
@@ -100,14 +172,31 @@ void World::registerComponents() {
     world.component<components::ECMLocomotion>();
     world.component<components::InternalSkeleton>();
     world.component<components::SDFRenderComponent>();
+    world.component<components::ShellRender>();
     world.component<components::CameraState>();
-    world.component<components::Resource>();
+    world.component<components::RaymarchDebug>();
+    world.component<components::ResourceDrops>();
     world.component<components::ResourceInventory>();
+    world.component<components::PlayerUpgrades>();
     world.component<components::WorldState>();
+    world.component<components::RandomStreams>();
+    world.component<components::MicrobeIndex>();
+    world.component<components::CursorLatch>();
+    world.component<components::DamageBuffer>();
+    world.component<components::KillerAgents>();
+    world.component<components::StatusEffects>();
+    world.component<components::ChainReactions>();
+    world.component<components::RenderPackets>();
+    world.component<components::Appendages>();
+    world.component<components::Adhesive>();
 }
 
 void World::registerSystems() {
     // Register systems in proper phase order:
+    // 0. MembraneContactSystem (OnUpdate - first, straight after the Jolt step;
+    //    also bonds Adhesive microbes)
+    MembraneContactSystem::registerSystem(world, membraneContacts, adhesion, physics);
+
     // 1. InputSystem (OnUpdate - first phase)
     InputSystem::registerSystem(world);
 
@@ -121,17 +210,47 @@ void World::registerSystems() {
     // Temporarily disable expensive SDF uniform updates for performance testing
     UpdateSDFUniforms::registerSystem(world, physics);
 
+    // 3. RenderPacketSystem (OnStore - flat per-microbe packets for tools)
+    RenderPacketSystem::registerSystem(world);
+
+    // 3. AppendageSystem (OnStore - rods pinned to the fresh sample points)
+    AppendageSystem::registerSystem(world, rods, physics);
+
+    // 3. MicrobeIndexSystem + BacteriaSwarmSystem (OnStore - swarm bounces off
+    //    the freshly indexed microbe footprints)
+    MicrobeIndexSystem::registerSystem(world);
+    BacteriaSwarmSystem::registerSystem(world, swarm, physics);
+
     // 4. SpawnSystem (OnUpdate - spawn microbes)
     SpawnSystem::registerSystem(world, this);
 
-    // 5. DestructionSystem (OnUpdate - hover/click detection)
+    // 5. KillerSystem (OnUpdate - autonomous killers retarget, move and queue damage)
+    KillerSystem::registerSystem(world, physics);
+
+    // 6. StatusEffectSystem (OnUpdate - timed effects and cooldowns count down,
+    //    damage-over-time queued into the damage buffer)
+    StatusEffectSystem::registerSystem(world);
+
+    // 7. ChainReactionSystem (OnUpdate - due chain-reaction hops fire, within the per-tick budget)
+    ChainReactionSystem::registerSystem(world);
+
+    // 8. DestructionSystem (OnUpdate - cursor damage, then the tick's damage
+    //    buffer applied and deaths processed in one batch)
     DestructionSystem::registerSystem(world, physics);
 
-    // 6. ResourceSystem (OnUpdate - resource lifetime and collection)
+    // 9. ResourceSystem (OnUpdate - drop lifetime, cursor pull and collection)
     ResourceSystem::registerSystem(world);
 
-    // 7. SDFRenderSystem (PostUpdate - render pipeline)
-    SDFRenderSystem::registerSystem(world);
+    // 10. Render systems (PostUpdate - render pipeline); swarm first so microbes draw over it,
+    //     opaque meshes before the raymarched membranes
+    BacteriaSwarmSystem::registerRenderSystem(world, swarm, swarmBillboards);
+    ResourceSystem::registerRenderSystem(world, dropBillboards);
+    AppendageSystem::registerRenderSystem(world, rods);
+    ShellRenderSystem::registerSystem(world, shells);
+    SDFRenderSystem::registerSystem(world, deferredSdf);
+    DestructionSystem::registerRenderSystem(world);
+    KillerSystem::registerRenderSystem(world);
+    ChainReactionSystem::registerRenderSystem(world);
 
     // Pipelines: split update and render so PostUpdate only runs during render()
     onUpdatePipeline = world.pipeline()
@@ -174,6 +293,20 @@ void World::registerPhysicsObservers() {
                 physics->destroyBody(physBody.bodyID);
             }
         });
+
+    // Observer: When a microbe is removed, destroy its Jolt body and skeleton
+    world.observer<components::Microbe>()
+        .event(flecs::OnRemove)
+        .each([this](flecs::entity e, components::Microbe& microbe) {
+            BodyPlanFactory::DestroyBody(physics, microbe, e.get<components::InternalSkeleton>());
+        });
+
+    // Observer: When a microbe's appendages are removed, free their rods
+    world.observer<components::Appendages>()
+        .event(flecs::OnRemove)
+        .each([this](flecs::entity e, components::Appendages& appendages) {
+            AppendageSystem::detach(appendages, *rods);
+        });
 }
 
 void World::update(float dt) {
@@ -182,7 +315,7 @@ void World::update(float dt) {
     physics->update(dt);
 
     // Progress the world (runs OnUpdate systems, then OnStore systems)
-    // OnUpdate: InputSystem, EC&M locomotion (above), physics (above)
+    // OnUpdate: membrane contacts, InputSystem, EC&M locomotion (above), physics (above)
     // OnStore: TransformSyncSystem, UpdateSDFUniforms
     if (onUpdatePipeline.is_valid()) {
         world.run_pipeline(onUpdatePipeline, dt);
@@ -192,12 +325,72 @@ void World::update(float dt) {
     }
 
     // Execute deferred spawns (after progress to avoid readonly issues)
+    flushSpawnQueue();
+}
+
+void World::flushSpawnQueue() {
     for (const auto& request : spawnQueue) {
-        auto entity = createAmoeba(request.position, request.radius, request.color);
+        createMicrobe(request.type, request.position, request.radius, request.color);
     }
     spawnQueue.clear();
 }
 
+void World::setReducedFidelity(bool reduced) {
+    auto worldState = world.get_mut<components::WorldState>();
+    if (worldState) {
+        worldState->reducedFidelity = reduced;
+    }
+
+    // Nothing is drawn in the background, so skip the per-vertex extraction entirely
+    flecs::entity sdfUniforms = world.lookup("UpdateSDFUniforms");
+    if (sdfUniforms.is_valid()) {
+        if (reduced) {
+            sdfUniforms.disable();
+        } else {
+            sdfUniforms.enable();
+        }
+    }
+}
+
+void World::setAmbientBacteria(int count) {
+    auto worldState = world.get<components::WorldState>();
+    float width = worldState ? worldState->worldWidth : 50.0f;
+    float height = worldState ? worldState->worldHeight : 50.0f;
+    swarm->setCount(count, width, height);
+}
+
+int World::getAmbientBacteriaCount() const {
+    return swarm->size();
+}
+
+bool World::isReducedFidelity() const {
+    auto worldState = world.get<components::WorldState>();
+    return worldState && worldState->reducedFidelity;
+}
+
+void World::fastForward(float seconds) {
+    if (seconds <= 0.0f) {
+        return;
+    }
+
+    // Resource drops age out in one pass instead of tick by tick
+    auto drops = world.get_mut<components::ResourceDrops>();
+    if (drops) {
+        ResourceSystem::age(*drops, seconds);
+    }
+
+    // Expected arrivals over the hidden period, capped so waking up stays cheap
+    auto worldState = world.get<components::WorldState>();
+    int spawnCount = SpawnSystem::consumeElapsed(world, seconds);
+    if (worldState && worldState->spawnEnabled && spawnCount > 0) {
+        spawnCount = std::min(spawnCount, MaxFastForwardSpawns);
+        auto streams = world.get_mut<components::RandomStreams>();
+        SpawnSystem::generateSpawnRequests(&streams->bulk, spawnCount,
+            worldState->worldWidth, worldState->worldHeight, 1.5f, spawnQueue);
+    }
+    flushSpawnQueue();
+}
+
 void World::render(Camera3D camera, float alpha, bool renderToTexture) {
     (void)alpha;
     (void)renderToTexture;
@@ -216,6 +409,25 @@ void World::render(Camera3D camera, float alpha, bool renderToTexture) {
         sdfMembraneShader = rendering::loadSDFMembraneShader();
     }
 
+    if (!swarmBillboards->isReady() && swarm->size() > 0 && IsWindowReady()) {
+        BacteriaSwarmSystem::initRenderer(*swarmBillboards, *swarm);
+    }
+
+    if (!shells->isReady() && IsWindowReady()) {
+        ShellRenderSystem::initRenderer(*shells);
+    }
+
+    if (!deferredSdf->isReady() && sdfMembraneShader.id != 0) {
+        deferredSdf->init(rendering::loadShaderFromDataPaths("fullscreen.vert", "sdf_lighting.frag"),
+                          rendering::loadShaderFromDataPaths("fullscreen.vert", "raymarch_reduce.frag"),
+                          GetRenderWidth(), GetRenderHeight());
+    }
+
+    auto drops = world.get<components::ResourceDrops>();
+    if (!dropBillboards->isReady() && drops && drops->size() > 0 && IsWindowReady()) {
+        ResourceSystem::initRenderer(*dropBillboards);
+    }
+
     // Assign shader to all microbes that don't have it yet (or have shader.id=0)
     if (sdfMembraneShader.id != 0) {
         world.each([this](flecs::entity e, components::Microbe& microbe) {
@@ -239,6 +451,25 @@ void World::render(Camera3D camera, float alpha, bool renderToTexture) {
     EndMode3D();
 }
 
+namespace {
+
+// Where the mouse ray meets the dish plane (y = 0); false if it never does
+bool projectCursor(Vector2 mouse, Camera3D camera, Vector3& out) {
+    Ray ray = GetMouseRay(mouse, camera);
+    float denom = ray.direction.y;
+    if (fabsf(denom) <= 0.0001f) {
+        return false;
+    }
+    float t = -ray.position.y / denom;
+    if (t < 0.0f) {
+        return false;
+    }
+    out = {ray.position.x + ray.direction.x * t, 0.0f, ray.position.z + ray.direction.z * t};
+    return true;
+}
+
+} // namespace
+
 void World::handleInput(Camera3D camera, float dt, int screen_w, int screen_h) {
     (void)dt;
     (void)screen_w;
@@ -248,23 +479,43 @@ void World::handleInput(Camera3D camera, float dt, int screen_w, int screen_h) {
     if (!input) {
         return;
     }
+    auto latch = world.get_mut<components::CursorLatch>();
+    if (latch) {
+        latch->inputTime = GetTime();
+    }
 
-    Vector2 mouse = GetMousePosition();
-    Ray ray = GetMouseRay(mouse, camera);
-    float denom = ray.direction.y;
-    if (fabsf(denom) > 0.0001f) {
-        float t = -ray.position.y / denom;
-        if (t >= 0.0f) {
-            input->mouseWorld = {
-                ray.position.x + ray.direction.x * t,
-                0.0f,
-                ray.position.z + ray.direction.z * t
-            };
-            input->mouseWorldValid = true;
-            return;
+    if (projectCursor(GetMousePosition(), camera, input->mouseWorld)) {
+        input->mouseWorldValid = true;
+
+        // Full path: keep where the last tick left off and drop the oldest sample after it
+        Vector2 point = {input->mouseWorld.x, input->mouseWorld.z};
+        if (input->mousePathCount == components::InputState::MaxPathPoints) {
+            for (int i = 1; i + 1 < input->mousePathCount; i++) {
+                input->mousePath[i] = input->mousePath[i + 1];
+            }
+            input->mousePathCount--;
         }
+        input->mousePath[input->mousePathCount++] = point;
+        return;
     }
     input->mouseWorldValid = false;
+    input->mousePathCount = 0;
+}
+
+double World::latchCursor(Camera3D camera) {
+    auto latch = world.get_mut<components::CursorLatch>();
+    if (!latch) {
+        return 0.0;
+    }
+    // The cursor has usually moved while the ticks ran; ask the OS where it is
+    // now (polling events here would eat this frame's click edges)
+    Vector2 mouse = GetMousePosition();
+    if (IsWindowReady()) {
+        cursor_query(GetWindowHandle(), &mouse.x, &mouse.y);
+    }
+    latch->valid = projectCursor(mouse, camera, latch->mouseWorld);
+    latch->latchTime = GetTime();
+    return latch->inputTime > 0.0 ? latch->latchTime - latch->inputTime : 0.0;
 }
 
 void World::renderUI(int screen_w, int screen_h) {
@@ -297,34 +548,37 @@ flecs::entity World::createTestSphere(Vector3 position, float radius, Color colo
 }
 
 flecs::entity World::createAmoeba(Vector3 position, float radius, Color color) {
+    return createMicrobe(components::MicrobeType::Amoeba, position, radius, color);
+}
+
+flecs::entity World::createMicrobe(components::MicrobeType type, Vector3 position, float radius, Color color) {
 
     auto entity = world.entity();
 
+    // Each microbe draws from its own stream, so spawn order alone decides its randomness
+    Rng entityRng = world.get_mut<components::RandomStreams>()->nextEntityStream();
+
     // Create microbe component with unique seed
     components::Microbe microbe;
-    microbe.type = components::MicrobeType::Amoeba;
-    microbe.stats.seed = (float)rand() / RAND_MAX;  // Unique seed for each amoeba
+    microbe.stats.seed = rng_next_f01(&entityRng);  // Unique seed for each microbe
     microbe.stats.baseRadius = radius;
     microbe.stats.color = color;
     microbe.stats.health = 100.0f;
     microbe.stats.energy = 100.0f;
 
-    // Create Jolt soft body using Puppet architecture with internal skeleton (Internal Motor model)
-    int subdivisions = 1;  // 42 vertices (balanced detail vs. performance)
+    // Soft membrane (with internal skeleton) for protists, one rigid body for bacteria and viruses
+    bool rigid = BodyPlanFactory::IsRigid(BodyPlanFactory::GetPlan(type).kind);
+    float heading = rigid ? rng_next_f01(&entityRng) * 2.0f * PI : 0.0f;
     std::vector<JPH::BodyID> skeletonBodyIDs;
-    microbe.softBody.bodyID = SoftBodyFactory::CreateAmoeba(physics, position, radius, subdivisions, skeletonBodyIDs);
-    microbe.softBody.vertexCount = SoftBodyFactory::GetVertexCount(physics, microbe.softBody.bodyID);
-    microbe.softBody.subdivisions = subdivisions;
-
-
-    // Create and set InternalSkeleton component
-    components::InternalSkeleton skeleton;
-    skeleton.skeletonBodyIDs = skeletonBodyIDs;
-    skeleton.skeletonNodeCount = (int)skeletonBodyIDs.size();
-    entity.set<components::InternalSkeleton>(skeleton);
-
-    components::ECMLocomotion locomotion;
-    ECMLocomotionSystem::initialize(locomotion, microbe.stats.seed);
+    BodyPlanFactory::CreateBody(physics, type, position, radius, heading, microbe, skeletonBodyIDs);
+
+    if (!rigid) {
+        // Create and set InternalSkeleton component
+        components::InternalSkeleton skeleton;
+        skeleton.skeletonBodyIDs = skeletonBodyIDs;
+        skeleton.skeletonNodeCount = (int)skeletonBodyIDs.size();
+        entity.set<components::InternalSkeleton>(skeleton);
+    }
 
     // Set transform to initial position
     entity.set<components::Transform>({
@@ -336,18 +590,132 @@ flecs::entity World::createAmoeba(Vector3 position, float radius, Color color) {
     // Add microbe to entity
     entity.set<components::Microbe>(microbe);
 
-    // Add EC&M locomotion component
-    entity.set<components::ECMLocomotion>(locomotion);
+    // Add EC&M locomotion component (membranes only; rigid plans have no pseudopods)
+    if (!rigid) {
+        components::ECMLocomotion locomotion;
+        ECMLocomotionSystem::initialize(locomotion, microbe.stats.seed);
+        locomotion.rng = entityRng;
+        entity.set<components::ECMLocomotion>(locomotion);
+    }
 
     // Create SDF render component (shader will be loaded lazily in render())
     components::SDFRenderComponent sdf;
     sdf.shader.id = 0; // Will be set when shader is loaded
     entity.set<components::SDFRenderComponent>(sdf);
 
+    // Capsids, frustules and spines are rasterized rather than raymarched
+    components::ShellRender shell;
+    if (ShellRenderSystem::shellFor(type, shell)) {
+        entity.set<components::ShellRender>(shell);
+    }
+
+    // Necks, stalks and flagella; membranes have no heading, so their seed picks the front
+    components::Appendages appendages;
+    float facing = rigid ? heading : microbe.stats.seed * 2.0f * PI;
+    if (AppendageSystem::attach(appendages, *rods, physics, microbe, position, facing) > 0) {
+        entity.set<components::Appendages>(appendages);
+    }
 
     return entity;
 }
 
+flecs::entity World::divideMicrobe(flecs::entity parent, float splitAngle) {
+    const components::Microbe* microbe = parent.is_alive() ? parent.get<components::Microbe>() : nullptr;
+    if (!microbe) {
+        return flecs::entity();
+    }
+
+    components::Microbe first;
+    components::Microbe second;
+    if (!BodyPlanFactory::Divide(physics, *microbe, splitAngle, first, second)) {
+        return flecs::entity();
+    }
+
+    // Pseudopods stay anchored at the same spot of the smaller membrane
+    const float scale = first.stats.baseRadius / microbe->stats.baseRadius;
+    components::ECMLocomotion locomotion;
+    if (const components::ECMLocomotion* inherited = parent.get<components::ECMLocomotion>()) {
+        locomotion = *inherited;
+    } else {
+        ECMLocomotionSystem::initialize(locomotion, first.stats.seed);
+    }
+    for (auto& pod : locomotion.pods) {
+        pod.anchorLocal = {pod.anchorLocal.x * scale, pod.anchorLocal.y * scale, pod.anchorLocal.z * scale};
+    }
+
+    Vector3 centers[2];
+    for (int i = 0; i < 2; i++) {
+        JPH::BodyID id = i == 0 ? first.softBody.bodyID : second.softBody.bodyID;
+        JPH::RVec3 com = physics->physicsSystem->GetBodyInterface().GetCenterOfMassPosition(id);
+        centers[i] = {(float)com.GetX(), (float)com.GetY(), (float)com.GetZ()};
+    }
+    components::Transform transform = {
+        .position = centers[0],
+        .rotation = {0.0f, 0.0f, 0.0f, 1.0f},
+        .scale = {1.0f, 1.0f, 1.0f}
+    };
+
+    // The parent becomes the first daughter (set<> does not fire OnRemove, and
+    // Divide already returned the parent's body to the pool)
+    parent.set<components::Microbe>(first);
+    parent.set<components::Transform>(transform);
+    parent.set<components::ECMLocomotion>(locomotion);
+
+    // The second daughter gets its own random stream
+    locomotion.rng = world.get_mut<components::RandomStreams>()->nextEntityStream();
+    transform.position = centers[1];
+
+    auto daughter = world.entity();
+    components::InternalSkeleton skeleton;
+    skeleton.skeletonNodeCount = 0;
+    daughter.set<components::InternalSkeleton>(skeleton);
+    daughter.set<components::Transform>(transform);
+    daughter.set<components::Microbe>(second);
+    daughter.set<components::ECMLocomotion>(locomotion);
+
+    components::SDFRenderComponent sdf;
+    sdf.shader.id = 0; // Will be set when shader is loaded
+    daughter.set<components::SDFRenderComponent>(sdf);
+
+    if (parent.has<components::Adhesive>()) {
+        daughter.add<components::Adhesive>();
+    }
+    components::Appendages appendages;
+    if (AppendageSystem::attach(appendages, *rods, physics, second, centers[1], second.stats.seed * 2.0f * PI) > 0) {
+        daughter.set<components::Appendages>(appendages);
+    }
+
+    return daughter;
+}
+
+void World::createStarterMicrobes(float worldWidth, float worldHeight) {
+    // Create amoebas inside boundaries with EC&M locomotion
+    float spawnOffsetX = worldWidth * 0.25f;
+    float spawnOffsetZ = worldHeight * 0.25f;
+    createAmoeba({-spawnOffsetX, 1.5f, -spawnOffsetZ}, 0.28f, (Color){120, 200, 170, 255});
+    createAmoeba({spawnOffsetX, 1.5f, spawnOffsetZ}, 0.24f, (Color){90, 180, 140, 255});
+}
+
+int World::spawnPopulation(components::MicrobeType type, int count) {
+    if (count <= 0) {
+        return 0;
+    }
+
+    float sizeScale = BodyPlanFactory::GetPlan(type).sizeScale;
+    auto worldState = world.get<components::WorldState>();
+    auto streams = world.get_mut<components::RandomStreams>();
+    float worldWidth = worldState ? worldState->worldWidth : 50.0f;
+    float worldHeight = worldState ? worldState->worldHeight : 50.0f;
+    for (int i = 0; i < count; i++) {
+        SpawnRequest request = SpawnSystem::generateSpawnRequest(&streams->spawn, worldWidth, worldHeight, 1.5f);
+        request.radius *= sizeScale;
+        request.type = type;
+        spawnQueue.push_back(request);
+    }
+    flushSpawnQueue();
+    return count;
+}
+
 void World::createScreenBoundaries(float worldWidth, float worldHeight) {
 
     // Update world state singleton
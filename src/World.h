@@ -2,39 +2,107 @@
 #define MICRO_IDLE_WORLD_H
 
 #include <flecs.h>
+#include <cstdint>
 #include <vector>
 #include "raylib.h"
 #include "SpawnRequest.h"
+#include "rendering/DeferredSDF.h"
 
 namespace micro_idle {
 
 // Forward declarations
 struct PhysicsSystemState;
 struct WorldBoundaries;
+class BacteriaSwarm;
+class RodSolver;
+class MembraneContacts;
+class AdhesionGraph;
+
+namespace rendering {
+class InstancedBillboards;
+class InstancedShells;
+}
 
 } // namespace micro_idle
 
 namespace components {
     struct Microbe; // Forward declaration
+    enum class MicrobeType;
 }
 
 namespace micro_idle {
 
 class World {
 public:
-    World();
+    static constexpr uint64_t DefaultSeed = 0xC0FFEEu;
+
+    // All simulation randomness is derived from this seed
+    explicit World(uint64_t seed = DefaultSeed);
     ~World();
 
     // Core update methods
     void update(float dt);
     void render(Camera3D camera, float alpha, bool renderToTexture = false);
     void handleInput(Camera3D camera, float dt, int screen_w, int screen_h);
+
+    // Resample the cursor right before render submission (CursorLatch), so the
+    // hover reticle and highlights follow the latest position. Returns how much
+    // newer this sample is than the one the ticks used, in seconds.
+    double latchCursor(Camera3D camera);
     void renderUI(int screen_w, int screen_h);
 
+    // Background mode: coarse locomotion and no SDF vertex extraction
+    void setReducedFidelity(bool reduced);
+    bool isReducedFidelity() const;
+
+    // Statistically advance the world by a block of time without stepping physics
+    // (used after the window has been hidden for a long time)
+    void fastForward(float seconds);
+
     // Entity creation helpers
     flecs::entity createTestSphere(Vector3 position, float radius, Color color, bool withPhysics = false, bool isStatic = false);
     flecs::entity createAmoeba(Vector3 position, float radius, Color color);
 
+    // Any microbe type, with the body plan BodyPlanFactory assigns to it
+    // (soft membrane + EC&M locomotion for protists, a rigid body otherwise)
+    flecs::entity createMicrobe(components::MicrobeType type, Vector3 position, float radius, Color color);
+
+    /**
+     * Divide a soft microbe in two (see BodyPlanFactory::Divide). The parent entity
+     * becomes one daughter and a new entity the other; both inherit the parent's
+     * shape, pseudopods and cortex state at half the volume.
+     *
+     * @param splitAngle Yaw of the axis the daughters separate along (radians)
+     * @return The new daughter, or an invalid entity if the microbe cannot divide
+     */
+    flecs::entity divideMicrobe(flecs::entity parent, float splitAngle);
+
+    // Opening layout of a new game: two amoebas in opposite quadrants
+    void createStarterMicrobes(float worldWidth, float worldHeight);
+
+    // Spawn `count` microbes of a type at random positions from the spawn stream,
+    // sized by the type's body plan. Returns how many were created.
+    int spawnPopulation(components::MicrobeType type, int count);
+
+    // Ambient bacteria swarm size (0 disables it); agents are scattered over the dish
+    void setAmbientBacteria(int count);
+    int getAmbientBacteriaCount() const;
+    const BacteriaSwarm& getSwarm() const { return *swarm; }
+
+    // Appendage rods of every microbe (see AppendageSystem)
+    const RodSolver& getRods() const { return *rods; }
+
+    // Soft-soft membrane contacts (see MembraneContactSystem); layer pairs and
+    // tuning can be changed between updates
+    MembraneContacts& getMembraneContacts() { return *membraneContacts; }
+
+    // Bonds between touching Adhesive microbes (pili, biofilm clumps)
+    AdhesionGraph& getAdhesion() { return *adhesion; }
+
+    // Raymarch totals of a recent frame; only valid while the RaymarchDebug
+    // singleton has collectStats set and the G-buffer exists
+    const rendering::RaymarchStats& getRaymarchStats() const { return deferredSdf->getStats(); }
+
     // Screen boundary management
     void createScreenBoundaries(float worldWidth, float worldHeight);
     void updateScreenBoundaries(float worldWidth, float worldHeight);
@@ -54,10 +122,23 @@ private:
     Shader sdfMembraneShader;  // SDF raymarching shader for microbe membranes
     WorldBoundaries* boundaries;   // Screen boundaries (opaque)
     RenderTexture renderTexture;   // For render-to-texture testing
+    BacteriaSwarm* swarm;          // Ambient agent tier, outside the ECS
+    RodSolver* rods;               // Appendage rods (necks, stalks, flagella)
+    MembraneContacts* membraneContacts;   // Soft-soft contact stage after the Jolt step
+    AdhesionGraph* adhesion;              // Pooled adhesive bonds, solved in the same stage
+    rendering::InstancedBillboards* swarmBillboards;  // Created lazily in render()
+    rendering::InstancedShells* shells;               // Rigid shell meshes, created lazily in render()
+    rendering::InstancedBillboards* dropBillboards;   // Resource drops, created lazily in render()
+    rendering::DeferredSDF* deferredSdf;              // Membrane G-buffer, created lazily in render()
     flecs::entity onUpdatePipeline{};
     flecs::entity onStorePipeline{};
     flecs::entity postUpdatePipeline{};
 
+    // Cap on microbes materialised by a single fast-forward
+    static constexpr int MaxFastForwardSpawns = 64;
+
+    void flushSpawnQueue();
+
     // System registration
     void registerComponents();
     void registerSystems();
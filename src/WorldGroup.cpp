@@ -0,0 +1,178 @@
+#include "WorldGroup.h"
+#include "World.h"
+#include "components/Input.h"
+#include "physics/PhysicsRuntime.h"
+#include <algorithm>
+#include <chrono>
+
+namespace micro_idle {
+
+WorldGroup::WorldGroup(int helperThreads) {
+    maxHelpers = helperThreads >= 0
+        ? helperThreads
+        : std::max(0, (int)std::thread::hardware_concurrency() - 1);
+    // The shared job pool is sized for this many worlds stepping at once
+    maxHelpers = std::min(maxHelpers, PhysicsRuntime::MaxConcurrentWorlds - 1);
+}
+
+WorldGroup::~WorldGroup() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& thread : helpers) {
+        thread.join();
+    }
+}
+
+int WorldGroup::addWorld(uint64_t seed, int tickHz) {
+    auto entry = std::make_unique<Entry>();
+    entry->world = std::make_unique<World>(seed);
+    time_init(&entry->time, tickHz);
+    entries.push_back(std::move(entry));
+
+    int index = (int)entries.size() - 1;
+    applyFocus(index);
+    return index;
+}
+
+World& WorldGroup::getWorld(int index) {
+    return *entries[(size_t)index]->world;
+}
+
+void WorldGroup::setTickHz(int index, int tickHz) {
+    time_set_tick_hz(&entries[(size_t)index]->time, tickHz);
+}
+
+void WorldGroup::setFocused(int index) {
+    focused = (index >= 0 && index < getWorldCount()) ? index : -1;
+    for (int i = 0; i < getWorldCount(); i++) {
+        applyFocus(i);
+    }
+}
+
+void WorldGroup::applyFocus(int index) {
+    auto input = getWorld(index).getWorld().get_mut<components::InputState>();
+    if (!input) {
+        return;
+    }
+    if (index == focused) {
+        input->injected = false;
+    } else {
+        // Background dishes must not poll raylib from helper threads
+        *input = components::InputState{};
+        input->injected = true;
+    }
+}
+
+const TimeState& WorldGroup::getTime(int index) const {
+    return entries[(size_t)index]->time;
+}
+
+float WorldGroup::getAlpha(int index) const {
+    return time_alpha(&entries[(size_t)index]->time);
+}
+
+double WorldGroup::getLastStepMs(int index) const {
+    return entries[(size_t)index]->lastStepMs;
+}
+
+int WorldGroup::update(double realDt) {
+    int most = 0;
+    for (auto& entry : entries) {
+        entry->pendingTicks = time_update(&entry->time, realDt);
+        most = std::max(most, entry->pendingTicks);
+    }
+    runPendingTicks();
+    return most;
+}
+
+void WorldGroup::stepTicks(int ticks) {
+    for (auto& entry : entries) {
+        entry->pendingTicks = std::max(ticks, 0);
+        entry->time.tick += (uint64_t)entry->pendingTicks;
+    }
+    runPendingTicks();
+}
+
+void WorldGroup::stepEntry(Entry& entry) {
+    auto start = std::chrono::steady_clock::now();
+    float dt = (float)entry.time.tick_dt;
+    for (int i = 0; i < entry.pendingTicks; i++) {
+        entry.world->update(dt);
+    }
+    entry.pendingTicks = 0;
+    auto end = std::chrono::steady_clock::now();
+    entry.lastStepMs = std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void WorldGroup::runTasks() {
+    int count = getWorldCount();
+    for (;;) {
+        int index = nextTask.fetch_add(1);
+        if (index >= count) {
+            return;
+        }
+        if (index != focused) {
+            stepEntry(*entries[(size_t)index]);
+        }
+    }
+}
+
+void WorldGroup::ensureHelpers() {
+    int wanted = std::min(maxHelpers, getWorldCount() - 1);
+    while ((int)helpers.size() < wanted) {
+        // Only this thread bumps the generation, so the current value is safe to hand over
+        uint64_t current = generation;
+        helpers.emplace_back([this, current]() { helperLoop(current); });
+    }
+}
+
+void WorldGroup::helperLoop(uint64_t seen) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busyHelpers--;
+        }
+        done.notify_one();
+    }
+}
+
+void WorldGroup::runPendingTicks() {
+    ensureHelpers();
+    nextTask.store(0);
+
+    if (!helpers.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            generation++;
+            busyHelpers = (int)helpers.size();
+        }
+        wake.notify_all();
+    }
+
+    // The focused world may poll raylib, so it stays on this thread
+    if (focused >= 0) {
+        stepEntry(*entries[(size_t)focused]);
+    }
+    runTasks();
+
+    if (!helpers.empty()) {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&]() { return busyHelpers == 0; });
+    }
+}
+
+} // namespace micro_idle
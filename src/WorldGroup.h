@@ -0,0 +1,95 @@
+#ifndef MICRO_IDLE_WORLD_GROUP_H
+#define MICRO_IDLE_WORLD_GROUP_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "engine/platform/time.h"
+
+namespace micro_idle {
+
+class World;
+
+/**
+ * Several independent worlds (petri dishes, prestige layers) stepped side by side
+ *
+ * Each world keeps its own fixed-tick clock, so dishes can tick at different
+ * rates. update() runs every world's pending ticks in parallel on a few helper
+ * threads; inside a tick each world still spreads physics over the shared
+ * PhysicsRuntime job pool.
+ *
+ * Only the focused world reads live raylib input, and it always steps on the
+ * calling thread. Every other world sees an empty, injected InputState.
+ */
+class WorldGroup {
+public:
+    // helperThreads: extra threads stepping worlds (-1 = hardware_concurrency - 1),
+    // never more than worlds - 1 or PhysicsRuntime::MaxConcurrentWorlds - 1
+    explicit WorldGroup(int helperThreads = -1);
+    ~WorldGroup();
+
+    WorldGroup(const WorldGroup&) = delete;
+    WorldGroup& operator=(const WorldGroup&) = delete;
+
+    // Create a world owned by the group; returns its index
+    int addWorld(uint64_t seed, int tickHz = 60);
+
+    World& getWorld(int index);
+    int getWorldCount() const { return (int)entries.size(); }
+
+    void setTickHz(int index, int tickHz);
+
+    // -1 = no world takes live input
+    void setFocused(int index);
+    int getFocused() const { return focused; }
+
+    // Feed realDt seconds of wall time to every world's clock and run the
+    // resulting fixed ticks. Returns the most ticks any single world ran.
+    int update(double realDt);
+
+    // Run exactly `ticks` fixed ticks on every world (headless runs, tests)
+    void stepTicks(int ticks);
+
+    const TimeState& getTime(int index) const;
+    float getAlpha(int index) const;
+
+    // Wall time the world's ticks took during the last update()/stepTicks()
+    double getLastStepMs(int index) const;
+
+private:
+    struct Entry {
+        std::unique_ptr<World> world;
+        TimeState time;
+        int pendingTicks{0};
+        double lastStepMs{0.0};
+    };
+
+    std::vector<std::unique_ptr<Entry>> entries;
+    int focused{-1};
+
+    // Helper threads wait for a new generation, then pull world indices from nextTask
+    int maxHelpers;
+    std::vector<std::thread> helpers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    uint64_t generation{0};
+    int busyHelpers{0};
+    bool stopping{false};
+    std::atomic<int> nextTask{0};
+
+    void applyFocus(int index);
+    void ensureHelpers();
+    void helperLoop(uint64_t seen);
+    void runTasks();
+    void stepEntry(Entry& entry);
+    void runPendingTicks();
+};
+
+} // namespace micro_idle
+
+#endif
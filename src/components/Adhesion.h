@@ -0,0 +1,13 @@
+#ifndef MICRO_IDLE_ADHESION_H
+#define MICRO_IDLE_ADHESION_H
+
+namespace components {
+
+// Tag for microbes with pili or a biofilm matrix (README: Pili, Biofilms).
+// Adhesive membranes bond where they touch another adhesive membrane, so
+// neighbours clump into networks (see AdhesionGraph).
+struct Adhesive {};
+
+} // namespace components
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef MICRO_IDLE_APPENDAGE_H
+#define MICRO_IDLE_APPENDAGE_H
+
+namespace components {
+
+// Long, thin appendages (neck, stalk, flagella) simulated as rods in the
+// world's RodSolver. Each rod's base is pinned to one of the microbe's SDF
+// sample points and re-anchored by AppendageSystem every tick.
+struct Appendages {
+    static constexpr int Max = 4;
+
+    int rods[Max]{};            // RodSolver handles
+    int anchors[Max]{};         // Index into the microbe's sample points
+    float thickness[Max]{};     // Draw width in world units
+    int count{0};
+};
+
+} // namespace components
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef MICRO_IDLE_CHAIN_REACTION_H
+#define MICRO_IDLE_CHAIN_REACTION_H
+
+#include <flecs.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace components {
+
+// One pending step of a chain reaction. A blast makes `entity` take `damage`
+// when `due` comes; if that kills it, it detonates and the wave jumps on to its
+// neighbours, who take `spread`.
+struct ChainHop {
+    flecs::entity_t entity;
+    float x, z;             // Where the hop lands (the microbe's position when it was reached)
+    float damage;           // 0 for the microbe that set the wave off
+    float spread;
+    double due;             // ChainReactions::clock time
+    uint32_t wave;
+    int hopsLeft;           // Further jumps the wave can make from here
+};
+
+// A hop that fired recently, for the expanding-ring visuals
+struct ChainFlash {
+    float x, z;
+    float age;
+};
+
+// Bookkeeping for one live wave; dropped as soon as it has nothing left in flight
+struct ChainWave {
+    std::unordered_set<flecs::entity_t> reached;
+    int live{0};            // Blasts queued or armed plus detonations waiting
+};
+
+// Chain reactions singleton (README: Capsule -> Sodium "chain-reaction
+// mechanics"). Waves spread breadth-first through the MicrobeIndex as chain
+// detonations: a microbe that dies detonates, blasting its nearest neighbours
+// hopDelay later, and only the blasts that kill carry the wave further.
+// ChainReactionSystem fires at most hopsPerTick hops a tick, so a huge cascade
+// plays out over several frames at a capped cost instead of in one spike. A
+// microbe is blasted at most once per wave.
+struct ChainReactions {
+    std::vector<ChainHop> queue;        // Blasts, FIFO from `head`; due times never decrease
+    size_t head{0};
+    std::vector<ChainHop> detonations;  // Kills waiting to pass their wave on; fire first
+    std::unordered_map<flecs::entity_t, ChainHop> armed;   // Blasts fired this tick, until the damage is applied
+    std::unordered_map<uint32_t, ChainWave> waves;
+    std::vector<ChainFlash> flashes;
+    uint32_t nextWave{1};
+    double clock{0.0};
+
+    float hopDelay{0.08f};          // Seconds between a detonation and its blasts landing
+    float hopRadius{0.6f};          // Reach past a neighbour's footprint
+    float falloff{0.8f};            // Share of the damage passed on at each jump
+    int maxFanout{4};               // Nearest neighbours each detonation blasts
+    int hopsPerTick{256};           // Budget; the rest wait for the next tick
+    int maxQueued{8192};            // New hops are dropped past this
+
+    int pending() const { return (int)(queue.size() - head + detonations.size() + armed.size()); }
+};
+
+} // namespace components
+
+#endif
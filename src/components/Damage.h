@@ -0,0 +1,43 @@
+#ifndef MICRO_IDLE_DAMAGE_H
+#define MICRO_IDLE_DAMAGE_H
+
+#include <flecs.h>
+#include <cstdint>
+#include <vector>
+
+namespace components {
+
+// What dealt a hit (README: hovering, clicking, automated effects)
+enum class DamageSource : uint8_t {
+    Hover,
+    Click,
+    Effect
+};
+
+// Damage buffer singleton - every hit dealt this tick as (entity, amount, source),
+// in SoA form. Anything that deals damage appends here instead of touching
+// health; DestructionSystem applies the whole buffer in one pass, then handles
+// the deaths (drops, entity and body teardown) as one batch.
+struct DamageBuffer {
+    std::vector<flecs::entity_t> entities;
+    std::vector<float> amounts;
+    std::vector<uint8_t> sources;       // DamageSource
+
+    void add(flecs::entity_t entity, float amount, DamageSource source) {
+        entities.push_back(entity);
+        amounts.push_back(amount);
+        sources.push_back((uint8_t)source);
+    }
+
+    void clear() {
+        entities.clear();
+        amounts.clear();
+        sources.clear();
+    }
+
+    int size() const { return (int)entities.size(); }
+};
+
+} // namespace components
+
+#endif
@@ -2,6 +2,7 @@
 #define MICRO_IDLE_ECMLocomotion_H
 
 #include "raylib.h"
+#include "engine/util/rng.h"
 
 namespace components {
 
@@ -29,6 +30,7 @@ struct ECMLocomotion {
     int zigzagSign{1};                  // Alternates left/right bias
     int orbitSign{1};                   // Orbit direction around cursor
     Vector3 targetDirection{0.0f, 0.0f, 1.0f}; // Current pseudopod direction
+    Rng rng{0x9E3779B97F4A7C15ull};     // Per-entity stream for pod timing and selection
 };
 
 } // namespace components
@@ -11,11 +11,31 @@ struct InputState {
     Vector2 mouseDelta{0.0f, 0.0f};
     Vector3 mouseWorld{0.0f, 0.0f, 0.0f};
     bool mouseWorldValid{false};
+
+    // Ground points (x, z) the cursor passed through since the last tick, oldest
+    // first: the first is where the last tick left off, the last is mouseWorld.
+    // Sampled every frame by World::handleInput, so a fast swipe is a chain of
+    // segments rather than two far-apart points; DestructionSystem sweeps it
+    // and restarts it from the last point.
+    static constexpr int MaxPathPoints = 16;
+    Vector2 mousePath[MaxPathPoints]{};
+    int mousePathCount{0};
     bool mouseLeftDown{false};      // Mouse button is currently held down
     bool mouseLeftPressed{false};   // Mouse button was just pressed this frame
     bool mouseRightDown{false};
     bool mouseRightPressed{false};
     float mouseWheel{0.0f};
+    bool injected{false};           // Driven by replay: InputSystem leaves the fields alone
+};
+
+// Cursor sample for rendering, taken right before the frame is submitted
+// (World::latchCursor), i.e. after the fixed ticks that consumed InputState.
+// Only render systems read it, so a late sample never changes the simulation.
+struct CursorLatch {
+    Vector3 mouseWorld{0.0f, 0.0f, 0.0f};
+    bool valid{false};
+    double inputTime{0.0};      // When World::handleInput last sampled InputState
+    double latchTime{0.0};      // When this sample was taken
 };
 
 } // namespace components
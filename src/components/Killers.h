@@ -0,0 +1,25 @@
+#ifndef MICRO_IDLE_KILLERS_H
+#define MICRO_IDLE_KILLERS_H
+
+#include <flecs.h>
+#include <vector>
+#include "src/physics/TargetIndex.h"
+
+namespace components {
+
+// Killer agents singleton - the autonomous killers of the idle automation
+// (README: "Idle / Automation") in SoA form. Every tick KillerSystem rebuilds
+// `targets` from the MicrobeIndex, gives each agent a microbe no other agent
+// has claimed, and steps them all towards their targets.
+struct KillerAgents {
+    std::vector<float> x, z;
+    std::vector<flecs::entity_t> target;    // Microbe being chased (0 = none)
+    micro_idle::TargetIndex targets;        // Rebuilt each tick; slots are MicrobeIndex slots
+    std::vector<int> assigned;              // Scratch: TargetIndex slot per agent (-1 = none)
+
+    int size() const { return (int)x.size(); }
+};
+
+} // namespace components
+
+#endif
@@ -4,6 +4,7 @@
 #include "raylib.h"
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/Body/BodyID.h>
+#include <cstdint>
 #include <vector>
 
 namespace components {
@@ -31,6 +32,18 @@ enum class MicrobeType {
     Bacteriophage
 };
 
+constexpr int MicrobeTypeCount = (int)MicrobeType::Bacteriophage + 1;
+
+// How a microbe's body is simulated (see BodyPlanFactory). Protists get a soft
+// membrane; bacteria and viruses get a single cheap rigid body.
+enum class BodyPlanKind : uint8_t {
+    SoftMembrane,           // Jolt soft body, vertices drive the SDF
+    RigidSphere,            // Coccus
+    RigidCapsule,           // Bacillus
+    RigidCurvedCompound,    // Vibrio, Spirillum: capsules along a bent spine
+    RigidConvexCapsid       // Icosahedral head, optional phage tail
+};
+
 // Microbe statistics and properties
 struct MicrobeStats {
     float seed;                 // Procedural variation seed
@@ -41,6 +54,8 @@ struct MicrobeStats {
 };
 
 // Soft body structure - single Jolt soft body (Puppet architecture)
+// Rigid plans reuse it: bodyID is the rigid body and vertexCount the number of
+// SDF sample points the plan emits.
 struct SoftBody {
     JPH::BodyID bodyID;         // Single Jolt soft body
     int vertexCount;            // Number of vertices in soft body
@@ -59,6 +74,7 @@ struct Microbe {
     MicrobeType type;
     MicrobeStats stats;
     SoftBody softBody;          // Jolt soft body (physics simulation)
+    BodyPlanKind plan{BodyPlanKind::SoftMembrane};
 };
 
 } // namespace components
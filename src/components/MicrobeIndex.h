@@ -0,0 +1,26 @@
+#ifndef MICRO_IDLE_MICROBE_INDEX_H
+#define MICRO_IDLE_MICROBE_INDEX_H
+
+#include <flecs.h>
+#include <vector>
+#include "src/physics/SpatialGrid.h"
+
+namespace components {
+
+// Microbe index singleton - flat snapshot of every microbe's footprint on the dish,
+// rebuilt by MicrobeIndexSystem once per tick (OnStore, after TransformSync).
+// Lets bulk systems (ambient swarm, area queries) find nearby microbes without
+// iterating the ECS.
+struct MicrobeIndex {
+    std::vector<flecs::entity_t> entities;
+    std::vector<float> x;
+    std::vector<float> z;
+    std::vector<float> radius;       // Footprint radius including deformation slack
+    micro_idle::SpatialGrid grid;    // Circles, so a point query reads one cell
+
+    int size() const { return (int)entities.size(); }
+};
+
+} // namespace components
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef MICRO_IDLE_RANDOM_STREAMS_H
+#define MICRO_IDLE_RANDOM_STREAMS_H
+
+#include <cstdint>
+#include "engine/util/rng.h"
+
+namespace components {
+
+// Stream ids for rng_seed_stream(); entity streams are offset so they never
+// collide with system streams
+enum RandomStreamId : uint64_t {
+    RandomStreamSpawn = 1,
+    RandomStreamDestruction = 2,
+    RandomStreamBulk = 3,
+    RandomStreamSwarmSpawn = 4,
+    RandomStreamSwarmChunkBase = 1ull << 24,  // + chunk index, one per swarm chunk
+    RandomStreamEntityBase = 1ull << 32
+};
+
+// Random streams singleton - every random draw in the simulation comes from
+// here or from a per-entity stream handed out by nextEntityStream()
+struct RandomStreams {
+    uint64_t seed{0};
+    uint64_t entityCounter{0};   // Entity streams issued so far (creation order)
+    Rng spawn{};
+    Rng destruction{};
+    Rng8 bulk{};                 // Batch fills: spawn parameters, fast-forward
+
+    void reseed(uint64_t newSeed) {
+        seed = newSeed;
+        entityCounter = 0;
+        rng_seed_stream(&spawn, seed, RandomStreamSpawn);
+        rng_seed_stream(&destruction, seed, RandomStreamDestruction);
+        rng8_seed(&bulk, seed, RandomStreamBulk);
+    }
+
+    // Independent stream for the next created entity
+    Rng nextEntityStream() {
+        Rng rng;
+        rng_seed_stream(&rng, seed, RandomStreamEntityBase + entityCounter++);
+        return rng;
+    }
+};
+
+} // namespace components
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef MICRO_IDLE_RENDER_PACKET_H
+#define MICRO_IDLE_RENDER_PACKET_H
+
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+
+namespace components {
+
+// One microbe as the renderer and external tools see it: flat and pointer-free,
+// so the array can be handed out without copying (GameRenderPacket mirrors it)
+struct RenderPacket {
+    uint64_t entity{0};
+    Vector3 position{0.0f, 0.0f, 0.0f};
+    float radius{0.0f};                         // Base radius
+    Quaternion rotation{0.0f, 0.0f, 0.0f, 1.0f};
+    Color color{WHITE};
+    int32_t type{0};                            // MicrobeType
+    int32_t plan{0};                            // BodyPlanKind
+    int32_t vertexCount{0};                     // SDF sample points (0 until extracted)
+};
+
+// Render packet singleton - every microbe's packet, rebuilt by RenderPacketSystem
+// once per tick (OnStore, after the SDF sample points are extracted)
+struct RenderPackets {
+    std::vector<RenderPacket> packets;
+
+    int size() const { return (int)packets.size(); }
+};
+
+} // namespace components
+
+#endif
@@ -2,6 +2,7 @@
 #define MICRO_IDLE_RENDERING_H
 
 #include "raylib.h"
+#include <cstdint>
 
 namespace components {
 
@@ -19,6 +20,33 @@ struct SDFRenderComponent {
     Shader shader{0};                    // SDF shader (lazy loaded)
     Vector3 vertexPositions[64];         // Cached vertex positions (updated each frame)
     int vertexCount{0};                   // Number of vertices
+    // Reduced in the same pass as vertexPositions (valid while vertexCount > 0)
+    Vector3 boundsMin{0.0f, 0.0f, 0.0f};
+    Vector3 boundsMax{0.0f, 0.0f, 0.0f};
+    Vector3 centroid{0.0f, 0.0f, 0.0f};
+    float extent{0.0f};                   // Farthest point from the body origin
+};
+
+// Rigid shell parts rasterized by ShellRenderSystem instead of raymarched
+enum class ShellKind : uint8_t {
+    Capsid,         // Icosahedral head
+    Phage,          // Capsid plus tail
+    Frustule,       // Diatom silica pillbox
+    Spines          // Radiolarian spines / heliozoan axopodia
+};
+
+// Instanced mesh shell. Shells that enclose the whole microbe replace its SDF
+// membrane; spines pierce it and meet it through the shared depth buffer.
+struct ShellRender {
+    ShellKind kind{ShellKind::Capsid};
+    bool replacesMembrane{false};
+};
+
+// Raymarch debugging singleton - read by the SDF render passes each frame
+struct RaymarchDebug {
+    bool heatmap{false};        // Show per-pixel step counts instead of the shaded membranes
+    bool relaxedTracing{false}; // Over-relaxed sphere tracing instead of the safe half-distance step
+    bool collectStats{false};   // Sum steps and SDF evaluations for World::getRaymarchStats()
 };
 
 // Camera singleton - stores current camera state for rendering systems
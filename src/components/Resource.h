@@ -2,6 +2,8 @@
 #define MICRO_IDLE_RESOURCE_H
 
 #include "raylib.h"
+#include <cstdint>
+#include <vector>
 
 namespace components {
 
@@ -17,14 +19,23 @@ enum class ResourceType {
     SignalingMolecules   // Unlocked by Quorum Sensing trait
 };
 
-// Resource component - represents a resource drop in the world
-struct Resource {
-    ResourceType type;
-    float amount;        // Amount of resource (can be fractional)
-    float lifetime;      // Time remaining before despawn (seconds)
-    float maxLifetime;   // Maximum lifetime (for visual feedback)
-    Color color;         // Visual color for the resource
-    bool isCollected;    // Whether resource has been collected
+constexpr int ResourceTypeCount = (int)ResourceType::SignalingMolecules + 1;
+
+// Resource drops singleton - every drop on the dish floor in SoA form (one
+// array per field, padded to a multiple of 8), so ResourceSystem ages, pulls
+// and collects them in one vectorized pass and the renderer uploads each array
+// with a single memcpy. Padding lanes are parked far away with no lifetime.
+struct ResourceDrops {
+    static constexpr float Lifetime = 10.0f;   // Seconds before a drop despawns
+
+    std::vector<float> x, z;
+    std::vector<float> vx, vz;      // Pull towards the cursor
+    std::vector<float> life;        // Seconds remaining
+    std::vector<float> amount;
+    std::vector<uint8_t> type;      // ResourceType
+    int count{0};
+
+    int size() const { return count; }
 };
 
 // Resource inventory - singleton component tracking player's resources
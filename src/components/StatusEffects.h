@@ -0,0 +1,69 @@
+#ifndef MICRO_IDLE_STATUS_EFFECTS_H
+#define MICRO_IDLE_STATUS_EFFECTS_H
+
+#include <flecs.h>
+#include <cstdint>
+#include <vector>
+
+namespace components {
+
+// Timed effect kinds, one bucket each. Cooldowns are effects too: the owner is
+// the entity (0 for the player) and the tag is the ability.
+enum class EffectType : uint8_t {
+    DamageOverTime,     // Magnitude: damage per second (contact toxins, burns)
+    Slow,               // Magnitude: fraction of speed removed
+    Armor,              // Magnitude: fraction of damage blocked (armor phases)
+    Stun,               // Magnitude unused
+    Cooldown            // Magnitude unused; ready again once it expires
+};
+
+constexpr int EffectTypeCount = (int)EffectType::Cooldown + 1;
+
+// One bucket of live effects in SoA form, sorted by (entity, tag) and padded to
+// a multiple of 8. Padding lanes have no time remaining.
+struct EffectBucket {
+    std::vector<flecs::entity_t> entities;
+    std::vector<uint32_t> tags;         // Source or ability; one effect per (entity, tag)
+    std::vector<float> remaining;       // Seconds left
+    std::vector<float> magnitude;
+    int count{0};
+
+    int size() const { return count; }
+};
+
+// An effect that ran out during the last tick
+struct EffectExpiry {
+    flecs::entity_t entity;
+    uint32_t tag;
+    EffectType type;
+};
+
+// Status effects singleton - every timed effect on every entity, bucketed by
+// type. Systems call apply(); StatusEffectSystem merges the requests at the
+// start of its tick (re-applying an (entity, tag) refreshes it, taking the
+// longer duration and the stronger magnitude), counts every bucket down in one
+// vectorized pass, queues damage-over-time into the DamageBuffer summed per
+// entity, and lists what ran out in `expired`.
+struct StatusEffects {
+    struct Request {
+        flecs::entity_t entity;
+        uint32_t tag;
+        EffectType type;
+        float duration;
+        float magnitude;
+    };
+
+    EffectBucket buckets[EffectTypeCount];
+    std::vector<Request> pending;
+    std::vector<EffectExpiry> expired;  // Last tick's expirations
+
+    void apply(flecs::entity_t entity, EffectType type, float duration, float magnitude, uint32_t tag = 0) {
+        pending.push_back({entity, tag, type, duration, magnitude});
+    }
+
+    const EffectBucket& bucket(EffectType type) const { return buckets[(int)type]; }
+};
+
+} // namespace components
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef MICRO_IDLE_UPGRADES_H
+#define MICRO_IDLE_UPGRADES_H
+
+namespace components {
+
+// Player upgrades singleton - nutrient upgrade levels bought with resources
+// (README: "Nutrient Upgrades"). Systems read the level and derive their own
+// tuning from it.
+struct PlayerUpgrades {
+    int pickupAttraction{0};    // Lipids: drops drift towards the cursor (0 = not bought)
+    int hoverRadius{0};         // Widens the cursor's hover-damage disc
+    int killers{0};             // Autonomous killer agents on the dish
+    int chainReaction{0};       // Sodium: click kills set off chain reactions, deeper per level
+};
+
+} // namespace components
+
+#endif
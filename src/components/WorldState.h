@@ -10,6 +10,9 @@ struct WorldState {
     int screenWidth{1280};      // Current screen width
     int screenHeight{720};      // Current screen height
     bool spawnEnabled{true};    // Allow SpawnSystem to create new microbes
+    bool reducedFidelity{false}; // Background mode: coarse locomotion, no SDF extraction
+    float spawnRate{1.0f};      // Microbes per second produced by SpawnSystem
+    float spawnAccumulator{0.0f}; // Time accumulated towards the next spawn
 };
 
 } // namespace components
@@ -0,0 +1,147 @@
+#include "BatchKernels.h"
+#include <cmath>
+
+namespace math {
+
+namespace {
+
+// Shared gather loop: lane i of each batch reads src element indexOf(first + i).
+// Lanes past the end of a partial batch repeat the batch's first element; each
+// transformed batch is handed to reduce(points, laneCount) before it is stored.
+template <typename IndexFn, typename ReduceFn>
+void transform_batches(const RigidTransformA& xf, ConstStrided3 src, Strided3 out,
+                       size_t count, float scale, IndexFn indexOf, ReduceFn reduce) {
+    Vec3x8 translation = Vec3x8::broadcast(xf.translation);
+    for (size_t first = 0; first < count; first += Float8::Width) {
+        size_t n = count - first < (size_t)Float8::Width ? count - first : (size_t)Float8::Width;
+        alignas(32) float xs[8], ys[8], zs[8];
+        for (size_t i = 0; i < 8; i++) {
+            const float* p = src.at(indexOf(first + (i < n ? i : 0)));
+            xs[i] = p[0];
+            ys[i] = p[1];
+            zs[i] = p[2];
+        }
+        Vec3x8 p = Vec3x8::load_soa(xs, ys, zs);
+        if (scale != 1.0f) {
+            p = p * scale;
+        }
+        Vec3x8 world = p.rotated(xf.rotation) + translation;
+        reduce(world, n);
+        world.store(out, first, n);
+    }
+}
+
+template <typename IndexFn>
+void transform_batches(const RigidTransformA& xf, ConstStrided3 src, Strided3 out,
+                       size_t count, IndexFn indexOf) {
+    transform_batches(xf, src, out, count, 1.0f, indexOf, [](const Vec3x8&, size_t) {});
+}
+
+// Evenly spaced source index for output i (first and last points included)
+struct SampleIndex {
+    float step;
+    size_t operator()(size_t i) const { return (size_t)(i * step + 0.5f); }
+};
+
+SampleIndex sample_index(size_t srcCount, size_t outCount) {
+    if (outCount <= 1 || outCount >= srcCount) {
+        return {1.0f};
+    }
+    return {(float)(srcCount - 1) / (float)(outCount - 1)};
+}
+
+} // namespace
+
+void transform_points(const RigidTransformA& xf, ConstStrided3 src, size_t count, Strided3 out) {
+    transform_batches(xf, src, out, count, [](size_t i) { return i; });
+}
+
+void transform_points_sampled(const RigidTransformA& xf, ConstStrided3 src, size_t srcCount,
+                              Strided3 out, size_t outCount) {
+    if (outCount == 0 || srcCount == 0) {
+        return;
+    }
+    if (outCount >= srcCount) {
+        transform_points(xf, src, srcCount, out);
+        return;
+    }
+    if (outCount == 1) {
+        transform_points(xf, src, 1, out);
+        return;
+    }
+    transform_batches(xf, src, out, outCount, sample_index(srcCount, outCount));
+}
+
+bool transform_points_sampled_bounds(const RigidTransformA& xf, ConstStrided3 src, size_t srcCount,
+                                     Strided3 out, size_t outCount, PointBounds& bounds,
+                                     float scale) {
+    if (outCount == 0 || srcCount == 0) {
+        return false;
+    }
+    if (outCount > srcCount) {
+        outCount = srcCount;
+    }
+
+    Vec3x8 translation = Vec3x8::broadcast(xf.translation);
+    Vec3x8 lo = Vec3x8::broadcast(Vec3A(3.4e38f));
+    Vec3x8 hi = Vec3x8::broadcast(Vec3A(-3.4e38f));
+    Vec3x8 sum = Vec3x8::zero();
+    Float8 radius2 = Float8::zero();
+    alignas(32) static const float laneIndex[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    const Float8 lanes = Float8::load(laneIndex);
+
+    transform_batches(xf, src, out, outCount, scale, sample_index(srcCount, outCount),
+                      [&](const Vec3x8& p, size_t n) {
+        // Repeated tail lanes are harmless for min/max but must not count twice
+        lo = lo.min(p);
+        hi = hi.max(p);
+        Float8 weight = math::select(lanes < Float8::broadcast((float)n), Float8::broadcast(1.0f), Float8::zero());
+        sum += p * weight;
+        radius2 = math::max(radius2, (p - translation).length_squared());
+    });
+
+    bounds.min = lo.hmin();
+    bounds.max = hi.hmax();
+    float inv = 1.0f / (float)outCount;
+    bounds.centroid = Vec3A(hsum(sum.x) * inv, hsum(sum.y) * inv, hsum(sum.z) * inv);
+    bounds.maxRadius = std::sqrt(hmax(radius2));
+    return true;
+}
+
+bool compute_bounds(ConstStrided3 points, size_t count, Vec3A& outMin, Vec3A& outMax) {
+    if (count == 0) {
+        return false;
+    }
+    Vec3x8 lo = Vec3x8::load(points, 0, count < 8 ? count : 8);
+    Vec3x8 hi = lo;
+    for (size_t first = Float8::Width; first < count; first += Float8::Width) {
+        size_t n = count - first < (size_t)Float8::Width ? count - first : (size_t)Float8::Width;
+        // Partial batches repeat element `first`, which is inside the set
+        Vec3x8 p = Vec3x8::load(points, first, n);
+        lo = lo.min(p);
+        hi = hi.max(p);
+    }
+    outMin = lo.hmin();
+    outMax = hi.hmax();
+    return true;
+}
+
+void apply_scaled(Strided3 dst, size_t count, const Vec3A& direction, const float* weights) {
+    Vec3x8 dir = Vec3x8::broadcast(direction);
+    for (size_t first = 0; first < count; first += Float8::Width) {
+        size_t n = count - first < (size_t)Float8::Width ? count - first : (size_t)Float8::Width;
+        Vec3x8 v = Vec3x8::load(dst, first, n);
+        if (weights) {
+            alignas(32) float w[8] = {};
+            for (size_t i = 0; i < n; i++) {
+                w[i] = weights[first + i];
+            }
+            v += dir * Float8::load(w);
+        } else {
+            v += dir;
+        }
+        v.store(dst, first, n);
+    }
+}
+
+} // namespace math
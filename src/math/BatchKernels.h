@@ -0,0 +1,48 @@
+#ifndef MICRO_IDLE_BATCH_KERNELS_H
+#define MICRO_IDLE_BATCH_KERNELS_H
+
+#include <cstddef>
+#include "QuatA.h"
+#include "Vec3A.h"
+#include "Vec3x8.h"
+#include "raylib.h"
+
+namespace math {
+
+// Batch kernels over strided 3-vector arrays. Each runs eight elements per
+// iteration through Vec3x8; the final partial batch uses the same code path.
+
+// out[i] = xf.rotation * src[i] + xf.translation, for i in [0, count)
+void transform_points(const RigidTransformA& xf, ConstStrided3 src, size_t count, Strided3 out);
+
+// Transform `outCount` points sampled evenly (rounded index) from `srcCount` source
+// points. outCount must be <= srcCount; outCount == srcCount is transform_points.
+void transform_points_sampled(const RigidTransformA& xf, ConstStrided3 src, size_t srcCount,
+                              Strided3 out, size_t outCount);
+
+// Reductions over the output of transform_points_sampled_bounds
+struct PointBounds {
+    Vec3A min;
+    Vec3A max;
+    Vec3A centroid;             // Mean of the output points
+    float maxRadius{0.0f};      // Largest distance from the transform's translation
+};
+
+// transform_points_sampled fused with the AABB, centroid and radial extent of
+// the written points, so each source point is read once. Source points are
+// multiplied by `scale` before rotating. Returns false (bounds untouched) when
+// nothing is written.
+bool transform_points_sampled_bounds(const RigidTransformA& xf, ConstStrided3 src, size_t srcCount,
+                                     Strided3 out, size_t outCount, PointBounds& bounds,
+                                     float scale = 1.0f);
+
+// Axis-aligned bounds of `count` points. Returns false (and leaves outputs alone)
+// when count is zero.
+bool compute_bounds(ConstStrided3 points, size_t count, Vec3A& outMin, Vec3A& outMax);
+
+// dst[i] += direction * weights[i]; a null weights pointer applies direction uniformly.
+void apply_scaled(Strided3 dst, size_t count, const Vec3A& direction, const float* weights);
+
+} // namespace math
+
+#endif // MICRO_IDLE_BATCH_KERNELS_H
@@ -0,0 +1,83 @@
+#ifndef MICRO_IDLE_JOLT_INTEROP_H
+#define MICRO_IDLE_JOLT_INTEROP_H
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Math/Float3.h>
+#include <Jolt/Math/Quat.h>
+#include <Jolt/Math/Vec3.h>
+#include <Jolt/Physics/SoftBody/SoftBodyVertex.h>
+#include "QuatA.h"
+#include "Vec3A.h"
+#include "Vec3x8.h"
+
+// Conversions between the SIMD math types and Jolt. Kept out of Vec3A.h/QuatA.h so
+// code that never touches physics does not pull in Jolt headers.
+namespace math {
+
+#if defined(MICRO_IDLE_SIMD_SSE) && defined(JPH_USE_SSE)
+
+inline Vec3A from_jolt(JPH::Vec3Arg v) {
+    // Jolt mirrors z into w; clear it to match Vec3A
+    const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    return Vec3A(_mm_and_ps(v.mValue, mask));
+}
+
+inline JPH::Vec3 to_jolt(const Vec3A& v) {
+    return JPH::Vec3(_mm_shuffle_ps(v.v, v.v, _MM_SHUFFLE(2, 2, 1, 0)));
+}
+
+inline QuatA from_jolt(JPH::QuatArg q) {
+    return QuatA(q.mValue.mValue);
+}
+
+inline JPH::Quat to_jolt(const QuatA& q) {
+    return JPH::Quat(JPH::Vec4(q.v));
+}
+
+#else
+
+inline Vec3A from_jolt(JPH::Vec3Arg v) {
+    return Vec3A(v.GetX(), v.GetY(), v.GetZ());
+}
+
+inline JPH::Vec3 to_jolt(const Vec3A& v) {
+    return JPH::Vec3(v.x(), v.y(), v.z());
+}
+
+inline QuatA from_jolt(JPH::QuatArg q) {
+    return QuatA(q.GetX(), q.GetY(), q.GetZ(), q.GetW());
+}
+
+inline JPH::Quat to_jolt(const QuatA& q) {
+    Vec3A im = q.xyz();
+    return JPH::Quat(im.x(), im.y(), im.z(), q.w());
+}
+
+#endif
+
+inline Vec3A from_jolt(const JPH::Float3& f) {
+    return Vec3A(f.x, f.y, f.z);
+}
+
+inline JPH::Float3 to_jolt_float3(const Vec3A& v) {
+    JPH::Float3 f;
+    v.store(&f.x);
+    return f;
+}
+
+inline RigidTransformA from_jolt(JPH::QuatArg rotation, JPH::Vec3Arg translation) {
+    return {from_jolt(rotation), from_jolt(translation)};
+}
+
+// Strided views over soft body vertex arrays
+inline ConstStrided3 positions_of(const JPH::Array<JPH::SoftBodyVertex>& vertices) {
+    return ConstStrided3(reinterpret_cast<const float*>(&vertices[0].mPosition), sizeof(JPH::SoftBodyVertex));
+}
+
+inline Strided3 velocities_of(JPH::Array<JPH::SoftBodyVertex>& vertices) {
+    return Strided3(reinterpret_cast<float*>(&vertices[0].mVelocity), sizeof(JPH::SoftBodyVertex), true);
+}
+
+} // namespace math
+
+#endif // MICRO_IDLE_JOLT_INTEROP_H
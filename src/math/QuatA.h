@@ -0,0 +1,81 @@
+#ifndef MICRO_IDLE_QUATA_H
+#define MICRO_IDLE_QUATA_H
+
+#include "Simd.h"
+#include "Vec3A.h"
+#include "Quat.h"
+
+namespace math {
+
+// 16-byte aligned quaternion (x, y, z, w) in one SSE register, register-compatible
+// with JPH::Quat. Only the operations hot loops need; use Quat for construction
+// helpers (from_euler_angles, look_at, ...) and convert.
+struct alignas(16) QuatA {
+#if defined(MICRO_IDLE_SIMD_SSE)
+    __m128 v;
+
+    QuatA() : v(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f)) {}
+    explicit QuatA(__m128 value) : v(value) {}
+    QuatA(float x, float y, float z, float w) : v(_mm_set_ps(w, z, y, x)) {}
+
+    float w() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+
+    // Imaginary part with the w lane cleared
+    Vec3A xyz() const {
+        const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+        return Vec3A(_mm_and_ps(v, mask));
+    }
+#else
+    float v[4];
+
+    QuatA() : v{0.0f, 0.0f, 0.0f, 1.0f} {}
+    QuatA(float x, float y, float z, float w) : v{x, y, z, w} {}
+
+    float w() const { return v[3]; }
+    Vec3A xyz() const { return Vec3A(v[0], v[1], v[2]); }
+#endif
+
+    QuatA(const Quat& q) : QuatA(q.x, q.y, q.z, q.w) {}
+
+    Quat to_quat() const {
+        Vec3A im = xyz();
+        return Quat(im.x(), im.y(), im.z(), w());
+    }
+
+    QuatA conjugate() const {
+        Vec3A im = -xyz();
+        return QuatA(im.x(), im.y(), im.z(), w());
+    }
+
+    QuatA operator*(const QuatA& o) const {
+        Vec3A a = xyz();
+        Vec3A b = o.xyz();
+        float aw = w();
+        float bw = o.w();
+        Vec3A im = b * aw + a * bw + a.cross(b);
+        return QuatA(im.x(), im.y(), im.z(), aw * bw - a.dot(b));
+    }
+
+    // Rotate a vector: v + 2w(q x v) + 2 q x (q x v)
+    Vec3A rotate(const Vec3A& p) const {
+        Vec3A q = xyz();
+        Vec3A t = q.cross(p) * 2.0f;
+        return p + t * w() + q.cross(t);
+    }
+
+    static QuatA identity() { return QuatA(); }
+};
+
+// Rotation followed by translation, the shape of Jolt's center-of-mass transform
+struct RigidTransformA {
+    QuatA rotation;
+    Vec3A translation;
+
+    Vec3A apply(const Vec3A& p) const {
+        return rotation.rotate(p) + translation;
+    }
+};
+
+} // namespace math
+
+#endif // MICRO_IDLE_QUATA_H
@@ -1,8 +0,0 @@
-#include "Random.h"
-
-namespace math {
-
-// Global random instance
-Random g_random(0x853c49e6748fea9bULL);
-
-} // namespace math
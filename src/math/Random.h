@@ -4,46 +4,44 @@
 #include <cstdint>
 #include <limits>
 #include <cmath>
+#include "engine/util/rng.h"
 #include "Vec3.h"
 #include "Quat.h"
 
 namespace math {
 
-// Simple, fast PCG32 random number generator
-// Based on Melissa O'Neill's PCG algorithm
+// C++ convenience wrapper over the engine RNG (engine/util/rng.h) adding
+// geometric distributions. Owns a plain Rng stream; there is no global
+// instance - derive streams from the world seed instead.
 class Random {
 private:
-    uint64_t state;
-    uint64_t increment;
-
-    uint32_t pcg32() {
-        uint64_t oldstate = state;
-        state = oldstate * 6364136223846793005ULL + increment;
-        uint32_t xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
-        uint32_t rot = oldstate >> 59u;
-        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
-    }
+    Rng rng;
 
 public:
     // Initialize with seed
-    Random(uint64_t seed = 0x853c49e6748fea9bULL) {
-        state = seed;
-        increment = 0xda3e39cb94b95bdbULL;
-        // Warm up the generator
-        for (int i = 0; i < 10; ++i) {
-            pcg32();
-        }
+    explicit Random(uint64_t seed = 0x853c49e6748fea9bULL) {
+        rng_seed(&rng, seed);
+    }
+
+    // Wrap an existing stream (e.g. one handed out by RandomStreams)
+    explicit Random(const Rng& stream) : rng(stream) {}
+
+    // Derive an independent child stream
+    Random split(uint64_t stream_id) const {
+        Rng child;
+        rng_split(&rng, stream_id, &child);
+        return Random(child);
     }
 
     // Generate random uint32
     uint32_t next_u32() {
-        return pcg32();
+        return rng_next_u32(&rng);
     }
 
     // Generate random uint32 in range [0, max)
     uint32_t next_u32(uint32_t max) {
         if (max == 0) return 0;
-        return pcg32() % max;
+        return next_u32() % max;
     }
 
     // Generate random uint32 in range [min, max)
@@ -54,7 +52,7 @@ public:
 
     // Generate random float in range [0, 1)
     float next_f01() {
-        return static_cast<float>(pcg32()) / static_cast<float>(std::numeric_limits<uint32_t>::max());
+        return rng_next_f01(&rng);
     }
 
     // Generate random float in range [0, 1]
@@ -147,22 +145,19 @@ public:
 
     // Seed the generator with a new value
     void seed(uint64_t new_seed) {
-        state = new_seed;
-        increment = 0xda3e39cb94b95bdbULL;
-        // Warm up again
-        for (int i = 0; i < 10; ++i) {
-            pcg32();
-        }
+        rng_seed(&rng, new_seed);
     }
 
-    // Get current seed (for reproducibility)
+    // Get current state (for reproducibility)
     uint64_t get_seed() const {
-        return state;
+        return rng.state;
     }
-};
 
-// Global random instance for convenience
-extern Random g_random;
+    // Underlying engine stream
+    Rng& stream() {
+        return rng;
+    }
+};
 
 } // namespace math
 
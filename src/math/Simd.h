@@ -0,0 +1,187 @@
+#ifndef MICRO_IDLE_SIMD_H
+#define MICRO_IDLE_SIMD_H
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MICRO_IDLE_SIMD_SSE 1
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX__)
+#define MICRO_IDLE_SIMD_AVX 1
+#endif
+
+namespace math {
+
+// Eight-lane float register used by the SoA batch types (Vec3x8) and batch kernels.
+// Maps onto one __m256 when the translation unit is built with AVX, otherwise a
+// plain array the compiler can auto-vectorize. Loads and stores are unaligned.
+struct Mask8;
+
+struct Float8 {
+    static constexpr int Width = 8;
+
+#if defined(MICRO_IDLE_SIMD_AVX)
+    __m256 v;
+
+    Float8() = default;
+    explicit Float8(__m256 value) : v(value) {}
+
+    static Float8 zero() { return Float8(_mm256_setzero_ps()); }
+    static Float8 broadcast(float s) { return Float8(_mm256_set1_ps(s)); }
+    static Float8 load(const float* p) { return Float8(_mm256_loadu_ps(p)); }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+
+    Float8 operator+(const Float8& o) const { return Float8(_mm256_add_ps(v, o.v)); }
+    Float8 operator-(const Float8& o) const { return Float8(_mm256_sub_ps(v, o.v)); }
+    Float8 operator*(const Float8& o) const { return Float8(_mm256_mul_ps(v, o.v)); }
+    Float8 operator/(const Float8& o) const { return Float8(_mm256_div_ps(v, o.v)); }
+    Float8 operator-() const { return Float8(_mm256_sub_ps(_mm256_setzero_ps(), v)); }
+#else
+    float v[8];
+
+    Float8() = default;
+
+    static Float8 zero() { return broadcast(0.0f); }
+    static Float8 broadcast(float s) {
+        Float8 r;
+        for (int i = 0; i < 8; i++) r.v[i] = s;
+        return r;
+    }
+    static Float8 load(const float* p) {
+        Float8 r;
+        for (int i = 0; i < 8; i++) r.v[i] = p[i];
+        return r;
+    }
+    void store(float* p) const {
+        for (int i = 0; i < 8; i++) p[i] = v[i];
+    }
+
+    Float8 operator+(const Float8& o) const { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = v[i] + o.v[i]; return r; }
+    Float8 operator-(const Float8& o) const { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = v[i] - o.v[i]; return r; }
+    Float8 operator*(const Float8& o) const { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = v[i] * o.v[i]; return r; }
+    Float8 operator/(const Float8& o) const { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = v[i] / o.v[i]; return r; }
+    Float8 operator-() const { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = -v[i]; return r; }
+#endif
+
+    Float8 operator*(float s) const { return *this * broadcast(s); }
+    Float8& operator+=(const Float8& o) { *this = *this + o; return *this; }
+    Float8& operator-=(const Float8& o) { *this = *this - o; return *this; }
+    Float8& operator*=(const Float8& o) { *this = *this * o; return *this; }
+
+    float lane(int i) const {
+        alignas(32) float tmp[8];
+        store(tmp);
+        return tmp[i];
+    }
+};
+
+// Per-lane comparison result. Only meaningful as an argument to select()/any()/bits().
+struct Mask8 {
+#if defined(MICRO_IDLE_SIMD_AVX)
+    __m256 m;
+
+    int bits() const { return _mm256_movemask_ps(m); }
+#else
+    bool m[8];
+
+    int bits() const {
+        int b = 0;
+        for (int i = 0; i < 8; i++) b |= m[i] ? (1 << i) : 0;
+        return b;
+    }
+#endif
+
+    bool any() const { return bits() != 0; }
+    bool all() const { return bits() == 0xFF; }
+};
+
+#if defined(MICRO_IDLE_SIMD_AVX)
+
+inline Float8 min(const Float8& a, const Float8& b) { return Float8(_mm256_min_ps(a.v, b.v)); }
+inline Float8 max(const Float8& a, const Float8& b) { return Float8(_mm256_max_ps(a.v, b.v)); }
+inline Float8 sqrt(const Float8& a) { return Float8(_mm256_sqrt_ps(a.v)); }
+inline Float8 abs(const Float8& a) {
+    return Float8(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v));
+}
+
+// a * b + c, fused when the target has FMA
+inline Float8 fmadd(const Float8& a, const Float8& b, const Float8& c) {
+#if defined(__FMA__)
+    return Float8(_mm256_fmadd_ps(a.v, b.v, c.v));
+#else
+    return Float8(_mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v));
+#endif
+}
+
+inline Mask8 operator<(const Float8& a, const Float8& b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)}; }
+inline Mask8 operator>(const Float8& a, const Float8& b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+inline Mask8 operator<=(const Float8& a, const Float8& b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)}; }
+inline Mask8 operator>=(const Float8& a, const Float8& b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ)}; }
+inline Mask8 operator&(const Mask8& a, const Mask8& b) { return {_mm256_and_ps(a.m, b.m)}; }
+inline Mask8 operator|(const Mask8& a, const Mask8& b) { return {_mm256_or_ps(a.m, b.m)}; }
+
+// Lane-wise mask ? a : b
+inline Float8 select(const Mask8& mask, const Float8& a, const Float8& b) {
+    return Float8(_mm256_blendv_ps(b.v, a.v, mask.m));
+}
+
+inline float hmin(const Float8& a) {
+    __m128 m = _mm_min_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+    m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_min_ss(m, _mm_shuffle_ps(m, m, 0x55));
+    return _mm_cvtss_f32(m);
+}
+
+inline float hmax(const Float8& a) {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 0x55));
+    return _mm_cvtss_f32(m);
+}
+
+inline float hsum(const Float8& a) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+    return _mm_cvtss_f32(s);
+}
+
+#else
+
+inline Float8 min(const Float8& a, const Float8& b) { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return r; }
+inline Float8 max(const Float8& a, const Float8& b) { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return r; }
+inline Float8 sqrt(const Float8& a) { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = std::sqrt(a.v[i]); return r; }
+inline Float8 abs(const Float8& a) { Float8 r; for (int i = 0; i < 8; i++) r.v[i] = std::fabs(a.v[i]); return r; }
+inline Float8 fmadd(const Float8& a, const Float8& b, const Float8& c) { return a * b + c; }
+
+inline Mask8 operator<(const Float8& a, const Float8& b) { Mask8 r; for (int i = 0; i < 8; i++) r.m[i] = a.v[i] < b.v[i]; return r; }
+inline Mask8 operator>(const Float8& a, const Float8& b) { Mask8 r; for (int i = 0; i < 8; i++) r.m[i] = a.v[i] > b.v[i]; return r; }
+inline Mask8 operator<=(const Float8& a, const Float8& b) { Mask8 r; for (int i = 0; i < 8; i++) r.m[i] = a.v[i] <= b.v[i]; return r; }
+inline Mask8 operator>=(const Float8& a, const Float8& b) { Mask8 r; for (int i = 0; i < 8; i++) r.m[i] = a.v[i] >= b.v[i]; return r; }
+inline Mask8 operator&(const Mask8& a, const Mask8& b) { Mask8 r; for (int i = 0; i < 8; i++) r.m[i] = a.m[i] && b.m[i]; return r; }
+inline Mask8 operator|(const Mask8& a, const Mask8& b) { Mask8 r; for (int i = 0; i < 8; i++) r.m[i] = a.m[i] || b.m[i]; return r; }
+
+inline Float8 select(const Mask8& mask, const Float8& a, const Float8& b) {
+    Float8 r;
+    for (int i = 0; i < 8; i++) r.v[i] = mask.m[i] ? a.v[i] : b.v[i];
+    return r;
+}
+
+inline float hmin(const Float8& a) { float r = a.v[0]; for (int i = 1; i < 8; i++) r = a.v[i] < r ? a.v[i] : r; return r; }
+inline float hmax(const Float8& a) { float r = a.v[0]; for (int i = 1; i < 8; i++) r = a.v[i] > r ? a.v[i] : r; return r; }
+inline float hsum(const Float8& a) { float r = 0.0f; for (int i = 0; i < 8; i++) r += a.v[i]; return r; }
+
+#endif
+
+inline Float8 operator*(float s, const Float8& a) { return a * s; }
+
+inline Float8 clamp(const Float8& a, const Float8& lo, const Float8& hi) {
+    return min(max(a, lo), hi);
+}
+
+} // namespace math
+
+#endif // MICRO_IDLE_SIMD_H
@@ -0,0 +1,134 @@
+#ifndef MICRO_IDLE_VEC3A_H
+#define MICRO_IDLE_VEC3A_H
+
+#include "Simd.h"
+#include "Vec3.h"
+#include "raylib.h"
+
+namespace math {
+
+// 16-byte aligned 3-vector held in one SSE register (w lane unused, kept at zero).
+// Same register layout as JPH::Vec3, so conversions through JoltInterop.h are a
+// register copy. Use Vec3 for storage/constexpr math and Vec3A in hot loops.
+struct alignas(16) Vec3A {
+#if defined(MICRO_IDLE_SIMD_SSE)
+    __m128 v;
+
+    Vec3A() : v(_mm_setzero_ps()) {}
+    explicit Vec3A(__m128 value) : v(value) {}
+    Vec3A(float x, float y, float z) : v(_mm_set_ps(0.0f, z, y, x)) {}
+    explicit Vec3A(float s) : v(_mm_set_ps(0.0f, s, s, s)) {}
+
+    float x() const { return _mm_cvtss_f32(v); }
+    float y() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+    float z() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))); }
+
+    Vec3A operator+(const Vec3A& o) const { return Vec3A(_mm_add_ps(v, o.v)); }
+    Vec3A operator-(const Vec3A& o) const { return Vec3A(_mm_sub_ps(v, o.v)); }
+    Vec3A operator*(const Vec3A& o) const { return Vec3A(_mm_mul_ps(v, o.v)); }
+    Vec3A operator*(float s) const { return Vec3A(_mm_mul_ps(v, _mm_set1_ps(s))); }
+    Vec3A operator/(float s) const { return *this * (1.0f / s); }
+    Vec3A operator-() const { return Vec3A(_mm_sub_ps(_mm_setzero_ps(), v)); }
+
+    float dot(const Vec3A& o) const {
+        __m128 m = _mm_mul_ps(v, o.v);
+        __m128 s = _mm_add_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+        s = _mm_add_ss(s, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2)));
+        return _mm_cvtss_f32(s);
+    }
+
+    Vec3A cross(const Vec3A& o) const {
+        __m128 a_yzx = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 b_yzx = _mm_shuffle_ps(o.v, o.v, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_sub_ps(_mm_mul_ps(v, b_yzx), _mm_mul_ps(a_yzx, o.v));
+        return Vec3A(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+    }
+
+    Vec3A min(const Vec3A& o) const { return Vec3A(_mm_min_ps(v, o.v)); }
+    Vec3A max(const Vec3A& o) const { return Vec3A(_mm_max_ps(v, o.v)); }
+    Vec3A abs() const { return Vec3A(_mm_andnot_ps(_mm_set1_ps(-0.0f), v)); }
+
+    void store(float* out3) const {
+        alignas(16) float tmp[4];
+        _mm_store_ps(tmp, v);
+        out3[0] = tmp[0];
+        out3[1] = tmp[1];
+        out3[2] = tmp[2];
+    }
+#else
+    float v[4];
+
+    Vec3A() : v{0.0f, 0.0f, 0.0f, 0.0f} {}
+    Vec3A(float x, float y, float z) : v{x, y, z, 0.0f} {}
+    explicit Vec3A(float s) : v{s, s, s, 0.0f} {}
+
+    float x() const { return v[0]; }
+    float y() const { return v[1]; }
+    float z() const { return v[2]; }
+
+    Vec3A operator+(const Vec3A& o) const { return Vec3A(v[0] + o.v[0], v[1] + o.v[1], v[2] + o.v[2]); }
+    Vec3A operator-(const Vec3A& o) const { return Vec3A(v[0] - o.v[0], v[1] - o.v[1], v[2] - o.v[2]); }
+    Vec3A operator*(const Vec3A& o) const { return Vec3A(v[0] * o.v[0], v[1] * o.v[1], v[2] * o.v[2]); }
+    Vec3A operator*(float s) const { return Vec3A(v[0] * s, v[1] * s, v[2] * s); }
+    Vec3A operator/(float s) const { return *this * (1.0f / s); }
+    Vec3A operator-() const { return Vec3A(-v[0], -v[1], -v[2]); }
+
+    float dot(const Vec3A& o) const { return v[0] * o.v[0] + v[1] * o.v[1] + v[2] * o.v[2]; }
+
+    Vec3A cross(const Vec3A& o) const {
+        return Vec3A(
+            v[1] * o.v[2] - v[2] * o.v[1],
+            v[2] * o.v[0] - v[0] * o.v[2],
+            v[0] * o.v[1] - v[1] * o.v[0]
+        );
+    }
+
+    Vec3A min(const Vec3A& o) const {
+        return Vec3A(std::fmin(v[0], o.v[0]), std::fmin(v[1], o.v[1]), std::fmin(v[2], o.v[2]));
+    }
+    Vec3A max(const Vec3A& o) const {
+        return Vec3A(std::fmax(v[0], o.v[0]), std::fmax(v[1], o.v[1]), std::fmax(v[2], o.v[2]));
+    }
+    Vec3A abs() const { return Vec3A(std::fabs(v[0]), std::fabs(v[1]), std::fabs(v[2])); }
+
+    void store(float* out3) const {
+        out3[0] = v[0];
+        out3[1] = v[1];
+        out3[2] = v[2];
+    }
+#endif
+
+    // Conversion from/to the scalar and Raylib types
+    Vec3A(const Vec3& s) : Vec3A(s.x, s.y, s.z) {}
+    Vec3A(const Vector3& s) : Vec3A(s.x, s.y, s.z) {}
+    static Vec3A load(const float* p3) { return Vec3A(p3[0], p3[1], p3[2]); }
+
+    Vec3 to_vec3() const { return Vec3(x(), y(), z()); }
+    Vector3 to_vector3() const {
+        Vector3 r;
+        store(&r.x);
+        return r;
+    }
+
+    Vec3A& operator+=(const Vec3A& o) { *this = *this + o; return *this; }
+    Vec3A& operator-=(const Vec3A& o) { *this = *this - o; return *this; }
+    Vec3A& operator*=(float s) { *this = *this * s; return *this; }
+
+    float length_squared() const { return dot(*this); }
+    float length() const { return std::sqrt(length_squared()); }
+
+    Vec3A normalized() const {
+        float len = length();
+        return len > 0.0f ? *this * (1.0f / len) : Vec3A();
+    }
+
+    static Vec3A zero() { return Vec3A(); }
+};
+
+inline Vec3A operator*(float s, const Vec3A& v) {
+    return v * s;
+}
+
+} // namespace math
+
+#endif // MICRO_IDLE_VEC3A_H
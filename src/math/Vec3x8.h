@@ -0,0 +1,143 @@
+#ifndef MICRO_IDLE_VEC3X8_H
+#define MICRO_IDLE_VEC3X8_H
+
+#include <cstddef>
+#include <cstdint>
+#include "Simd.h"
+#include "QuatA.h"
+#include "Vec3A.h"
+#include "raylib.h"
+
+namespace math {
+
+// Read-only view of an array of 3-float vectors with an arbitrary byte stride, so
+// the same kernel runs over Vector3[] (12 bytes), Vec3A[] / JPH::Vec3 (16 bytes) or
+// a member embedded in a larger struct (e.g. JPH::SoftBodyVertex::mPosition).
+struct ConstStrided3 {
+    const uint8_t* base;
+    size_t stride;
+
+    ConstStrided3(const float* first, size_t strideBytes)
+        : base(reinterpret_cast<const uint8_t*>(first)), stride(strideBytes) {}
+
+    const float* at(size_t i) const {
+        return reinterpret_cast<const float*>(base + i * stride);
+    }
+};
+
+// Writable strided view. mirrorW writes z into the fourth float as well, which is
+// the invariant JPH::Vec3 keeps in its unused lane.
+struct Strided3 {
+    uint8_t* base;
+    size_t stride;
+    bool mirrorW;
+
+    Strided3(float* first, size_t strideBytes, bool mirrorWLane = false)
+        : base(reinterpret_cast<uint8_t*>(first)), stride(strideBytes), mirrorW(mirrorWLane) {}
+
+    float* at(size_t i) const {
+        return reinterpret_cast<float*>(base + i * stride);
+    }
+
+    operator ConstStrided3() const {
+        return ConstStrided3(reinterpret_cast<const float*>(base), stride);
+    }
+};
+
+inline ConstStrided3 strided(const Vector3* points) {
+    return ConstStrided3(&points[0].x, sizeof(Vector3));
+}
+
+inline Strided3 strided(Vector3* points) {
+    return Strided3(&points[0].x, sizeof(Vector3));
+}
+
+// Eight 3-vectors in structure-of-arrays form: one Float8 per axis
+struct Vec3x8 {
+    Float8 x, y, z;
+
+    static Vec3x8 broadcast(const Vec3A& v) {
+        return {Float8::broadcast(v.x()), Float8::broadcast(v.y()), Float8::broadcast(v.z())};
+    }
+
+    static Vec3x8 zero() {
+        return {Float8::zero(), Float8::zero(), Float8::zero()};
+    }
+
+    static Vec3x8 load_soa(const float* xs, const float* ys, const float* zs) {
+        return {Float8::load(xs), Float8::load(ys), Float8::load(zs)};
+    }
+
+    void store_soa(float* xs, float* ys, float* zs) const {
+        x.store(xs);
+        y.store(ys);
+        z.store(zs);
+    }
+
+    // Gather `count` (1..8) vectors starting at element `first`. Missing lanes repeat
+    // the first element so min/max reductions over a partial batch stay correct.
+    static Vec3x8 load(ConstStrided3 src, size_t first, size_t count = 8) {
+        alignas(32) float xs[8], ys[8], zs[8];
+        for (size_t i = 0; i < 8; i++) {
+            const float* p = src.at(first + (i < count ? i : 0));
+            xs[i] = p[0];
+            ys[i] = p[1];
+            zs[i] = p[2];
+        }
+        return load_soa(xs, ys, zs);
+    }
+
+    // Scatter the first `count` lanes back to AoS storage
+    void store(Strided3 dst, size_t first, size_t count = 8) const {
+        alignas(32) float xs[8], ys[8], zs[8];
+        store_soa(xs, ys, zs);
+        for (size_t i = 0; i < count; i++) {
+            float* p = dst.at(first + i);
+            p[0] = xs[i];
+            p[1] = ys[i];
+            p[2] = zs[i];
+            if (dst.mirrorW) {
+                p[3] = zs[i];
+            }
+        }
+    }
+
+    Vec3x8 operator+(const Vec3x8& o) const { return {x + o.x, y + o.y, z + o.z}; }
+    Vec3x8 operator-(const Vec3x8& o) const { return {x - o.x, y - o.y, z - o.z}; }
+    Vec3x8 operator*(const Float8& s) const { return {x * s, y * s, z * s}; }
+    Vec3x8 operator*(float s) const { return *this * Float8::broadcast(s); }
+    Vec3x8& operator+=(const Vec3x8& o) { *this = *this + o; return *this; }
+
+    Float8 dot(const Vec3x8& o) const {
+        return fmadd(x, o.x, fmadd(y, o.y, z * o.z));
+    }
+
+    Vec3x8 cross(const Vec3x8& o) const {
+        return {
+            y * o.z - z * o.y,
+            z * o.x - x * o.z,
+            x * o.y - y * o.x
+        };
+    }
+
+    Float8 length_squared() const { return dot(*this); }
+    Float8 length() const { return sqrt(length_squared()); }
+
+    Vec3x8 min(const Vec3x8& o) const { return {math::min(x, o.x), math::min(y, o.y), math::min(z, o.z)}; }
+    Vec3x8 max(const Vec3x8& o) const { return {math::max(x, o.x), math::max(y, o.y), math::max(z, o.z)}; }
+
+    // Rotate all eight lanes by one quaternion (same formula as QuatA::rotate)
+    Vec3x8 rotated(const QuatA& q) const {
+        Vec3x8 qv = broadcast(q.xyz());
+        Float8 w = Float8::broadcast(q.w());
+        Vec3x8 t = qv.cross(*this) * 2.0f;
+        return *this + t * w + qv.cross(t);
+    }
+
+    Vec3A hmin() const { return Vec3A(math::hmin(x), math::hmin(y), math::hmin(z)); }
+    Vec3A hmax() const { return Vec3A(math::hmax(x), math::hmax(y), math::hmax(z)); }
+};
+
+} // namespace math
+
+#endif // MICRO_IDLE_VEC3X8_H
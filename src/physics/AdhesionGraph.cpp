@@ -0,0 +1,286 @@
+#include "AdhesionGraph.h"
+#include "src/math/Simd.h"
+#include "src/physics/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace micro_idle {
+
+namespace {
+
+using math::Float8;
+
+constexpr float Epsilon = 1e-6f;
+constexpr int ChunkSize = 256;              // Bonds per job (a multiple of the lane count)
+
+} // namespace
+
+void AdhesionGraph::beginStep() {
+    count = 0;
+    px.clear();
+    py.clear();
+    pz.clear();
+    invMass.clear();
+    bonded.clear();
+    membranes.clear();
+}
+
+void AdhesionGraph::clear() {
+    beginStep();
+    bondCount = 0;
+    keyA.clear();
+    keyB.clear();
+    vertexA.clear();
+    vertexB.clear();
+    rest.clear();
+    lambda.clear();
+    endA.clear();
+    endB.clear();
+    requests.clear();
+}
+
+int AdhesionGraph::addMembrane(uint64_t key, float mobility, const Vector3* positions, int vertexCount) {
+    int first = count;
+    if (vertexCount <= 0) {
+        return first;
+    }
+    membranes[key] = {first, vertexCount};
+    float w = std::max(mobility, 0.0f);
+    for (int i = 0; i < vertexCount; i++) {
+        px.push_back(positions[i].x);
+        py.push_back(positions[i].y);
+        pz.push_back(positions[i].z);
+        invMass.push_back(w);
+        bonded.push_back(0);
+    }
+    count += vertexCount;
+    return first;
+}
+
+void AdhesionGraph::requestBond(uint64_t a, int va, uint64_t b, int vb) {
+    if (a == b) {
+        return;
+    }
+    // Both sides of a contact report it; one order keeps the pair recognisable
+    if (b < a) {
+        std::swap(a, b);
+        std::swap(va, vb);
+    }
+    requests.push_back({a, b, va, vb});
+}
+
+int AdhesionGraph::resolve(uint64_t key, int vertex) const {
+    auto it = membranes.find(key);
+    if (it == membranes.end() || vertex < 0 || vertex >= it->second.count) {
+        return -1;
+    }
+    return it->second.first + vertex;
+}
+
+void AdhesionGraph::removeBonds(const std::vector<uint8_t>& broken) {
+    // Swap-remove in one pass; the flags of moved bonds travel with them
+    std::vector<uint8_t> flags = broken;
+    int i = 0;
+    while (i < bondCount) {
+        if (!flags[(size_t)i]) {
+            i++;
+            continue;
+        }
+        size_t at = (size_t)i;
+        size_t last = (size_t)(bondCount - 1);
+        keyA[at] = keyA[last];
+        keyB[at] = keyB[last];
+        vertexA[at] = vertexA[last];
+        vertexB[at] = vertexB[last];
+        rest[at] = rest[last];
+        endA[at] = endA[last];
+        endB[at] = endB[last];
+        flags[at] = flags[last];
+        bondCount--;
+        lastBroken++;
+    }
+
+    size_t n = (size_t)bondCount;
+    keyA.resize(n);
+    keyB.resize(n);
+    vertexA.resize(n);
+    vertexB.resize(n);
+    rest.resize(n);
+    endA.resize(n);
+    endB.resize(n);
+}
+
+void AdhesionGraph::createRequested() {
+    float break2 = breakLength * breakLength;
+    for (const Request& r : requests) {
+        if (bondCount >= maxBonds) {
+            break;
+        }
+        int a = resolve(r.keyA, r.vertexA);
+        int b = resolve(r.keyB, r.vertexB);
+        if (a < 0 || b < 0 || bonded[(size_t)a] || bonded[(size_t)b]) {
+            continue;
+        }
+        if (invMass[(size_t)a] + invMass[(size_t)b] <= 0.0f) {
+            continue;
+        }
+        float dx = px[(size_t)a] - px[(size_t)b];
+        float dy = py[(size_t)a] - py[(size_t)b];
+        float dz = pz[(size_t)a] - pz[(size_t)b];
+        if (dx * dx + dy * dy + dz * dz > break2) {
+            continue;
+        }
+
+        keyA.push_back(r.keyA);
+        keyB.push_back(r.keyB);
+        vertexA.push_back(r.vertexA);
+        vertexB.push_back(r.vertexB);
+        rest.push_back(restLength);
+        endA.push_back(a);
+        endB.push_back(b);
+        bonded[(size_t)a] = 1;
+        bonded[(size_t)b] = 1;
+        bondCount++;
+        lastCreated++;
+    }
+    requests.clear();
+}
+
+void AdhesionGraph::projectRange(int begin, int end, float alphaTilde) {
+    const Float8 alpha = Float8::broadcast(alphaTilde);
+    const Float8 tiny = Float8::broadcast(Epsilon);
+    const Float8 zero = Float8::zero();
+
+    alignas(32) float ax[Float8::Width], ay[Float8::Width], az[Float8::Width];
+    alignas(32) float bx[Float8::Width], by[Float8::Width], bz[Float8::Width];
+    alignas(32) float wa[Float8::Width], wb[Float8::Width], len0[Float8::Width];
+    for (int j = begin; j < end; j += Float8::Width) {
+        int lanes = std::min(Float8::Width, end - j);
+
+        // Gather endpoints; empty lanes are zero-length, weightless bonds
+        for (int lane = 0; lane < Float8::Width; lane++) {
+            if (lane >= lanes) {
+                ax[lane] = ay[lane] = az[lane] = 0.0f;
+                bx[lane] = by[lane] = bz[lane] = 0.0f;
+                wa[lane] = wb[lane] = len0[lane] = 0.0f;
+                continue;
+            }
+            size_t a = (size_t)endA[(size_t)(j + lane)];
+            size_t b = (size_t)endB[(size_t)(j + lane)];
+            ax[lane] = px[a];
+            ay[lane] = py[a];
+            az[lane] = pz[a];
+            bx[lane] = px[b];
+            by[lane] = py[b];
+            bz[lane] = pz[b];
+            wa[lane] = invMass[a];
+            wb[lane] = invMass[b];
+            len0[lane] = rest[(size_t)(j + lane)];
+        }
+
+        Float8 dx = Float8::load(ax) - Float8::load(bx);
+        Float8 dy = Float8::load(ay) - Float8::load(by);
+        Float8 dz = Float8::load(az) - Float8::load(bz);
+        Float8 len = math::sqrt(dx * dx + dy * dy + dz * dz);
+        Float8 invLen = Float8::broadcast(1.0f) / math::max(len, tiny);
+        Float8 wA = Float8::load(wa);
+        Float8 wB = Float8::load(wb);
+
+        // XPBD: dLambda = (-C - alpha~ * lambda) / (wA + wB + alpha~)
+        Float8 lam = Float8::load(&lambda[(size_t)j]);
+        Float8 c = len - Float8::load(len0);
+        Float8 dLambda = (zero - c - alpha * lam) / math::max(wA + wB + alpha, tiny);
+        (lam + dLambda).store(&lambda[(size_t)j]);
+
+        Float8 step = dLambda * invLen;
+        Float8 moveAX = step * wA * dx;
+        Float8 moveAY = step * wA * dy;
+        Float8 moveAZ = step * wA * dz;
+        Float8 moveBX = step * wB * dx;
+        Float8 moveBY = step * wB * dy;
+        Float8 moveBZ = step * wB * dz;
+        moveAX.store(ax);
+        moveAY.store(ay);
+        moveAZ.store(az);
+        moveBX.store(bx);
+        moveBY.store(by);
+        moveBZ.store(bz);
+
+        // No two bonds share a vertex, so the scatter never races
+        for (int lane = 0; lane < lanes; lane++) {
+            size_t a = (size_t)endA[(size_t)(j + lane)];
+            size_t b = (size_t)endB[(size_t)(j + lane)];
+            px[a] += ax[lane];
+            py[a] += ay[lane];
+            pz[a] += az[lane];
+            px[b] -= bx[lane];
+            py[b] -= by[lane];
+            pz[b] -= bz[lane];
+        }
+    }
+}
+
+int AdhesionGraph::solve(float dt, JPH::JobSystem* jobs) {
+    lastCreated = 0;
+    lastBroken = 0;
+    ox = px;
+    oy = py;
+    oz = pz;
+
+    // One batch for every break: bonds whose membranes are gone, and bonds the
+    // physics step stretched past breaking. Then merge this step's requests.
+    float break2 = breakLength * breakLength;
+    std::vector<uint8_t> broken((size_t)bondCount, 0);
+    bool anyBroken = false;
+    for (int i = 0; i < bondCount; i++) {
+        size_t k = (size_t)i;
+        endA[k] = resolve(keyA[k], vertexA[k]);
+        endB[k] = resolve(keyB[k], vertexB[k]);
+        if (endA[k] < 0 || endB[k] < 0) {
+            broken[k] = 1;
+            anyBroken = true;
+            continue;
+        }
+        size_t a = (size_t)endA[k];
+        size_t b = (size_t)endB[k];
+        float dx = px[a] - px[b];
+        float dy = py[a] - py[b];
+        float dz = pz[a] - pz[b];
+        if (dx * dx + dy * dy + dz * dz > break2) {
+            broken[k] = 1;
+            anyBroken = true;
+            continue;
+        }
+        bonded[a] = 1;
+        bonded[b] = 1;
+    }
+    if (anyBroken) {
+        removeBonds(broken);
+    }
+    createRequested();
+    if (bondCount == 0 || dt <= 0.0f) {
+        return bondCount;
+    }
+
+    // Lanes read whole Float8s of lambda, so pad to the lane count
+    lambda.assign((size_t)((bondCount + Float8::Width - 1) & ~(Float8::Width - 1)), 0.0f);
+    float alphaTilde = compliance / (dt * dt);
+    int chunks = (bondCount + ChunkSize - 1) / ChunkSize;
+    for (int iteration = 0; iteration < iterations; iteration++) {
+        parallelFor(jobs, chunks, [&](int c) {
+            int begin = c * ChunkSize;
+            projectRange(begin, std::min(begin + ChunkSize, bondCount), alphaTilde);
+        });
+    }
+    return bondCount;
+}
+
+Vector3 AdhesionGraph::getDisplacement(int vertex) const {
+    if (vertex < 0 || vertex >= count || ox.size() != (size_t)count) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    size_t k = (size_t)vertex;
+    return {px[k] - ox[k], py[k] - oy[k], pz[k] - oz[k]};
+}
+
+} // namespace micro_idle
@@ -0,0 +1,112 @@
+#ifndef MICRO_IDLE_ADHESION_GRAPH_H
+#define MICRO_IDLE_ADHESION_GRAPH_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "raylib.h"
+
+namespace JPH {
+class JobSystem;
+}
+
+namespace micro_idle {
+
+/**
+ * Adhesive bonds between membrane vertices of neighbouring microbes (pili, biofilm)
+ *
+ * Bonds live in one pooled SoA edge list instead of one Jolt constraint each.
+ * Endpoints are stored as (membrane key, vertex) so they survive membranes
+ * being gathered in a different order every step. Bond requests (from contact
+ * events) and breaks are applied in batches at the start of solve(): bonds
+ * the physics step stretched too far or whose membrane vanished go in one
+ * swap-remove pass, then requests are merged, so the list never churns
+ * while bonds are being solved.
+ *
+ * Bonds are distance constraints solved with XPBD, eight per Float8. A vertex
+ * holds at most one bond, so no two bonds share an endpoint: bond chunks run
+ * as independent jobs and write their endpoints directly.
+ */
+class AdhesionGraph {
+public:
+    // Start a step: forget last step's membranes (bonds are kept)
+    void beginStep();
+
+    /**
+     * Add one membrane's current world-space vertices
+     *
+     * @param key Stable id of the membrane (e.g. its entity id)
+     * @param mobility Inverse mass share; 0 holds the membrane still
+     * @return Index of the membrane's first vertex
+     */
+    int addMembrane(uint64_t key, float mobility, const Vector3* positions, int count);
+
+    // Ask for a bond between two vertices; merged at the next solve()
+    void requestBond(uint64_t keyA, int vertexA, uint64_t keyB, int vertexB);
+
+    /**
+     * Break overstretched and orphaned bonds, create requested ones and solve
+     *
+     * @param jobs Job system to spread bond chunks over (null runs inline)
+     * @return Number of live bonds
+     */
+    int solve(float dt, JPH::JobSystem* jobs);
+
+    // Correction of a vertex from the last solve()
+    Vector3 getDisplacement(int vertex) const;
+
+    void clear();
+
+    int getBondCount() const { return bondCount; }
+    int getLastCreated() const { return lastCreated; }
+    int getLastBroken() const { return lastBroken; }
+    int getVertexCount() const { return count; }
+
+    float restLength{0.04f};        // Bond length once formed
+    float breakLength{0.25f};       // Bonds stretched past this by the physics step snap
+    float compliance{2e-5f};        // XPBD compliance (inverse stiffness)
+    int iterations{4};
+    int maxBonds{1 << 16};
+
+private:
+    struct Membrane {
+        int first;
+        int count;
+    };
+
+    struct Request {
+        uint64_t keyA;
+        uint64_t keyB;
+        int vertexA;
+        int vertexB;
+    };
+
+    // Bonds, SoA; capacity is kept between steps
+    int bondCount{0};
+    std::vector<uint64_t> keyA, keyB;
+    std::vector<int> vertexA, vertexB;
+    std::vector<float> rest;
+    std::vector<float> lambda;
+    std::vector<int> endA, endB;        // Resolved vertex indices of this step (-1 = gone)
+
+    // Vertices of this step
+    int count{0};
+    std::vector<float> px, py, pz;
+    std::vector<float> ox, oy, oz;
+    std::vector<float> invMass;
+    std::vector<uint8_t> bonded;
+    std::unordered_map<uint64_t, Membrane> membranes;
+
+    std::vector<Request> requests;
+    int lastCreated{0};
+    int lastBroken{0};
+
+    int resolve(uint64_t key, int vertex) const;
+    void removeBonds(const std::vector<uint8_t>& broken);
+    void createRequested();
+    void projectRange(int begin, int end, float alphaTilde);
+};
+
+} // namespace micro_idle
+
+#endif
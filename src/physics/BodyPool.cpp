@@ -0,0 +1,48 @@
+#include "BodyPool.h"
+
+#include <Jolt/Physics/Body/BodyInterface.h>
+
+namespace micro_idle {
+
+JPH::BodyID BodyPool::acquire(const void* key) {
+    auto it = byKey.find(key);
+    if (it == byKey.end() || it->second.empty()) {
+        return JPH::BodyID();
+    }
+    JPH::BodyID id = it->second.back();
+    it->second.pop_back();
+    total--;
+    reused++;
+    return id;
+}
+
+void BodyPool::release(JPH::BodyInterface& bodies, const void* key, JPH::BodyID id) {
+    if (id.IsInvalid()) {
+        return;
+    }
+    bodies.RemoveBody(id);
+
+    if (key == nullptr || total >= MaxBodies) {
+        bodies.DestroyBody(id);
+        return;
+    }
+    std::vector<JPH::BodyID>& pooled = byKey[key];
+    if ((int)pooled.size() >= MaxPerKey) {
+        bodies.DestroyBody(id);
+        return;
+    }
+    pooled.push_back(id);
+    total++;
+}
+
+void BodyPool::clear(JPH::BodyInterface& bodies) {
+    for (auto& [key, pooled] : byKey) {
+        for (JPH::BodyID id : pooled) {
+            bodies.DestroyBody(id);
+        }
+    }
+    byKey.clear();
+    total = 0;
+}
+
+} // namespace micro_idle
@@ -0,0 +1,48 @@
+#ifndef MICRO_IDLE_BODY_POOL_H
+#define MICRO_IDLE_BODY_POOL_H
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/BodyID.h>
+#include <unordered_map>
+#include <vector>
+
+namespace JPH {
+class BodyInterface;
+}
+
+namespace micro_idle {
+
+/**
+ * Jolt bodies that were removed from the simulation but not destroyed
+ *
+ * Bodies are grouped by a key (for soft bodies, their shared settings): a body
+ * taken back out has that key's shape and constraint topology and only needs
+ * its state reset, which is far cheaper than creating one. Pooled bodies are
+ * out of the broad phase and cost nothing per step. One pool per physics world.
+ */
+class BodyPool {
+public:
+    static constexpr int MaxPerKey = 8;
+    static constexpr int MaxBodies = 64;
+
+    // A pooled body with this key (not in the simulation), or an invalid id
+    JPH::BodyID acquire(const void* key);
+
+    // Remove the body from the simulation and keep it, or destroy it when the pool is full
+    void release(JPH::BodyInterface& bodies, const void* key, JPH::BodyID id);
+
+    // Destroy every pooled body (before the physics system goes away)
+    void clear(JPH::BodyInterface& bodies);
+
+    int size() const { return total; }
+    int getReuseCount() const { return reused; }
+
+private:
+    std::unordered_map<const void*, std::vector<JPH::BodyID>> byKey;   // Newest last
+    int total{0};
+    int reused{0};
+};
+
+} // namespace micro_idle
+
+#endif
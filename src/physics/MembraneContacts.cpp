@@ -0,0 +1,385 @@
+#include "MembraneContacts.h"
+#include "src/math/Simd.h"
+#include "src/physics/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace micro_idle {
+
+namespace {
+
+using math::Float8;
+using math::Mask8;
+
+constexpr float FarAway = 1e9f;             // Padding lane position
+constexpr float Epsilon = 1e-6f;
+constexpr int ChunkSize = 256;              // Vertices per job
+constexpr float FourPi = 12.5663706144f;
+
+alignas(32) const float LaneIndex[Float8::Width] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+
+int cellCoord(float v, float invCell) {
+    return (int)std::floor(v * invCell);
+}
+
+} // namespace
+
+MembraneContacts::MembraneContacts() {
+    setLayerPair(2, 2, true);
+}
+
+void MembraneContacts::setLayerPair(int layerA, int layerB, bool enabled) {
+    if (layerA < 0 || layerB < 0 || layerA >= MaxLayers || layerB >= MaxLayers) {
+        return;
+    }
+    if (enabled) {
+        layerPairs[layerA] |= (uint8_t)(1u << layerB);
+        layerPairs[layerB] |= (uint8_t)(1u << layerA);
+    } else {
+        layerPairs[layerA] &= (uint8_t)~(1u << layerB);
+        layerPairs[layerB] &= (uint8_t)~(1u << layerA);
+    }
+}
+
+bool MembraneContacts::isLayerPairEnabled(int layerA, int layerB) const {
+    if (layerA < 0 || layerB < 0 || layerA >= MaxLayers || layerB >= MaxLayers) {
+        return false;
+    }
+    return (layerPairs[layerA] & (1u << layerB)) != 0;
+}
+
+void MembraneContacts::clear() {
+    count = 0;
+    membranes = 0;
+    maxSpacing = 0.0f;
+    px.clear();
+    py.clear();
+    pz.clear();
+    nx.clear();
+    ny.clear();
+    nz.clear();
+    owner.clear();
+    layer.clear();
+    mobility.clear();
+}
+
+int MembraneContacts::addMembrane(int membraneLayer, float membraneMobility,
+                                  const Vector3* positions, const Vector3* normals, int vertexCount) {
+    int first = count;
+    if (vertexCount <= 0) {
+        return first;
+    }
+
+    float centerX = 0.0f;
+    float centerY = 0.0f;
+    float centerZ = 0.0f;
+    for (int i = 0; i < vertexCount; i++) {
+        centerX += positions[i].x;
+        centerY += positions[i].y;
+        centerZ += positions[i].z;
+    }
+    float inv = 1.0f / (float)vertexCount;
+    centerX *= inv;
+    centerY *= inv;
+    centerZ *= inv;
+
+    float meanDistance = 0.0f;
+    float id = (float)membranes;
+    float layerValue = (float)membraneLayer;
+    float mob = std::max(membraneMobility, 0.0f);
+    for (int i = 0; i < vertexCount; i++) {
+        Vector3 p = positions[i];
+        float dx = p.x - centerX;
+        float dy = p.y - centerY;
+        float dz = p.z - centerZ;
+        float len = std::sqrt(dx * dx + dy * dy + dz * dz);
+        meanDistance += len;
+
+        Vector3 n{dx, dy, dz};
+        if (normals) {
+            n = normals[i];
+            len = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+        }
+        float invLen = len > Epsilon ? 1.0f / len : 0.0f;
+
+        px.push_back(p.x);
+        py.push_back(p.y);
+        pz.push_back(p.z);
+        nx.push_back(n.x * invLen);
+        ny.push_back(n.y * invLen);
+        nz.push_back(n.z * invLen);
+        owner.push_back(id);
+        layer.push_back(layerValue);
+        mobility.push_back(mob);
+    }
+
+    // Mean vertex spacing of a sphere with this many vertices: the search radius
+    // has to reach at least one vertex of any membrane a vertex has crossed
+    meanDistance *= inv;
+    maxSpacing = std::max(maxSpacing, meanDistance * std::sqrt(FourPi / (float)vertexCount));
+
+    count += vertexCount;
+    membranes++;
+    return first;
+}
+
+int MembraneContacts::bucketOf(int ix, int iy, int iz) const {
+    uint32_t h = (uint32_t)ix * 73856093u ^ (uint32_t)iy * 19349663u ^ (uint32_t)iz * 83492791u;
+    return (int)(h & (uint32_t)(bucketStart.size() - 2));
+}
+
+void MembraneContacts::buildHash() {
+    int buckets = 1;
+    while (buckets < count * 2) {
+        buckets <<= 1;
+    }
+    bucketStart.assign((size_t)buckets + 1, 0);
+    bucketCursor.resize((size_t)buckets);
+    vertexBucket.resize((size_t)count);
+
+    // Counting sort by bucket, so each bucket's vertices are contiguous
+    float invCell = 1.0f / searchRadius;
+    for (int i = 0; i < count; i++) {
+        size_t k = (size_t)i;
+        int b = bucketOf(cellCoord(px[k], invCell), cellCoord(py[k], invCell), cellCoord(pz[k], invCell));
+        vertexBucket[k] = b;
+        bucketStart[(size_t)b + 1]++;
+    }
+    for (int b = 0; b < buckets; b++) {
+        bucketStart[(size_t)b + 1] += bucketStart[(size_t)b];
+        bucketCursor[(size_t)b] = bucketStart[(size_t)b];
+    }
+
+    size_t padded = (size_t)count + Float8::Width;
+    sx.assign(padded, FarAway);
+    sy.assign(padded, FarAway);
+    sz.assign(padded, FarAway);
+    snx.assign(padded, 0.0f);
+    sny.assign(padded, 0.0f);
+    snz.assign(padded, 0.0f);
+    sowner.assign(padded, -1.0f);
+    slayer.assign(padded, -1.0f);
+    smobility.assign(padded, 0.0f);
+    sindex.assign(padded, 0.0f);
+    for (int i = 0; i < count; i++) {
+        size_t k = (size_t)i;
+        size_t at = (size_t)bucketCursor[(size_t)vertexBucket[k]]++;
+        sx[at] = px[k];
+        sy[at] = py[k];
+        sz[at] = pz[k];
+        snx[at] = nx[k];
+        sny[at] = ny[k];
+        snz[at] = nz[k];
+        sowner[at] = owner[k];
+        slayer[at] = layer[k];
+        smobility[at] = mobility[k];
+        sindex[at] = (float)i;
+    }
+}
+
+int MembraneContacts::solveRange(int begin, int end) {
+    const float r = searchRadius;
+    const float invCell = 1.0f / r;
+    const Float8 radius = Float8::broadcast(r);
+    const Float8 radius2 = Float8::broadcast(r * r);
+    const Float8 invRadius2 = Float8::broadcast(1.0f / (r * r));
+    const Float8 gap = Float8::broadcast(thickness);
+    const Float8 one = Float8::broadcast(1.0f);
+    const Float8 half = Float8::broadcast(0.5f);
+    const Float8 zero = Float8::zero();
+    const Float8 tiny = Float8::broadcast(Epsilon);
+    const Float8 lanes = Float8::load(LaneIndex);
+    const Float8 farAway = Float8::broadcast(FarAway);
+
+    int pushed = 0;
+    for (int i = begin; i < end; i++) {
+        size_t k = (size_t)i;
+        cx[k] = 0.0f;
+        cy[k] = 0.0f;
+        cz[k] = 0.0f;
+        int ownLayer = (int)layer[k];
+        uint8_t collides = ownLayer >= 0 && ownLayer < MaxLayers ? layerPairs[ownLayer] : 0;
+        if (mobility[k] <= 0.0f || collides == 0) {
+            continue;
+        }
+
+        // The 27 cells around the vertex, deduplicated: two cells may share a bucket
+        int cellX = cellCoord(px[k], invCell);
+        int cellY = cellCoord(py[k], invCell);
+        int cellZ = cellCoord(pz[k], invCell);
+        int buckets[27];
+        int bucketCount = 0;
+        for (int dz = -1; dz <= 1; dz++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    buckets[bucketCount++] = bucketOf(cellX + dx, cellY + dy, cellZ + dz);
+                }
+            }
+        }
+        std::sort(buckets, buckets + bucketCount);
+        bucketCount = (int)(std::unique(buckets, buckets + bucketCount) - buckets);
+
+        const Float8 ax = Float8::broadcast(px[k]);
+        const Float8 ay = Float8::broadcast(py[k]);
+        const Float8 az = Float8::broadcast(pz[k]);
+        const Float8 self = Float8::broadcast(owner[k]);
+        const Float8 mob = Float8::broadcast(mobility[k]);
+
+        Float8 weight = zero;
+        Float8 nearest2 = farAway;          // Closest contacting neighbour, for contact events
+        Float8 nearest = zero;
+        Float8 sumX = zero;
+        Float8 sumY = zero;
+        Float8 sumZ = zero;
+        for (int b = 0; b < bucketCount; b++) {
+            int start = bucketStart[(size_t)buckets[b]];
+            int stop = bucketStart[(size_t)buckets[b] + 1];
+            for (int j = start; j < stop; j += Float8::Width) {
+                size_t at = (size_t)j;
+                Float8 dx = Float8::load(&sx[at]) - ax;
+                Float8 dy = Float8::load(&sy[at]) - ay;
+                Float8 dz = Float8::load(&sz[at]) - az;
+                Float8 d2 = dx * dx + dy * dy + dz * dz;
+                Mask8 valid = (lanes < Float8::broadcast((float)(stop - j))) & (d2 < radius2) &
+                              (math::abs(Float8::load(&sowner[at]) - self) > half);
+                if (valid.bits() == 0) {
+                    continue;
+                }
+
+                Float8 otherLayer = Float8::load(&slayer[at]);
+                Mask8 layerOk = zero > one;
+                for (int l = 0; l < MaxLayers; l++) {
+                    if (collides & (1u << l)) {
+                        layerOk = layerOk | (math::abs(otherLayer - Float8::broadcast((float)l)) < half);
+                    }
+                }
+
+                // How far the vertex sits behind the neighbour's tangent plane (plus the gap)
+                Float8 bnx = Float8::load(&snx[at]);
+                Float8 bny = Float8::load(&sny[at]);
+                Float8 bnz = Float8::load(&snz[at]);
+                Float8 depth = math::min(dx * bnx + dy * bny + dz * bnz + gap, radius);
+                valid = valid & layerOk & (depth > zero);
+                if (valid.bits() == 0) {
+                    continue;
+                }
+
+                // Nearer neighbours count more; the less mobile side takes less of the push
+                Float8 share = mob / math::max(mob + Float8::load(&smobility[at]), tiny);
+                Float8 w = math::select(valid, one - d2 * invRadius2, zero);
+                Float8 push = w * depth * share;
+                weight = weight + w;
+                Mask8 closer = valid & (d2 < nearest2);
+                nearest2 = math::select(closer, d2, nearest2);
+                nearest = math::select(closer, Float8::load(&sindex[at]), nearest);
+                sumX = math::fmadd(push, bnx, sumX);
+                sumY = math::fmadd(push, bny, sumY);
+                sumZ = math::fmadd(push, bnz, sumZ);
+            }
+        }
+
+        float total = math::hsum(weight);
+        if (total <= Epsilon) {
+            continue;
+        }
+        float scale = stiffness / total;
+        cx[k] = math::hsum(sumX) * scale;
+        cy[k] = math::hsum(sumY) * scale;
+        cz[k] = math::hsum(sumZ) * scale;
+        pushed++;
+
+        if (partner[k] < 0) {
+            alignas(32) float laneD2[Float8::Width];
+            alignas(32) float laneIndex[Float8::Width];
+            nearest2.store(laneD2);
+            nearest.store(laneIndex);
+            int best = 0;
+            for (int lane = 1; lane < Float8::Width; lane++) {
+                if (laneD2[lane] < laneD2[best]) {
+                    best = lane;
+                }
+            }
+            partner[k] = (int)laneIndex[best];
+        }
+    }
+    return pushed;
+}
+
+int MembraneContacts::solve(JPH::JobSystem* jobs) {
+    lastContacts = 0;
+    ox = px;
+    oy = py;
+    oz = pz;
+    partner.assign((size_t)count, -1);
+    if (membranes < 2) {
+        return 0;
+    }
+
+    searchRadius = std::max(minSearchRadius, maxSpacing);
+    cx.resize((size_t)count);
+    cy.resize((size_t)count);
+    cz.resize((size_t)count);
+
+    // Fixed chunks, so the split (and the result) is the same for any thread count
+    int chunks = (count + ChunkSize - 1) / ChunkSize;
+    std::vector<int> chunkPushed((size_t)chunks, 0);
+    for (int iteration = 0; iteration < iterations; iteration++) {
+        buildHash();
+        parallelFor(jobs, chunks, [&](int c) {
+            int begin = c * ChunkSize;
+            chunkPushed[(size_t)c] = solveRange(begin, std::min(begin + ChunkSize, count));
+        });
+
+        int pushed = 0;
+        for (int c = 0; c < chunks; c++) {
+            pushed += chunkPushed[(size_t)c];
+        }
+        if (pushed == 0) {
+            break;
+        }
+        for (size_t k = 0; k < (size_t)count; k++) {
+            px[k] += cx[k];
+            py[k] += cy[k];
+            pz[k] += cz[k];
+        }
+    }
+
+    for (size_t k = 0; k < (size_t)count; k++) {
+        if (px[k] != ox[k] || py[k] != oy[k] || pz[k] != oz[k]) {
+            lastContacts++;
+        }
+    }
+    return lastContacts;
+}
+
+Vector3 MembraneContacts::getPosition(int vertex) const {
+    if (vertex < 0 || vertex >= count) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    size_t k = (size_t)vertex;
+    return {px[k], py[k], pz[k]};
+}
+
+int MembraneContacts::getContact(int vertex) const {
+    if (vertex < 0 || vertex >= (int)partner.size()) {
+        return -1;
+    }
+    return partner[(size_t)vertex];
+}
+
+int MembraneContacts::getMembraneOf(int vertex) const {
+    if (vertex < 0 || vertex >= count) {
+        return -1;
+    }
+    return (int)owner[(size_t)vertex];
+}
+
+Vector3 MembraneContacts::getDisplacement(int vertex) const {
+    if (vertex < 0 || vertex >= count || ox.size() != (size_t)count) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    size_t k = (size_t)vertex;
+    return {px[k] - ox[k], py[k] - oy[k], pz[k] - oz[k]};
+}
+
+} // namespace micro_idle
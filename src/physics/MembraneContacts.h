@@ -0,0 +1,110 @@
+#ifndef MICRO_IDLE_MEMBRANE_CONTACTS_H
+#define MICRO_IDLE_MEMBRANE_CONTACTS_H
+
+#include <cstdint>
+#include <vector>
+#include "raylib.h"
+
+namespace JPH {
+class JobSystem;
+}
+
+namespace micro_idle {
+
+/**
+ * Soft-soft contact stage for membranes (Jolt soft bodies only collide with rigid bodies)
+ *
+ * The host adds every membrane's world-space vertices each step, then solve()
+ * hashes them into a 3D grid and pushes each vertex out of any other membrane
+ * it has crossed. The other membrane is approximated locally by the tangent
+ * planes of its nearby vertices, offset by `thickness`; corrections from all
+ * neighbours within the search radius are blended with a distance falloff.
+ *
+ * Each vertex only writes its own correction (a Jacobi pass), so vertex chunks
+ * run as independent jobs and the result does not depend on the thread count.
+ * The correction is split between the two membranes by mobility: a membrane
+ * with mobility 0 (asleep, or pinned) is not moved and the other takes it all.
+ *
+ * Membranes collide when the pair of their object layers is enabled.
+ */
+class MembraneContacts {
+public:
+    static constexpr int MaxLayers = 8;
+
+    MembraneContacts();
+
+    // Symmetric; only SKIN-SKIN (layer 2) is enabled by default
+    void setLayerPair(int layerA, int layerB, bool enabled);
+    bool isLayerPairEnabled(int layerA, int layerB) const;
+
+    void clear();
+
+    /**
+     * Add one membrane's vertices for this step
+     *
+     * @param normals Outward vertex normals, or nullptr to point them away
+     *        from the membrane's centroid
+     * @return Index of the membrane's first vertex
+     */
+    int addMembrane(int layer, float mobility, const Vector3* positions, const Vector3* normals, int count);
+
+    /**
+     * Resolve penetrations between the added membranes
+     *
+     * @param jobs Job system to spread vertex chunks over (null runs inline)
+     * @return Number of vertices that were pushed
+     */
+    int solve(JPH::JobSystem* jobs);
+
+    // Total correction of a vertex from the last solve(), and where that left it
+    Vector3 getDisplacement(int vertex) const;
+    Vector3 getPosition(int vertex) const;
+
+    // Contact event of the last solve(): the nearest vertex of another membrane
+    // that pushed this one, or -1 if it was not in contact
+    int getContact(int vertex) const;
+
+    // Membrane a vertex belongs to, in the order membranes were added
+    int getMembraneOf(int vertex) const;
+
+    int getVertexCount() const { return count; }
+    int getMembraneCount() const { return membranes; }
+    int getLastContactCount() const { return lastContacts; }
+    float getLastSearchRadius() const { return searchRadius; }
+
+    float thickness{0.02f};         // Gap kept between membranes
+    float stiffness{0.8f};          // Fraction of the penetration removed per iteration
+    float minSearchRadius{0.1f};    // Neighbour radius floor; grows with vertex spacing
+    int iterations{2};
+
+private:
+    int count{0};
+    int membranes{0};
+    int lastContacts{0};
+    float searchRadius{0.0f};
+    float maxSpacing{0.0f};
+    uint8_t layerPairs[MaxLayers]{};    // Bit b of entry a: layers a and b collide
+
+    // Per vertex, in the order added
+    std::vector<float> px, py, pz;
+    std::vector<float> ox, oy, oz;      // Positions when added
+    std::vector<float> nx, ny, nz;
+    std::vector<float> owner, layer, mobility;   // Floats so they compare in Float8 lanes
+    std::vector<float> cx, cy, cz;      // Correction of the current iteration
+    std::vector<int> partner;           // Contact event per vertex (-1 = none)
+
+    // Vertices sorted by hash bucket, padded by a Float8 of far-away entries
+    std::vector<int> bucketStart;
+    std::vector<int> bucketCursor;
+    std::vector<int> vertexBucket;
+    std::vector<float> sx, sy, sz, snx, sny, snz, sowner, slayer, smobility;
+    std::vector<float> sindex;          // Vertex each sorted entry came from
+
+    void buildHash();
+    int solveRange(int begin, int end);
+    int bucketOf(int ix, int iy, int iz) const;
+};
+
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,34 @@
+#include "ParallelFor.h"
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystem.h>
+
+namespace micro_idle {
+
+void parallelFor(JPH::JobSystem* jobs, int jobCount, const std::function<void(int)>& fn) {
+    if (jobCount <= 0) {
+        return;
+    }
+    if (!jobs || jobCount == 1) {
+        for (int i = 0; i < jobCount; i++) {
+            fn(i);
+        }
+        return;
+    }
+
+    // The pool has a fixed job budget shared with physics; fold large counts into
+    // strided batches instead of one Jolt job per index
+    int batches = jobCount < ParallelForMaxJobs ? jobCount : ParallelForMaxJobs;
+    JPH::JobSystem::Barrier* barrier = jobs->CreateBarrier();
+    for (int b = 0; b < batches; b++) {
+        JPH::JobHandle handle = jobs->CreateJob("ParallelFor", JPH::Color::sGreen, [&fn, b, batches, jobCount]() {
+            for (int i = b; i < jobCount; i += batches) {
+                fn(i);
+            }
+        });
+        barrier->AddJob(handle);
+    }
+    jobs->WaitForJobs(barrier);
+    jobs->DestroyBarrier(barrier);
+}
+
+} // namespace micro_idle
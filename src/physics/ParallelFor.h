@@ -0,0 +1,29 @@
+#ifndef MICRO_IDLE_PARALLEL_FOR_H
+#define MICRO_IDLE_PARALLEL_FOR_H
+
+#include <functional>
+
+namespace JPH {
+class JobSystem;
+}
+
+namespace micro_idle {
+
+// Most Jolt jobs one parallelFor call holds at once; larger counts are batched
+constexpr int ParallelForMaxJobs = 256;
+
+/**
+ * Run fn(0) .. fn(jobCount - 1) on Jolt's job system and wait for all of them
+ *
+ * Reuses the physics worker threads between physics steps, so gameplay batch work
+ * does not need a thread pool of its own. The calling thread helps execute jobs.
+ * Runs inline when jobs is null or there is only one job.
+ *
+ * Results must not depend on which thread runs a job: split work into a fixed
+ * number of chunks (not one per thread) when the output has to be deterministic.
+ */
+void parallelFor(JPH::JobSystem* jobs, int jobCount, const std::function<void(int)>& fn);
+
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,110 @@
+#include "PhysicsRuntime.h"
+#include "ParallelFor.h"
+#include <Jolt/Jolt.h>
+#include <Jolt/RegisterTypes.h>
+#include <Jolt/Core/Factory.h>
+#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/TempAllocator.h>
+#include <Jolt/Physics/PhysicsSettings.h>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Jolt uses callbacks for trace and asserts
+static void TraceImpl(const char* inFMT, ...) {
+    (void)inFMT;
+}
+
+#ifdef JPH_ENABLE_ASSERTS
+static bool AssertFailedImpl(const char* inExpression, const char* inMessage, const char* inFile, JPH::uint inLine) {
+    (void)inExpression;
+    (void)inMessage;
+    (void)inFile;
+    (void)inLine;
+    return true; // Trigger breakpoint
+}
+#endif
+
+namespace micro_idle {
+namespace PhysicsRuntime {
+
+namespace {
+
+std::once_flag joltOnce;
+std::once_flag poolOnce;
+JPH::JobSystemThreadPool* pool = nullptr;
+
+std::mutex tempMutex;
+std::vector<std::pair<size_t, JPH::TempAllocatorImpl*>> freeTempAllocators;
+
+} // namespace
+
+void ensureInitialized() {
+    std::call_once(joltOnce, []() {
+        // Register allocation hook
+        JPH::RegisterDefaultAllocator();
+
+        // Install callbacks
+        JPH::Trace = TraceImpl;
+#ifdef JPH_ENABLE_ASSERTS
+        JPH::AssertFailed = AssertFailedImpl;
+#endif
+
+        // Register all Jolt physics types. Never torn down: bodies of any live
+        // world may reference the registered types until the process exits.
+        JPH::Factory::sInstance = new JPH::Factory();
+        JPH::RegisterTypes();
+    });
+}
+
+JPH::JobSystemThreadPool* jobSystem() {
+    ensureInitialized();
+    std::call_once(poolOnce, []() {
+        // Jolt asserts and stalls when it runs out of either, so both scale with
+        // the worlds that can step at once. Job pages are only allocated when used.
+        int threads = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+        pool = new JPH::JobSystemThreadPool((JPH::cMaxPhysicsJobs + ParallelForMaxJobs) * MaxConcurrentWorlds,
+                                            (JPH::cMaxPhysicsBarriers + 1) * MaxConcurrentWorlds,
+                                            threads);
+    });
+    return pool;
+}
+
+int workerCount() {
+    return jobSystem()->GetMaxConcurrency();
+}
+
+JPH::TempAllocatorImpl* acquireTempAllocator(size_t bytes) {
+    ensureInitialized();
+    {
+        std::lock_guard<std::mutex> lock(tempMutex);
+        for (size_t i = 0; i < freeTempAllocators.size(); i++) {
+            if (freeTempAllocators[i].first == bytes) {
+                JPH::TempAllocatorImpl* allocator = freeTempAllocators[i].second;
+                freeTempAllocators[i] = freeTempAllocators.back();
+                freeTempAllocators.pop_back();
+                return allocator;
+            }
+        }
+    }
+    return new JPH::TempAllocatorImpl((JPH::uint)bytes);
+}
+
+void releaseTempAllocator(JPH::TempAllocatorImpl* allocator, size_t bytes) {
+    if (!allocator) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(tempMutex);
+        if ((int)freeTempAllocators.size() < MaxConcurrentWorlds) {
+            freeTempAllocators.push_back({bytes, allocator});
+            return;
+        }
+    }
+    delete allocator;
+}
+
+} // namespace PhysicsRuntime
+} // namespace micro_idle
@@ -0,0 +1,49 @@
+#ifndef MICRO_IDLE_PHYSICS_RUNTIME_H
+#define MICRO_IDLE_PHYSICS_RUNTIME_H
+
+#include <cstddef>
+
+namespace JPH {
+class JobSystemThreadPool;
+class TempAllocatorImpl;
+}
+
+namespace micro_idle {
+
+/**
+ * Process-wide Jolt state shared by every PhysicsSystemState (one per World)
+ *
+ * Jolt's allocator hooks, trace/assert callbacks and type factory are globals,
+ * so they are set up exactly once and live until the process exits. Creating
+ * and destroying worlds never touches them, which lets several worlds exist
+ * and step at the same time.
+ */
+namespace PhysicsRuntime {
+
+    // Upper bounds for the shared pool: every world stepping concurrently holds
+    // its own physics barriers and jobs, plus one parallelFor batch between
+    // steps. WorldGroup never steps more worlds than this at once.
+    constexpr int MaxConcurrentWorlds = 32;
+
+    // Idempotent and thread-safe; called by every PhysicsSystemState constructor
+    void ensureInitialized();
+
+    // Worker pool shared by all worlds (physics steps and parallelFor batches).
+    // Created on first use with hardware_concurrency - 1 workers.
+    JPH::JobSystemThreadPool* jobSystem();
+
+    // Threads that execute jobs, including the thread waiting on them
+    int workerCount();
+
+    // Per-world scratch allocators are recycled: a fresh block per world
+    // dominated World construction. Acquire returns a pooled allocator of the
+    // same size if one is free; release returns it to the pool (or frees it
+    // once MaxConcurrentWorlds are pooled). The allocator must be empty.
+    JPH::TempAllocatorImpl* acquireTempAllocator(size_t bytes);
+    void releaseTempAllocator(JPH::TempAllocatorImpl* allocator, size_t bytes);
+
+} // namespace PhysicsRuntime
+
+} // namespace micro_idle
+
+#endif
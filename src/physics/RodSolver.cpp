@@ -0,0 +1,357 @@
+#include "RodSolver.h"
+#include "src/math/Simd.h"
+#include "src/math/Vec3x8.h"
+#include "src/physics/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace micro_idle {
+
+namespace {
+
+using math::Float8;
+using math::Vec3x8;
+
+constexpr float TwoPi = 6.28318530718f;
+constexpr float Epsilon = 1e-6f;
+
+// Eight quaternions, one per rod
+struct Quat8 {
+    Float8 x, y, z, w;
+
+    static Quat8 load(const std::vector<float>& qx, const std::vector<float>& qy,
+                      const std::vector<float>& qz, const std::vector<float>& qw, size_t at) {
+        return {Float8::load(&qx[at]), Float8::load(&qy[at]), Float8::load(&qz[at]), Float8::load(&qw[at])};
+    }
+
+    void store(std::vector<float>& qx, std::vector<float>& qy,
+               std::vector<float>& qz, std::vector<float>& qw, size_t at) const {
+        x.store(&qx[at]);
+        y.store(&qy[at]);
+        z.store(&qz[at]);
+        w.store(&qw[at]);
+    }
+
+    Quat8 conjugate() const { return {-x, -y, -z, w}; }
+    Quat8 operator+(const Quat8& o) const { return {x + o.x, y + o.y, z + o.z, w + o.w}; }
+    Quat8 operator*(const Float8& s) const { return {x * s, y * s, z * s, w * s}; }
+
+    Quat8 normalized() const {
+        Float8 inv = Float8::broadcast(1.0f) / math::sqrt(x * x + y * y + z * z + w * w);
+        return *this * inv;
+    }
+
+    // Third director: the segment's tangent, q * (0, 0, 1)
+    Vec3x8 tangent() const {
+        return {
+            (x * z + w * y) * 2.0f,
+            (y * z - w * x) * 2.0f,
+            w * w - x * x - y * y + z * z
+        };
+    }
+};
+
+Quat8 mul(const Quat8& a, const Quat8& b) {
+    return {
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+}
+
+// Rotation by the vector (0, bend, twist) in the segment frame: bending about
+// the frame's up axis keeps rods in the dish plane, twist spins about the tangent
+void restDarboux(float bend, float twist, float& x, float& y, float& z, float& w) {
+    float angle = std::sqrt(bend * bend + twist * twist);
+    if (angle < Epsilon) {
+        x = y = z = 0.0f;
+        w = 1.0f;
+        return;
+    }
+    float s = std::sin(angle * 0.5f) / angle;
+    x = 0.0f;
+    y = bend * s;
+    z = twist * s;
+    w = std::cos(angle * 0.5f);
+}
+
+} // namespace
+
+int RodSolver::addRod(const RodParams& params, Vector3 anchor, Vector3 direction) {
+    int nodes = std::max(params.nodes, 2);
+
+    // First packet with the same node count and a free lane, else a new one
+    size_t p = 0;
+    while (p < packets.size() && (packets[p].nodes != nodes || packets[p].used == (1 << Lanes) - 1)) {
+        p++;
+    }
+    if (p == packets.size()) {
+        Packet packet;
+        packet.nodes = nodes;
+        size_t nodeFloats = (size_t)nodes * Lanes;
+        size_t segFloats = (size_t)(nodes - 1) * Lanes;
+        size_t innerFloats = (size_t)std::max(nodes - 2, 1) * Lanes;
+        for (auto* v : {&packet.px, &packet.py, &packet.pz, &packet.ox, &packet.oy, &packet.oz,
+                        &packet.vx, &packet.vy, &packet.vz}) {
+            v->assign(nodeFloats, 0.0f);
+        }
+        // Empty lanes hold identity frames so normalisation never sees a zero quaternion
+        packet.qx.assign(segFloats, 0.0f);
+        packet.qy.assign(segFloats, 0.0f);
+        packet.qz.assign(segFloats, 0.0f);
+        packet.qw.assign(segFloats, 1.0f);
+        packet.rx.assign(innerFloats, 0.0f);
+        packet.ry.assign(innerFloats, 0.0f);
+        packet.rz.assign(innerFloats, 0.0f);
+        packet.rw.assign(innerFloats, 1.0f);
+        std::fill(std::begin(packet.anchorQw), std::end(packet.anchorQw), 1.0f);
+        packets.push_back(std::move(packet));
+    }
+
+    Packet& packet = packets[p];
+    int lane = 0;
+    while (packet.used & (1 << lane)) {
+        lane++;
+    }
+    packet.used |= 1 << lane;
+
+    float length = std::max(params.length, Epsilon);
+    float segment = length / (float)(nodes - 1);
+    packet.mass[lane] = 1.0f;
+    packet.segLength[lane] = segment;
+    packet.stretchK[lane] = std::clamp(params.stretchStiffness, 0.0f, 1.0f);
+    packet.bendK[lane] = std::clamp(params.bendStiffness, 0.0f, 1.0f);
+    packet.twistK[lane] = std::clamp(params.twistStiffness, 0.0f, 1.0f);
+    packet.damping[lane] = std::clamp(params.damping, 0.0f, 1.0f);
+    packet.bendRate[lane] = params.curvature / length;
+    packet.twistRate[lane] = params.twist / length;
+    packet.beatRate[lane] = params.beatAmplitude / length;
+    packet.beatOmega[lane] = TwoPi * params.beatFrequency;
+    packet.beatK[lane] = TwoPi / (std::max(params.beatWavelength, Epsilon) * length);
+    packet.beatPhase[lane] = params.phase;
+
+    // Handle first so setAnchor can find the lane
+    int handle;
+    if (!freeHandles.empty()) {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+    } else {
+        handle = (int)slots.size();
+        slots.push_back(-1);
+    }
+    slots[(size_t)handle] = (int)p * Lanes + lane;
+    liveRods++;
+    setAnchor(handle, anchor, direction);
+
+    // Start straight along the anchor direction, at rest
+    float dx = packet.anchorQy[lane] * packet.anchorQw[lane] * 2.0f;
+    float dz = packet.anchorQw[lane] * packet.anchorQw[lane] - packet.anchorQy[lane] * packet.anchorQy[lane];
+    for (int i = 0; i < nodes; i++) {
+        size_t k = (size_t)i * Lanes + (size_t)lane;
+        packet.px[k] = packet.ox[k] = anchor.x + dx * segment * (float)i;
+        packet.py[k] = packet.oy[k] = anchor.y;
+        packet.pz[k] = packet.oz[k] = anchor.z + dz * segment * (float)i;
+        packet.vx[k] = packet.vy[k] = packet.vz[k] = 0.0f;
+    }
+    for (int s = 0; s < nodes - 1; s++) {
+        size_t k = (size_t)s * Lanes + (size_t)lane;
+        packet.qx[k] = 0.0f;
+        packet.qy[k] = packet.anchorQy[lane];
+        packet.qz[k] = 0.0f;
+        packet.qw[k] = packet.anchorQw[lane];
+    }
+    for (int j = 1; j < nodes - 1; j++) {
+        size_t k = (size_t)(j - 1) * Lanes + (size_t)lane;
+        restDarboux(segment * packet.bendRate[lane], segment * packet.twistRate[lane],
+                    packet.rx[k], packet.ry[k], packet.rz[k], packet.rw[k]);
+    }
+    return handle;
+}
+
+void RodSolver::removeRod(int rod) {
+    if (!isAlive(rod)) {
+        return;
+    }
+    int slot = slots[(size_t)rod];
+    Packet& packet = packets[(size_t)(slot / Lanes)];
+    int lane = slot % Lanes;
+
+    // An empty lane keeps stepping with zero inverse mass, so it never moves
+    packet.used &= ~(1 << lane);
+    packet.mass[lane] = 0.0f;
+    packet.beatRate[lane] = 0.0f;
+    for (int i = 0; i < packet.nodes; i++) {
+        size_t k = (size_t)i * Lanes + (size_t)lane;
+        packet.vx[k] = packet.vy[k] = packet.vz[k] = 0.0f;
+    }
+
+    slots[(size_t)rod] = -1;
+    freeHandles.push_back(rod);
+    liveRods--;
+}
+
+bool RodSolver::isAlive(int rod) const {
+    return rod >= 0 && rod < (int)slots.size() && slots[(size_t)rod] >= 0;
+}
+
+void RodSolver::setAnchor(int rod, Vector3 anchor, Vector3 direction) {
+    if (!isAlive(rod)) {
+        return;
+    }
+    int slot = slots[(size_t)rod];
+    Packet& packet = packets[(size_t)(slot / Lanes)];
+    int lane = slot % Lanes;
+
+    packet.anchorX[lane] = anchor.x;
+    packet.anchorY[lane] = anchor.y;
+    packet.anchorZ[lane] = anchor.z;
+
+    // Yaw that turns the frame's tangent (+Z) onto the direction; up stays up
+    float yaw = (direction.x * direction.x + direction.z * direction.z) > Epsilon
+        ? std::atan2(direction.x, direction.z)
+        : 0.0f;
+    packet.anchorQy[lane] = std::sin(yaw * 0.5f);
+    packet.anchorQw[lane] = std::cos(yaw * 0.5f);
+}
+
+RodView RodSolver::getRod(int rod) const {
+    if (!isAlive(rod)) {
+        return {};
+    }
+    int slot = slots[(size_t)rod];
+    const Packet& packet = packets[(size_t)(slot / Lanes)];
+    int lane = slot % Lanes;
+    return {&packet.px[(size_t)lane], &packet.py[(size_t)lane], &packet.pz[(size_t)lane], packet.nodes, Lanes};
+}
+
+void RodSolver::step(float dt, JPH::JobSystem* jobs) {
+    if (liveRods == 0 || dt <= 0.0f) {
+        return;
+    }
+    parallelFor(jobs, (int)packets.size(), [&](int p) {
+        if (packets[(size_t)p].used != 0) {
+            stepPacket(packets[(size_t)p], dt);
+        }
+    });
+}
+
+void RodSolver::updateRestShape(Packet& packet) {
+    // Only beating rods change shape; static ones were set up in addRod
+    for (int lane = 0; lane < Lanes; lane++) {
+        if (packet.beatRate[lane] == 0.0f) {
+            continue;
+        }
+        float segment = packet.segLength[lane];
+        float phase = packet.beatOmega[lane] * packet.time + packet.beatPhase[lane];
+        for (int j = 1; j < packet.nodes - 1; j++) {
+            float s = segment * (float)j;
+            float rate = packet.bendRate[lane] + packet.beatRate[lane] * std::sin(phase - packet.beatK[lane] * s);
+            size_t k = (size_t)(j - 1) * Lanes + (size_t)lane;
+            restDarboux(segment * rate, segment * packet.twistRate[lane],
+                        packet.rx[k], packet.ry[k], packet.rz[k], packet.rw[k]);
+        }
+    }
+}
+
+void RodSolver::stepPacket(Packet& packet, float dt) {
+    packet.time += dt;
+    updateRestShape(packet);
+
+    const int nodes = packet.nodes;
+    const Float8 zero = Float8::zero();
+    const Float8 one = Float8::broadcast(1.0f);
+    const Float8 eps = Float8::broadcast(Epsilon);
+    const Float8 vdt = Float8::broadcast(dt);
+    const Float8 mass = Float8::load(packet.mass);
+    const Float8 seg = Float8::load(packet.segLength);
+    const Float8 invSeg = one / math::max(seg, eps);
+    const Float8 stretchK = Float8::load(packet.stretchK);
+    const Float8 bendK = Float8::load(packet.bendK);
+    const Float8 twistK = Float8::load(packet.twistK);
+    const Float8 keep = one - Float8::load(packet.damping);
+
+    auto at = [](int i) { return (size_t)i * Lanes; };
+
+    // Predict free nodes; the base node and base frame are clamped to the anchor
+    for (int i = 0; i < nodes; i++) {
+        Vec3x8 p = Vec3x8::load_soa(&packet.px[at(i)], &packet.py[at(i)], &packet.pz[at(i)]);
+        Vec3x8 v = Vec3x8::load_soa(&packet.vx[at(i)], &packet.vy[at(i)], &packet.vz[at(i)]);
+        p.store_soa(&packet.ox[at(i)], &packet.oy[at(i)], &packet.oz[at(i)]);
+        (p + v * vdt).store_soa(&packet.px[at(i)], &packet.py[at(i)], &packet.pz[at(i)]);
+    }
+    Vec3x8::load_soa(packet.anchorX, packet.anchorY, packet.anchorZ)
+        .store_soa(&packet.px[0], &packet.py[0], &packet.pz[0]);
+    Quat8{zero, Float8::load(packet.anchorQy), zero, Float8::load(packet.anchorQw)}
+        .store(packet.qx, packet.qy, packet.qz, packet.qw, 0);
+
+    for (int iter = 0; iter < iterations; iter++) {
+        // Stretch-shear: each segment's tangent director follows its edge
+        for (int s = 0; s < nodes - 1; s++) {
+            Float8 w0 = s == 0 ? zero : mass;
+            Float8 wq = s == 0 ? zero : mass;
+            Vec3x8 p0 = Vec3x8::load_soa(&packet.px[at(s)], &packet.py[at(s)], &packet.pz[at(s)]);
+            Vec3x8 p1 = Vec3x8::load_soa(&packet.px[at(s + 1)], &packet.py[at(s + 1)], &packet.pz[at(s + 1)]);
+            Quat8 q = Quat8::load(packet.qx, packet.qy, packet.qz, packet.qw, at(s));
+
+            Vec3x8 gamma = (p1 - p0) * invSeg - q.tangent();
+            Float8 denom = (w0 + mass) * invSeg + wq * seg * 4.0f + eps;
+            gamma = gamma * (stretchK / denom);
+
+            p0 = p0 + gamma * w0;
+            p1 = p1 - gamma * mass;
+
+            // q * conj(e3), written out
+            Quat8 qe3 = {-q.y, q.x, -q.w, q.z};
+            Quat8 dq = mul(Quat8{gamma.x, gamma.y, gamma.z, zero}, qe3) * (wq * seg * 2.0f);
+            q = (q + dq).normalized();
+
+            p0.store_soa(&packet.px[at(s)], &packet.py[at(s)], &packet.pz[at(s)]);
+            p1.store_soa(&packet.px[at(s + 1)], &packet.py[at(s + 1)], &packet.pz[at(s + 1)]);
+            q.store(packet.qx, packet.qy, packet.qz, packet.qw, at(s));
+        }
+
+        // Bend-twist: neighbouring frames keep their rest Darboux rotation
+        for (int j = 1; j < nodes - 1; j++) {
+            Float8 w0 = j == 1 ? zero : mass;
+            Quat8 q0 = Quat8::load(packet.qx, packet.qy, packet.qz, packet.qw, at(j - 1));
+            Quat8 q1 = Quat8::load(packet.qx, packet.qy, packet.qz, packet.qw, at(j));
+            Quat8 rest = Quat8::load(packet.rx, packet.ry, packet.rz, packet.rw, at(j - 1));
+
+            // q and -q are the same rotation: take the closer of the two
+            Quat8 omega = mul(q0.conjugate(), q1);
+            Quat8 minus = {omega.x - rest.x, omega.y - rest.y, omega.z - rest.z, omega.w - rest.w};
+            Quat8 plus = omega + rest;
+            math::Mask8 usePlus = (minus.x * minus.x + minus.y * minus.y + minus.z * minus.z + minus.w * minus.w) >
+                                  (plus.x * plus.x + plus.y * plus.y + plus.z * plus.z + plus.w * plus.w);
+            Float8 scale = one / (w0 + mass + eps);
+            Quat8 delta = {
+                math::select(usePlus, plus.x, minus.x) * bendK * scale,
+                math::select(usePlus, plus.y, minus.y) * bendK * scale,
+                math::select(usePlus, plus.z, minus.z) * twistK * scale,
+                zero
+            };
+
+            Quat8 dq0 = mul(q1, delta) * w0;
+            Quat8 dq1 = mul(q0, delta) * -mass;
+            q0 = (q0 + dq0).normalized();
+            q1 = (q1 + dq1).normalized();
+            q0.store(packet.qx, packet.qy, packet.qz, packet.qw, at(j - 1));
+            q1.store(packet.qx, packet.qy, packet.qz, packet.qw, at(j));
+        }
+    }
+
+    // Keep nodes above the dish, then derive damped velocities
+    const Float8 floor = Float8::broadcast(floorHeight);
+    const Float8 invDt = Float8::broadcast(1.0f / dt);
+    for (int i = 0; i < nodes; i++) {
+        Float8 y = math::max(Float8::load(&packet.py[at(i)]), floor);
+        y.store(&packet.py[at(i)]);
+        Vec3x8 p = Vec3x8::load_soa(&packet.px[at(i)], &packet.py[at(i)], &packet.pz[at(i)]);
+        Vec3x8 o = Vec3x8::load_soa(&packet.ox[at(i)], &packet.oy[at(i)], &packet.oz[at(i)]);
+        Vec3x8 v = (i == 0) ? Vec3x8::zero() : (p - o) * (invDt * keep);
+        v.store_soa(&packet.vx[at(i)], &packet.vy[at(i)], &packet.vz[at(i)]);
+    }
+}
+
+} // namespace micro_idle
@@ -0,0 +1,130 @@
+#ifndef MICRO_IDLE_ROD_SOLVER_H
+#define MICRO_IDLE_ROD_SOLVER_H
+
+#include <cstddef>
+#include <vector>
+#include "raylib.h"
+
+namespace JPH {
+class JobSystem;
+}
+
+namespace micro_idle {
+
+struct RodParams {
+    int nodes{12};
+    float length{1.0f};
+    float stretchStiffness{1.0f};   // 0..1 per iteration (stretch and shear)
+    float bendStiffness{0.5f};      // 0..1 per iteration
+    float twistStiffness{0.5f};
+    float damping{0.1f};            // Fraction of velocity lost per step (viscous medium)
+    float curvature{0.0f};          // Rest bend over the whole rod (radians), in the dish plane
+    float twist{0.0f};              // Rest twist over the whole rod (radians); with curvature makes a helix
+    float beatAmplitude{0.0f};      // Extra bend over the whole rod (radians), travelling base to tip
+    float beatFrequency{0.0f};      // Hz
+    float beatWavelength{1.0f};     // In rod lengths
+    float phase{0.0f};              // Beat phase offset (radians)
+};
+
+// Read-only view of one rod's nodes (base first)
+struct RodView {
+    const float* x{nullptr};
+    const float* y{nullptr};
+    const float* z{nullptr};
+    int nodes{0};
+    int stride{0};
+
+    Vector3 node(int i) const {
+        size_t k = (size_t)i * (size_t)stride;
+        return {x[k], y[k], z[k]};
+    }
+};
+
+/**
+ * Position-based Cosserat rods for long, thin appendages (necks, stalks, flagella)
+ *
+ * Each rod is a chain of nodes with one orientation quaternion per segment;
+ * stretch-shear constraints tie segments to their quaternions and bend-twist
+ * constraints tie neighbouring quaternions to a rest Darboux vector, so rods
+ * resist bending and twisting without any extra bodies.
+ *
+ * Rods with the same node count are packed eight to a packet and stored
+ * node-major (node i of all eight rods is contiguous), so every constraint
+ * projects eight rods per Float8. Packets step as independent jobs, which
+ * keeps results identical for any number of threads.
+ *
+ * The base node is clamped to an anchor point and direction supplied by the
+ * host each step; the rods do not push back on the host.
+ */
+class RodSolver {
+public:
+    static constexpr int Lanes = 8;
+
+    // Returns a handle that stays valid until removeRod
+    int addRod(const RodParams& params, Vector3 anchor, Vector3 direction);
+    void removeRod(int rod);
+    bool isAlive(int rod) const;
+
+    // Base position and outward direction (flattened onto the dish plane)
+    void setAnchor(int rod, Vector3 anchor, Vector3 direction);
+
+    /**
+     * Advance every rod by dt
+     *
+     * @param jobs Job system to spread packets over (null runs inline)
+     */
+    void step(float dt, JPH::JobSystem* jobs);
+
+    RodView getRod(int rod) const;
+    int getRodCount() const { return liveRods; }
+    int getPacketCount() const { return (int)packets.size(); }
+
+    int iterations{4};
+    float floorHeight{-1e9f};       // Nodes are kept above this height
+
+private:
+    struct Packet {
+        int nodes{0};
+        int used{0};                // Bit per occupied lane
+        float time{0.0f};
+
+        // Node-major [node * Lanes + lane]
+        std::vector<float> px, py, pz;
+        std::vector<float> ox, oy, oz;      // Positions before the step
+        std::vector<float> vx, vy, vz;
+
+        // Segment-major [segment * Lanes + lane]
+        std::vector<float> qx, qy, qz, qw;
+
+        // Rest Darboux vector per inner node [(node - 1) * Lanes + lane]
+        std::vector<float> rx, ry, rz, rw;
+
+        // Per lane
+        float mass[Lanes]{};                // Inverse mass of free nodes (0 = empty lane)
+        float segLength[Lanes]{};
+        float stretchK[Lanes]{};
+        float bendK[Lanes]{};
+        float twistK[Lanes]{};
+        float damping[Lanes]{};
+        float bendRate[Lanes]{};            // Rest bend per unit length
+        float twistRate[Lanes]{};
+        float beatRate[Lanes]{};            // Beat bend per unit length
+        float beatOmega[Lanes]{};
+        float beatK[Lanes]{};               // Wavenumber along the rod
+        float beatPhase[Lanes]{};
+        float anchorX[Lanes]{}, anchorY[Lanes]{}, anchorZ[Lanes]{};
+        float anchorQy[Lanes]{}, anchorQw[Lanes]{};   // Yaw-only base frame
+    };
+
+    std::vector<Packet> packets;
+    std::vector<int> slots;         // Handle -> packet * Lanes + lane (-1 = free)
+    std::vector<int> freeHandles;
+    int liveRods{0};
+
+    void stepPacket(Packet& packet, float dt);
+    void updateRestShape(Packet& packet);
+};
+
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,73 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace micro_idle {
+
+void SpatialGrid::clear() {
+    cols = 0;
+    rows = 0;
+    count = 0;
+    cellStart.clear();
+    items.clear();
+}
+
+void SpatialGrid::build(const float* xs, const float* zs, const float* radii, int itemCount,
+                        float cell, float minX, float minZ, float maxX, float maxZ) {
+    float width = std::max(maxX - minX, 1e-3f);
+    float depth = std::max(maxZ - minZ, 1e-3f);
+
+    // Keep the cell array bounded even for tiny cells on a huge dish
+    cell = std::max(cell, 1e-3f);
+    float minCell = std::sqrt(width * depth / (float)MaxCells);
+    cellSize = std::max(cell, minCell);
+    invCellSize = 1.0f / cellSize;
+    originX = minX;
+    originZ = minZ;
+    cols = std::max(1, (int)std::ceil(width * invCellSize));
+    rows = std::max(1, (int)std::ceil(depth * invCellSize));
+    count = itemCount;
+
+    int cells = cols * rows;
+    cellStart.assign((size_t)cells + 1, 0);
+
+    // Pass 1: count entries per cell (shifted by one for the prefix sum)
+    for (int i = 0; i < itemCount; i++) {
+        float r = radii ? radii[i] : 0.0f;
+        int c0 = clampCol(xs[i] - r), c1 = clampCol(xs[i] + r);
+        int r0 = clampRow(zs[i] - r), r1 = clampRow(zs[i] + r);
+        for (int row = r0; row <= r1; row++) {
+            for (int col = c0; col <= c1; col++) {
+                cellStart[(size_t)(row * cols + col) + 1]++;
+            }
+        }
+    }
+    for (int c = 0; c < cells; c++) {
+        cellStart[(size_t)c + 1] += cellStart[(size_t)c];
+    }
+
+    // Pass 2: scatter item indices into their cells
+    items.resize((size_t)cellStart[(size_t)cells]);
+    cursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < itemCount; i++) {
+        float r = radii ? radii[i] : 0.0f;
+        int c0 = clampCol(xs[i] - r), c1 = clampCol(xs[i] + r);
+        int r0 = clampRow(zs[i] - r), r1 = clampRow(zs[i] + r);
+        for (int row = r0; row <= r1; row++) {
+            for (int col = c0; col <= c1; col++) {
+                items[(size_t)cursor[(size_t)(row * cols + col)]++] = i;
+            }
+        }
+    }
+}
+
+const int* SpatialGrid::cellItems(int cell, int& outCount) const {
+    if (cell < 0 || cell >= cols * rows) {
+        outCount = 0;
+        return nullptr;
+    }
+    outCount = cellStart[(size_t)cell + 1] - cellStart[(size_t)cell];
+    return items.data() + cellStart[(size_t)cell];
+}
+
+} // namespace micro_idle
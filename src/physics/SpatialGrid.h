@@ -0,0 +1,105 @@
+#ifndef MICRO_IDLE_SPATIAL_GRID_H
+#define MICRO_IDLE_SPATIAL_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace micro_idle {
+
+/**
+ * Uniform grid over the dish floor (XZ plane) for coarse proximity queries
+ *
+ * Rebuilt from scratch each time with a counting sort, so items of one cell are
+ * contiguous and a build is two linear passes. Circles are inserted into every
+ * cell they overlap: a point query then only has to look at a single cell.
+ */
+class SpatialGrid {
+public:
+    /**
+     * Build the grid over [minX, maxX] x [minZ, maxZ]
+     *
+     * @param xs, zs Item centers
+     * @param radii Item radii, or nullptr to insert items as points
+     * @param count Number of items
+     * @param cellSize Cell edge length (clamped so the grid stays <= maxCells)
+     */
+    void build(const float* xs, const float* zs, const float* radii, int count,
+               float cellSize, float minX, float minZ, float maxX, float maxZ);
+
+    void clear();
+
+    // Cell containing (x, z), clamped to the grid edge (build clamps the same way);
+    // -1 only before the first build
+    // Inline and branch-free: bulk callers look up one cell per agent
+    int cellAt(float x, float z) const {
+        if (cols == 0) {
+            return -1;
+        }
+        return clampRow(z) * cols + clampCol(x);
+    }
+
+    // Items stored in a cell; `count` receives the number of entries
+    const int* cellItems(int cell, int& count) const;
+
+    /**
+     * Visit items in every cell overlapping the circle (x, z, radius)
+     * An item spanning several cells can be visited more than once.
+     */
+    template <typename Fn>
+    void forEachNear(float x, float z, float radius, Fn&& fn) const {
+        forEachInBox(x - radius, z - radius, x + radius, z + radius, fn);
+    }
+
+    /**
+     * Visit items in every cell overlapping the box [minX, maxX] x [minZ, maxZ]
+     * An item spanning several cells can be visited more than once.
+     */
+    template <typename Fn>
+    void forEachInBox(float minX, float minZ, float maxX, float maxZ, Fn&& fn) const {
+        if (cols == 0) {
+            return;
+        }
+        int c0 = clampCol(minX);
+        int c1 = clampCol(maxX);
+        int r0 = clampRow(minZ);
+        int r1 = clampRow(maxZ);
+        for (int r = r0; r <= r1; r++) {
+            for (int c = c0; c <= c1; c++) {
+                int cell = r * cols + c;
+                for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                    fn(items[i]);
+                }
+            }
+        }
+    }
+
+    int itemCount() const { return count; }
+    int cellCount() const { return cols * rows; }
+    float getCellSize() const { return cellSize; }
+
+    static constexpr int MaxCells = 1 << 18;
+
+private:
+    float originX{0.0f};
+    float originZ{0.0f};
+    float cellSize{1.0f};
+    float invCellSize{1.0f};
+    int cols{0};
+    int rows{0};
+    int count{0};
+    std::vector<int> cellStart;   // cols*rows + 1 prefix offsets into items
+    std::vector<int> items;       // Item indices grouped by cell
+    std::vector<int> cursor;      // Scratch for the scatter pass
+
+    int clampCol(float x) const {
+        return std::clamp((int)std::floor((x - originX) * invCellSize), 0, cols - 1);
+    }
+    int clampRow(float z) const {
+        return std::clamp((int)std::floor((z - originZ) * invCellSize), 0, rows - 1);
+    }
+};
+
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,320 @@
+#include "TargetIndex.h"
+#include "src/math/Simd.h"
+#include "src/physics/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace micro_idle {
+
+namespace {
+
+using math::Float8;
+
+constexpr float Far = 1e18f;            // Padding coordinate: never within reach
+constexpr float Unbounded = 1e30f;      // Squared search limit without a radius (padding sits beyond it)
+
+} // namespace
+
+void TargetIndex::clear() {
+    cols = 0;
+    rows = 0;
+    count = 0;
+    cellStart.clear();
+    cx.clear();
+    cz.clear();
+    cscore.clear();
+    cslot.clear();
+}
+
+void TargetIndex::build(const float* xs, const float* zs, const float* scores, int targetCount, float cell,
+                        JPH::JobSystem* jobs) {
+    if (targetCount <= 0) {
+        clear();
+        return;
+    }
+    count = targetCount;
+
+    // Fit the grid to the targets themselves, so none is clamped into a cell it is not in
+    float minX = xs[0], maxX = xs[0];
+    float minZ = zs[0], maxZ = zs[0];
+    for (int i = 1; i < count; i++) {
+        minX = std::min(minX, xs[i]);
+        maxX = std::max(maxX, xs[i]);
+        minZ = std::min(minZ, zs[i]);
+        maxZ = std::max(maxZ, zs[i]);
+    }
+    float width = std::max(maxX - minX, 1e-3f);
+    float depth = std::max(maxZ - minZ, 1e-3f);
+    cell = std::max(cell, 1e-3f);
+    cellSize = std::max(cell, std::sqrt(width * depth / (float)MaxCells));
+    invCellSize = 1.0f / cellSize;
+    originX = minX;
+    originZ = minZ;
+    cols = std::max(1, (int)std::ceil(width * invCellSize));
+    rows = std::max(1, (int)std::ceil(depth * invCellSize));
+
+    int chunks = (count + ChunkSize - 1) / ChunkSize;
+    cellOf.resize((size_t)count);
+    parallelFor(jobs, chunks, [&](int c) {
+        int end = std::min((c + 1) * ChunkSize, count);
+        for (int i = c * ChunkSize; i < end; i++) {
+            cellOf[(size_t)i] = clampRow(zs[i]) * cols + clampCol(xs[i]);
+        }
+    });
+
+    // Counting sort with every cell rounded up to a whole Float8
+    int cells = cols * rows;
+    cellStart.assign((size_t)cells + 1, 0);
+    for (int i = 0; i < count; i++) {
+        cellStart[(size_t)cellOf[(size_t)i] + 1]++;
+    }
+    for (int c = 0; c < cells; c++) {
+        int padded = (cellStart[(size_t)c + 1] + Float8::Width - 1) & ~(Float8::Width - 1);
+        cellStart[(size_t)c + 1] = cellStart[(size_t)c] + padded;
+    }
+    size_t total = (size_t)cellStart[(size_t)cells];
+    cx.assign(total, Far);
+    cz.assign(total, Far);
+    cscore.assign(total, 0.0f);
+    cslot.assign(total, -1);
+
+    destination.resize((size_t)count);
+    cursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < count; i++) {
+        destination[(size_t)i] = cursor[(size_t)cellOf[(size_t)i]]++;
+    }
+    parallelFor(jobs, chunks, [&](int c) {
+        int end = std::min((c + 1) * ChunkSize, count);
+        for (int i = c * ChunkSize; i < end; i++) {
+            size_t d = (size_t)destination[(size_t)i];
+            cx[d] = xs[i];
+            cz[d] = zs[i];
+            cscore[d] = scores ? scores[i] : 0.0f;
+            cslot[d] = i;
+        }
+    });
+}
+
+int TargetIndex::nearest(float x, float z, int k, float maxRadius, int* outSlots, float* outDist2) const {
+    k = std::min(k, MaxK);
+    if (count == 0 || k <= 0) {
+        return 0;
+    }
+    float limit2 = maxRadius > 0.0f ? maxRadius * maxRadius : Unbounded;
+
+    // Sorted by (distance, slot); the last entry is the one to beat once full
+    float bestD2[MaxK];
+    int bestSlot[MaxK];
+    int found = 0;
+    auto insert = [&](float d2, int slot) {
+        int pos = found;
+        while (pos > 0 && (d2 < bestD2[pos - 1] || (d2 == bestD2[pos - 1] && slot < bestSlot[pos - 1]))) {
+            pos--;
+        }
+        if (pos >= k) {
+            return;
+        }
+        for (int j = std::min(found, k - 1); j > pos; j--) {
+            bestD2[j] = bestD2[j - 1];
+            bestSlot[j] = bestSlot[j - 1];
+        }
+        bestD2[pos] = d2;
+        bestSlot[pos] = slot;
+        found = std::min(found + 1, k);
+    };
+
+    Float8 ax = Float8::broadcast(x);
+    Float8 az = Float8::broadcast(z);
+    auto scanCell = [&](int cell) {
+        for (int i = cellStart[(size_t)cell]; i < cellStart[(size_t)cell + 1]; i += Float8::Width) {
+            Float8 dx = Float8::load(&cx[(size_t)i]) - ax;
+            Float8 dz = Float8::load(&cz[(size_t)i]) - az;
+            Float8 d2 = dx * dx + dz * dz;
+            float cutoff = found == k ? std::min(bestD2[k - 1], limit2) : limit2;
+            int bits = (d2 <= Float8::broadcast(cutoff)).bits();
+            if (bits == 0) {
+                continue;
+            }
+            float lanes[Float8::Width];
+            d2.store(lanes);
+            for (int lane = 0; lane < Float8::Width; lane++) {
+                if (bits & (1 << lane)) {
+                    insert(lanes[lane], cslot[(size_t)i + (size_t)lane]);
+                }
+            }
+        }
+    };
+
+    // Grow square rings of cells around the query's cell until nothing unvisited can be closer
+    int col = clampCol(x);
+    int row = clampRow(z);
+    for (int ring = 0;; ring++) {
+        int c0 = col - ring, c1 = col + ring;
+        int r0 = row - ring, r1 = row + ring;
+        for (int r = std::max(r0, 0); r <= std::min(r1, rows - 1); r++) {
+            if (r == r0 || r == r1) {
+                for (int c = std::max(c0, 0); c <= std::min(c1, cols - 1); c++) {
+                    scanCell(r * cols + c);
+                }
+                continue;
+            }
+            if (c0 >= 0) {
+                scanCell(r * cols + c0);
+            }
+            if (c1 < cols) {
+                scanCell(r * cols + c1);
+            }
+        }
+
+        // Distance to the nearest grid cell outside the visited square
+        bool more = false;
+        float gap = Unbounded;
+        if (c0 > 0) {
+            gap = std::min(gap, x - (originX + (float)c0 * cellSize));
+            more = true;
+        }
+        if (c1 < cols - 1) {
+            gap = std::min(gap, originX + (float)(c1 + 1) * cellSize - x);
+            more = true;
+        }
+        if (r0 > 0) {
+            gap = std::min(gap, z - (originZ + (float)r0 * cellSize));
+            more = true;
+        }
+        if (r1 < rows - 1) {
+            gap = std::min(gap, originZ + (float)(r1 + 1) * cellSize - z);
+            more = true;
+        }
+        if (!more) {
+            break;
+        }
+        gap = std::max(gap, 0.0f);
+        if (gap * gap > limit2 || (found == k && bestD2[k - 1] <= gap * gap)) {
+            break;
+        }
+    }
+
+    for (int j = 0; j < found; j++) {
+        outSlots[j] = bestSlot[j];
+        if (outDist2) {
+            outDist2[j] = bestD2[j];
+        }
+    }
+    return found;
+}
+
+int TargetIndex::bestInRadius(float x, float z, float radius) const {
+    if (count == 0 || radius < 0.0f) {
+        return -1;
+    }
+    Float8 ax = Float8::broadcast(x);
+    Float8 az = Float8::broadcast(z);
+    Float8 r2 = Float8::broadcast(radius * radius);
+    int best = -1;
+    float bestScore = 0.0f;
+    float bestD2 = 0.0f;
+
+    int c0 = clampCol(x - radius), c1 = clampCol(x + radius);
+    int r0 = clampRow(z - radius), r1 = clampRow(z + radius);
+    for (int r = r0; r <= r1; r++) {
+        for (int c = c0; c <= c1; c++) {
+            int cell = r * cols + c;
+            for (int i = cellStart[(size_t)cell]; i < cellStart[(size_t)cell + 1]; i += Float8::Width) {
+                Float8 dx = Float8::load(&cx[(size_t)i]) - ax;
+                Float8 dz = Float8::load(&cz[(size_t)i]) - az;
+                Float8 d2 = dx * dx + dz * dz;
+                int bits = (d2 <= r2).bits();
+                if (bits == 0) {
+                    continue;
+                }
+                float lanes[Float8::Width];
+                d2.store(lanes);
+                for (int lane = 0; lane < Float8::Width; lane++) {
+                    if (!(bits & (1 << lane))) {
+                        continue;
+                    }
+                    size_t j = (size_t)i + (size_t)lane;
+                    float score = cscore[j];
+                    int slot = cslot[j];
+                    if (best < 0 || score > bestScore ||
+                        (score == bestScore && (lanes[lane] < bestD2 || (lanes[lane] == bestD2 && slot < best)))) {
+                        best = slot;
+                        bestScore = score;
+                        bestD2 = lanes[lane];
+                    }
+                }
+            }
+        }
+    }
+    return best;
+}
+
+void TargetIndex::nearestBatch(const float* xs, const float* zs, int agentCount, int k, float maxRadius,
+                               int* outSlots, float* outDist2, JPH::JobSystem* jobs) const {
+    if (agentCount <= 0 || k <= 0) {
+        return;
+    }
+    int chunks = (agentCount + ChunkSize - 1) / ChunkSize;
+    parallelFor(jobs, chunks, [&](int c) {
+        int end = std::min((c + 1) * ChunkSize, agentCount);
+        for (int a = c * ChunkSize; a < end; a++) {
+            size_t base = (size_t)a * (size_t)k;
+            int found = nearest(xs[a], zs[a], k, maxRadius, outSlots + base, outDist2 ? outDist2 + base : nullptr);
+            for (int j = found; j < k; j++) {
+                outSlots[base + (size_t)j] = -1;
+                if (outDist2) {
+                    outDist2[base + (size_t)j] = -1.0f;
+                }
+            }
+        }
+    });
+}
+
+int TargetIndex::assignTargets(const float* xs, const float* zs, int agentCount, int k, float maxRadius,
+                               int maxClaims, int* outTargets, JPH::JobSystem* jobs) {
+    if (agentCount <= 0) {
+        return 0;
+    }
+    k = std::clamp(k, 1, MaxK);
+    maxClaims = std::max(maxClaims, 1);
+    size_t n = (size_t)agentCount * (size_t)k;
+    candidates.resize(n);
+    candidateDist2.resize(n);
+    nearestBatch(xs, zs, agentCount, k, maxRadius, candidates.data(), candidateDist2.data(), jobs);
+
+    // Closest agents claim first, so a target goes to whoever reaches it soonest
+    agentOrder.resize((size_t)agentCount);
+    std::iota(agentOrder.begin(), agentOrder.end(), 0);
+    auto firstDist2 = [&](int a) {
+        size_t base = (size_t)a * (size_t)k;
+        return candidates[base] >= 0 ? candidateDist2[base] : Unbounded;
+    };
+    std::sort(agentOrder.begin(), agentOrder.end(), [&](int a, int b) {
+        float da = firstDist2(a);
+        float db = firstDist2(b);
+        return da < db || (da == db && a < b);
+    });
+
+    claims.assign((size_t)count, 0);
+    int assigned = 0;
+    for (int a : agentOrder) {
+        size_t base = (size_t)a * (size_t)k;
+        outTargets[a] = -1;
+        for (int j = 0; j < k; j++) {
+            int slot = candidates[base + (size_t)j];
+            if (slot < 0) {
+                break;
+            }
+            if (claims[(size_t)slot] < maxClaims) {
+                claims[(size_t)slot]++;
+                outTargets[a] = slot;
+                assigned++;
+                break;
+            }
+        }
+    }
+    return assigned;
+}
+
+} // namespace micro_idle
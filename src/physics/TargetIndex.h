@@ -0,0 +1,113 @@
+#ifndef MICRO_IDLE_TARGET_INDEX_H
+#define MICRO_IDLE_TARGET_INDEX_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace JPH {
+class JobSystem;
+}
+
+namespace micro_idle {
+
+/**
+ * Per-tick index of targets on the dish floor (XZ plane) for agents that pick
+ * what to attack: exact k-nearest and best-score-within-radius queries, alone or
+ * batched over many agents
+ *
+ * Targets are points in a uniform grid sized to their own bounds, so no target
+ * is clamped into a cell it is not in and ring searches stop exactly. Each
+ * cell's targets are copied into cell order and padded to a whole Float8 with
+ * unreachable dummies, so a cell is scanned eight targets at a time. The build
+ * and batched queries run in fixed chunks on the job system; results are
+ * ordered by (distance, slot), so they never depend on the thread count.
+ */
+class TargetIndex {
+public:
+    static constexpr int MaxK = 8;
+    static constexpr int ChunkSize = 256;       // Targets or agents per job
+
+    /**
+     * Build over `count` targets
+     *
+     * @param scores Per-target score for bestInRadius (null scores them all 0)
+     * @param cellSize Cell edge length (clamped so the grid stays <= MaxCells)
+     * @param jobs Job system to spread chunks over (null runs inline)
+     */
+    void build(const float* xs, const float* zs, const float* scores, int count, float cellSize,
+               JPH::JobSystem* jobs);
+
+    void clear();
+
+    /**
+     * Up to k (<= MaxK) targets nearest to (x, z), nearest first
+     *
+     * @param maxRadius Ignore targets further than this (<= 0: no limit)
+     * @param outDist2 Squared distances (may be null)
+     * @return Number found
+     */
+    int nearest(float x, float z, int k, float maxRadius, int* outSlots, float* outDist2) const;
+
+    // Highest-scoring target within `radius` of (x, z), nearer first on ties; -1 if none
+    int bestInRadius(float x, float z, float radius) const;
+
+    /**
+     * nearest() for `count` agents at once; agent a's results fill
+     * outSlots[a * k .. a * k + k), padded with -1
+     *
+     * @param outDist2 Squared distances, same layout (may be null)
+     */
+    void nearestBatch(const float* xs, const float* zs, int count, int k, float maxRadius,
+                      int* outSlots, float* outDist2, JPH::JobSystem* jobs) const;
+
+    /**
+     * Give each agent a target no more than `maxClaims` agents share
+     *
+     * Every agent's k nearest candidates are found in parallel; then agents
+     * claim in order of how close their nearest candidate is (closest first,
+     * agent index on ties), each taking its nearest candidate that still has
+     * room. Agents whose candidates are all taken get -1.
+     *
+     * @return Number of agents that got a target
+     */
+    int assignTargets(const float* xs, const float* zs, int count, int k, float maxRadius, int maxClaims,
+                      int* outTargets, JPH::JobSystem* jobs);
+
+    int size() const { return count; }
+    int cellCount() const { return cols * rows; }
+
+    static constexpr int MaxCells = 1 << 18;
+
+private:
+    float originX{0.0f};
+    float originZ{0.0f};
+    float cellSize{1.0f};
+    float invCellSize{1.0f};
+    int cols{0};
+    int rows{0};
+    int count{0};
+    std::vector<int> cellOf;            // Cell of each target
+    std::vector<int> cellStart;         // cols*rows + 1 offsets into the cell-ordered arrays
+    std::vector<int> cursor;            // Scratch for the scatter pass
+    std::vector<int> destination;       // Cell-ordered position of each target
+    std::vector<float> cx, cz, cscore;  // Cell-ordered, each cell padded to a Float8
+    std::vector<int> cslot;             // Target slot, -1 for padding
+
+    // assignTargets scratch
+    std::vector<int> candidates;
+    std::vector<float> candidateDist2;
+    std::vector<int> agentOrder;
+    std::vector<int> claims;
+
+    int clampCol(float x) const {
+        return std::clamp((int)std::floor((x - originX) * invCellSize), 0, cols - 1);
+    }
+    int clampRow(float z) const {
+        return std::clamp((int)std::floor((z - originZ) * invCellSize), 0, rows - 1);
+    }
+};
+
+} // namespace micro_idle
+
+#endif
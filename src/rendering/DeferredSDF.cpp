@@ -0,0 +1,324 @@
+#include "DeferredSDF.h"
+#include "rlgl.h"
+
+#if defined(_WIN32) && !defined(_WIN64)
+#define DEFERRED_GL_APIENTRY __stdcall
+#else
+#define DEFERRED_GL_APIENTRY
+#endif
+
+// rlgl only toggles blending for every draw buffer at once. The per-buffer
+// switches (core since GL 3.0) come from the glad loader raylib already ran.
+extern "C" {
+typedef void (DEFERRED_GL_APIENTRY *DeferredGlIndexedProc)(unsigned int target, unsigned int index);
+extern DeferredGlIndexedProc glad_glEnablei;
+extern DeferredGlIndexedProc glad_glDisablei;
+}
+
+namespace micro_idle {
+namespace rendering {
+
+namespace {
+
+constexpr unsigned int GlBlend = 0x0BE2;
+constexpr unsigned int CountsAttachment = 2;
+
+} // namespace
+
+bool DeferredSDF::init(Shader shader, Shader reduceShader, int w, int h) {
+    unload();
+    if (shader.id == 0) {
+        if (reduceShader.id != 0) {
+            UnloadShader(reduceShader);
+        }
+        return false;
+    }
+
+    lighting = shader;
+    viewPosLoc = GetShaderLocation(lighting, "viewPos");
+    invViewProjLoc = GetShaderLocation(lighting, "invViewProj");
+    albedoLoc = GetShaderLocation(lighting, "gAlbedo");
+    normalLoc = GetShaderLocation(lighting, "gNormal");
+    depthLoc = GetShaderLocation(lighting, "gDepth");
+    debugModeLoc = GetShaderLocation(lighting, "debugMode");
+
+    reduce = reduceShader;
+    if (reduce.id != 0) {
+        countsLoc = GetShaderLocation(reduce, "counts");
+        tileSizeLoc = GetShaderLocation(reduce, "tileSize");
+    }
+    emptyVao = rlLoadVertexArray();
+
+    if (!createTargets(w, h)) {
+        unload();
+        return false;
+    }
+    return true;
+}
+
+bool DeferredSDF::createTargets(int w, int h) {
+    width = w;
+    height = h;
+
+    fbo = rlLoadFramebuffer();
+    if (fbo == 0) {
+        return false;
+    }
+    albedoTexture = rlLoadTexture(nullptr, w, h, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    normalTexture = rlLoadTexture(nullptr, w, h, RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+    countsTexture = rlLoadTexture(nullptr, w, h, RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+    depthTexture = rlLoadTextureDepth(w, h, false);
+
+    rlEnableFramebuffer(fbo);
+    rlActiveDrawBuffers(3);
+    rlFramebufferAttach(fbo, albedoTexture, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+    rlFramebufferAttach(fbo, normalTexture, RL_ATTACHMENT_COLOR_CHANNEL1, RL_ATTACHMENT_TEXTURE2D, 0);
+    rlFramebufferAttach(fbo, countsTexture, RL_ATTACHMENT_COLOR_CHANNEL2, RL_ATTACHMENT_TEXTURE2D, 0);
+    rlFramebufferAttach(fbo, depthTexture, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_TEXTURE2D, 0);
+    bool complete = rlFramebufferComplete(fbo);
+    rlDisableFramebuffer();
+
+    if (!complete) {
+        destroyTargets();
+    }
+    return complete;
+}
+
+void DeferredSDF::destroyTargets() {
+    if (albedoTexture != 0) {
+        rlUnloadTexture(albedoTexture);
+        albedoTexture = 0;
+    }
+    if (normalTexture != 0) {
+        rlUnloadTexture(normalTexture);
+        normalTexture = 0;
+    }
+    if (countsTexture != 0) {
+        rlUnloadTexture(countsTexture);
+        countsTexture = 0;
+    }
+    // Also deletes the attached depth texture
+    if (fbo != 0) {
+        rlUnloadFramebuffer(fbo);
+        fbo = 0;
+    }
+    depthTexture = 0;
+    width = 0;
+    height = 0;
+}
+
+bool DeferredSDF::createReduceTargets() {
+    for (int i = 0; i < 2; i++) {
+        reduceFbo[i] = rlLoadFramebuffer();
+        reduceTexture[i] = rlLoadTexture(nullptr, ReduceSize, ReduceSize,
+                                         RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+        rlEnableFramebuffer(reduceFbo[i]);
+        rlFramebufferAttach(reduceFbo[i], reduceTexture[i], RL_ATTACHMENT_COLOR_CHANNEL0,
+                            RL_ATTACHMENT_TEXTURE2D, 0);
+        bool complete = rlFramebufferComplete(reduceFbo[i]);
+        rlDisableFramebuffer();
+        if (!complete) {
+            destroyReduceTargets();
+            return false;
+        }
+        reducePending[i] = false;
+    }
+    reduceIndex = 0;
+    return true;
+}
+
+void DeferredSDF::destroyReduceTargets() {
+    for (int i = 0; i < 2; i++) {
+        if (reduceTexture[i] != 0) {
+            rlUnloadTexture(reduceTexture[i]);
+            reduceTexture[i] = 0;
+        }
+        if (reduceFbo[i] != 0) {
+            rlUnloadFramebuffer(reduceFbo[i]);
+            reduceFbo[i] = 0;
+        }
+        reducePending[i] = false;
+    }
+}
+
+void DeferredSDF::unload() {
+    destroyTargets();
+    destroyReduceTargets();
+    if (emptyVao != 0) {
+        rlUnloadVertexArray(emptyVao);
+        emptyVao = 0;
+    }
+    if (lighting.id != 0) {
+        UnloadShader(lighting);
+        lighting = Shader{};
+    }
+    if (reduce.id != 0) {
+        UnloadShader(reduce);
+        reduce = Shader{};
+    }
+    stats = RaymarchStats{};
+}
+
+void DeferredSDF::setCollectStats(bool enabled) {
+    if (enabled == collectStats) {
+        return;
+    }
+    collectStats = enabled;
+    // Totals from an earlier session would read as current
+    reducePending[0] = false;
+    reducePending[1] = false;
+    statsFrame = 0;
+    stats = RaymarchStats{};
+}
+
+void DeferredSDF::beginGeometry(int w, int h) {
+    if (fbo == 0) {
+        return;
+    }
+    if (w != width || h != height) {
+        destroyTargets();
+        if (!createTargets(w, h)) {
+            return;
+        }
+    }
+
+    rlDrawRenderBatchActive();
+    rlEnableFramebuffer(fbo);
+    // The counts attachment is only written while someone looks at it
+    countsActive = heatmap || collectStats;
+    rlActiveDrawBuffers(countsActive ? 3 : 2);
+    rlClearColor(0, 0, 0, 0);
+    rlClearScreenBuffers();
+    // Alpha holds AO and the microbe id, not coverage
+    rlDisableColorBlend();
+    if (countsActive && glad_glEnablei) {
+        // Counts add up, so a pixel covered by several proxies keeps all their work
+        rlSetBlendFactors(RL_ONE, RL_ONE, RL_FUNC_ADD);
+        rlSetBlendMode(RL_BLEND_CUSTOM);
+        glad_glEnablei(GlBlend, CountsAttachment);
+    }
+}
+
+void DeferredSDF::endGeometry() {
+    if (fbo == 0) {
+        return;
+    }
+    rlDrawRenderBatchActive();
+    if (countsActive && glad_glDisablei) {
+        glad_glDisablei(GlBlend, CountsAttachment);
+        rlSetBlendMode(RL_BLEND_ALPHA);
+    }
+    rlEnableColorBlend();
+    rlDisableFramebuffer();
+}
+
+void DeferredSDF::drawFullscreen() {
+    // One triangle covering the target, generated from gl_VertexID
+    rlEnableVertexArray(emptyVao);
+    rlDrawVertexArray(0, 3);
+    rlDisableVertexArray();
+}
+
+void DeferredSDF::light(Vector3 viewPos, const Matrix& invViewProj) {
+    if (fbo == 0) {
+        return;
+    }
+
+    rlDrawRenderBatchActive();
+    int debugMode = heatmap ? 1 : 0;
+    SetShaderValue(lighting, viewPosLoc, &viewPos, SHADER_UNIFORM_VEC3);
+    SetShaderValueMatrix(lighting, invViewProjLoc, invViewProj);
+    SetShaderValue(lighting, debugModeLoc, &debugMode, SHADER_UNIFORM_INT);
+    int slots[3] = {0, 1, 2};
+    SetShaderValue(lighting, albedoLoc, &slots[0], SHADER_UNIFORM_SAMPLER2D);
+    SetShaderValue(lighting, normalLoc, &slots[1], SHADER_UNIFORM_SAMPLER2D);
+    SetShaderValue(lighting, depthLoc, &slots[2], SHADER_UNIFORM_SAMPLER2D);
+
+    rlEnableShader(lighting.id);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(albedoTexture);
+    rlActiveTextureSlot(1);
+    rlEnableTexture(normalTexture);
+    rlActiveTextureSlot(2);
+    rlEnableTexture(depthTexture);
+
+    drawFullscreen();
+
+    rlActiveTextureSlot(2);
+    rlDisableTexture();
+    rlActiveTextureSlot(1);
+    rlDisableTexture();
+    rlActiveTextureSlot(0);
+    rlDisableTexture();
+    rlDisableShader();
+
+    if (collectStats && reduce.id != 0) {
+        if (reduceFbo[0] == 0 && !createReduceTargets()) {
+            return;
+        }
+        // Sampled every StatsInterval frames. The previous sample was reduced
+        // that many frames ago, so the GPU is long done with it and the
+        // synchronous readback copies without waiting on this frame's work.
+        if (statsFrame++ % StatsInterval == 0) {
+            readStats(reduceIndex ^ 1);
+            reduceCounts();
+            reduceIndex ^= 1;
+        }
+    }
+}
+
+void DeferredSDF::reduceCounts() {
+    int tileSize[2] = {
+        (width + ReduceSize - 1) / ReduceSize,
+        (height + ReduceSize - 1) / ReduceSize
+    };
+    int slot = 0;
+    SetShaderValue(reduce, countsLoc, &slot, SHADER_UNIFORM_SAMPLER2D);
+    SetShaderValue(reduce, tileSizeLoc, tileSize, SHADER_UNIFORM_IVEC2);
+
+    rlEnableFramebuffer(reduceFbo[reduceIndex]);
+    rlViewport(0, 0, ReduceSize, ReduceSize);
+    rlDisableDepthTest();
+    rlDisableColorBlend();
+
+    rlEnableShader(reduce.id);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(countsTexture);
+    drawFullscreen();
+    rlDisableTexture();
+    rlDisableShader();
+
+    rlEnableColorBlend();
+    rlEnableDepthTest();
+    rlViewport(0, 0, width, height);
+    rlDisableFramebuffer();
+    reducePending[reduceIndex] = true;
+}
+
+void DeferredSDF::readStats(int index) {
+    if (!reducePending[index]) {
+        return;
+    }
+    reducePending[index] = false;
+
+    float* sums = (float*)rlReadTexturePixels(reduceTexture[index], ReduceSize, ReduceSize,
+                                              RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32);
+    if (!sums) {
+        return;
+    }
+
+    // Each tile sum is exact in float; the screen total is not, so add in double
+    RaymarchStats totals;
+    for (int i = 0; i < ReduceSize * ReduceSize; i++) {
+        totals.steps += (double)sums[i * 4 + 0];
+        totals.evaluations += (double)sums[i * 4 + 1];
+        totals.pixels += (double)sums[i * 4 + 2];
+        totals.hits += (double)sums[i * 4 + 3];
+    }
+    totals.valid = true;
+    stats = totals;
+    MemFree(sums);
+}
+
+} // namespace rendering
+} // namespace micro_idle
@@ -0,0 +1,114 @@
+#ifndef MICRO_IDLE_DEFERRED_SDF_H
+#define MICRO_IDLE_DEFERRED_SDF_H
+
+#include "raylib.h"
+
+namespace micro_idle {
+namespace rendering {
+
+// Raymarch work summed over the screen for one frame
+struct RaymarchStats {
+    bool valid{false};
+    double pixels{0.0};         // Proxy pixels that marched
+    double hits{0.0};           // ... and found the membrane
+    double steps{0.0};          // Loop iterations
+    double evaluations{0.0};    // sdMembrane calls, including normal and AO taps
+};
+
+/**
+ * Deferred shading for the SDF membranes
+ *
+ * The geometry pass raymarches every proxy into a G-buffer:
+ *   attachment 0 (RGBA8)   albedo, ambient occlusion in alpha
+ *   attachment 1 (RGBA32F) world normal, microbe id in w (0 = empty)
+ *   attachment 2 (RGBA32F) steps, SDF evaluations, marched, hit (debug only,
+ *                          blended additively; misses write it too)
+ *   depth texture          depth of the raymarched hit
+ * One full-screen lighting pass then shades each covered pixel once and
+ * writes the stored depth, so it composites against meshes already drawn to
+ * the current framebuffer. Shading cost follows screen pixels, not the number
+ * of overlapping proxies.
+ *
+ * With stats collection on, the counts attachment of one frame in every
+ * StatsInterval is summed into a small tile target on the GPU and read back
+ * at the next sample, when the GPU has long finished it. raylib only offers a
+ * synchronous texture read (no pixel buffer objects or fences), so sampling
+ * keeps that read off the current frame's work and off most frames entirely.
+ *
+ * Needs a GL context: init() from the render thread once the window exists.
+ */
+class DeferredSDF {
+public:
+    // Takes ownership of both shaders. Returns false if lighting or the targets
+    // are invalid; an invalid reduce shader only disables stats.
+    bool init(Shader lighting, Shader reduce, int width, int height);
+    bool isReady() const { return fbo != 0; }
+    void unload();
+
+    // Route SDF proxies into the G-buffer (re-creating it if the render size
+    // changed) and back. Call inside BeginMode3D.
+    void beginGeometry(int width, int height);
+    void endGeometry();
+
+    // Full-screen lighting pass into the current framebuffer
+    void light(Vector3 viewPos, const Matrix& invViewProj);
+
+    // Show the step-count heatmap unlit instead of the shaded membranes
+    void setHeatmap(bool enabled) { heatmap = enabled; }
+    void setCollectStats(bool enabled);
+
+    // Totals of the most recent sampled frame (up to 2 * StatsInterval frames old)
+    const RaymarchStats& getStats() const { return stats; }
+
+    Shader getLightingShader() const { return lighting; }
+
+    static constexpr int ReduceSize = 16;   // Tile target is ReduceSize x ReduceSize
+    static constexpr int StatsInterval = 30; // Frames between stats samples
+
+private:
+    Shader lighting{};
+    int viewPosLoc{-1};
+    int invViewProjLoc{-1};
+    int albedoLoc{-1};
+    int normalLoc{-1};
+    int depthLoc{-1};
+    int debugModeLoc{-1};
+
+    Shader reduce{};
+    int countsLoc{-1};
+    int tileSizeLoc{-1};
+
+    int width{0};
+    int height{0};
+    unsigned int fbo{0};
+    unsigned int albedoTexture{0};
+    unsigned int normalTexture{0};
+    unsigned int countsTexture{0};
+    unsigned int depthTexture{0};
+    unsigned int emptyVao{0};       // Core profile needs a bound VAO for the attribute-less triangle
+
+    // Double-buffered tile sums: one is written while the other is read
+    unsigned int reduceFbo[2]{};
+    unsigned int reduceTexture[2]{};
+    bool reducePending[2]{};
+    int reduceIndex{0};
+    int statsFrame{0};
+
+    bool heatmap{false};
+    bool collectStats{false};
+    bool countsActive{false};       // Counts attachment drawn (and blended) this frame
+    RaymarchStats stats;
+
+    bool createTargets(int w, int h);
+    void destroyTargets();
+    bool createReduceTargets();
+    void destroyReduceTargets();
+    void reduceCounts();
+    void readStats(int index);
+    void drawFullscreen();
+};
+
+} // namespace rendering
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,141 @@
+#include "InstancedBillboards.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+
+namespace micro_idle {
+namespace rendering {
+
+namespace {
+
+constexpr int InitialCapacity = 1024;
+
+// Two triangles covering [-1, 1]^2
+const float QuadCorners[12] = {
+    -1.0f, -1.0f,   1.0f, -1.0f,   1.0f,  1.0f,
+    -1.0f, -1.0f,   1.0f,  1.0f,  -1.0f,  1.0f
+};
+
+} // namespace
+
+bool InstancedBillboards::init(Shader newShader, int streams, bool byteStream) {
+    unload();
+    if (newShader.id == 0) {
+        return false;
+    }
+
+    shader = newShader;
+    mvpLoc = GetShaderLocation(shader, "mvp");
+    floatStreams = std::clamp(streams, 0, MaxFloatStreams);
+    hasByteStream = byteStream;
+
+    vao = rlLoadVertexArray();
+    rlEnableVertexArray(vao);
+    quadVbo = rlLoadVertexBuffer(QuadCorners, (int)sizeof(QuadCorners), false);
+    rlSetVertexAttribute(0, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(0);
+    rlDisableVertexArray();
+
+    createInstanceBuffers(InitialCapacity);
+    return true;
+}
+
+void InstancedBillboards::createInstanceBuffers(int instances) {
+    capacity = instances;
+    rlEnableVertexArray(vao);
+
+    for (int s = 0; s < floatStreams; s++) {
+        unsigned int location = (unsigned int)(1 + s);
+        floatVbo[s] = rlLoadVertexBuffer(nullptr, capacity * (int)sizeof(float), true);
+        rlSetVertexAttribute(location, 1, RL_FLOAT, false, 0, 0);
+        rlSetVertexAttributeDivisor(location, 1);
+        rlEnableVertexAttribute(location);
+    }
+
+    if (hasByteStream) {
+        unsigned int location = (unsigned int)(1 + floatStreams);
+        byteVbo = rlLoadVertexBuffer(nullptr, capacity, true);
+        rlSetVertexAttribute(location, 1, RL_UNSIGNED_BYTE, false, 0, 0);
+        rlSetVertexAttributeDivisor(location, 1);
+        rlEnableVertexAttribute(location);
+    }
+
+    rlDisableVertexArray();
+}
+
+void InstancedBillboards::destroyInstanceBuffers() {
+    for (int s = 0; s < MaxFloatStreams; s++) {
+        if (floatVbo[s] != 0) {
+            rlUnloadVertexBuffer(floatVbo[s]);
+            floatVbo[s] = 0;
+        }
+    }
+    if (byteVbo != 0) {
+        rlUnloadVertexBuffer(byteVbo);
+        byteVbo = 0;
+    }
+    capacity = 0;
+}
+
+void InstancedBillboards::reserve(int instances) {
+    if (!isReady() || instances <= capacity) {
+        return;
+    }
+    // Grow geometrically so a slowly rising count does not reallocate every frame
+    int grown = std::max(instances, capacity + capacity / 2);
+    destroyInstanceBuffers();
+    createInstanceBuffers(grown);
+}
+
+void InstancedBillboards::uploadFloatStream(int stream, const float* data, int count) {
+    if (!isReady() || stream < 0 || stream >= floatStreams || !data || count <= 0) {
+        return;
+    }
+    reserve(count);
+    rlUpdateVertexBuffer(floatVbo[stream], data, count * (int)sizeof(float), 0);
+}
+
+void InstancedBillboards::uploadByteStream(const uint8_t* data, int count) {
+    if (!isReady() || !hasByteStream || !data || count <= 0) {
+        return;
+    }
+    reserve(count);
+    rlUpdateVertexBuffer(byteVbo, data, count, 0);
+}
+
+void InstancedBillboards::draw(int instances) {
+    if (!isReady() || instances <= 0) {
+        return;
+    }
+    instances = std::min(instances, capacity);
+
+    // Anything raylib batched so far must land before our direct draw
+    rlDrawRenderBatchActive();
+
+    Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+    rlEnableShader(shader.id);
+    if (mvpLoc >= 0) {
+        rlSetUniformMatrix(mvpLoc, mvp);
+    }
+    rlEnableVertexArray(vao);
+    rlDrawVertexArrayInstanced(0, 6, instances);
+    rlDisableVertexArray();
+    rlDisableShader();
+}
+
+void InstancedBillboards::unload() {
+    if (vao == 0) {
+        return;
+    }
+    destroyInstanceBuffers();
+    rlUnloadVertexBuffer(quadVbo);
+    rlUnloadVertexArray(vao);
+    UnloadShader(shader);
+    quadVbo = 0;
+    vao = 0;
+    shader = Shader{};
+    mvpLoc = -1;
+}
+
+} // namespace rendering
+} // namespace micro_idle
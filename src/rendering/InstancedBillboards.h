@@ -0,0 +1,60 @@
+#ifndef MICRO_IDLE_INSTANCED_BILLBOARDS_H
+#define MICRO_IDLE_INSTANCED_BILLBOARDS_H
+
+#include <cstdint>
+#include "raylib.h"
+
+namespace micro_idle {
+namespace rendering {
+
+/**
+ * One instanced draw call for many small flat sprites/impostors
+ *
+ * Geometry is a single unit quad (attribute 0, vec2 corner in [-1, 1]). Every
+ * per-instance attribute is its own tightly packed buffer, so SoA simulation
+ * arrays upload with one memcpy each and no interleaving pass:
+ *   locations 1..floatStreams   one float per instance
+ *   next location (optional)     one unsigned byte per instance (read as float)
+ *
+ * Needs a GL context: init() from the render thread once the window exists.
+ */
+class InstancedBillboards {
+public:
+    static constexpr int MaxFloatStreams = 4;
+
+    // Takes ownership of the shader. Returns false if the shader is invalid.
+    bool init(Shader shader, int floatStreams, bool byteStream);
+    bool isReady() const { return vao != 0; }
+    void unload();
+
+    // Grow the instance buffers to hold at least `instances` (never shrinks)
+    void reserve(int instances);
+
+    void uploadFloatStream(int stream, const float* data, int count);
+    void uploadByteStream(const uint8_t* data, int count);
+
+    // Draw `instances` quads with the current modelview/projection as `mvp`.
+    // Call inside BeginMode3D; flushes raylib's batch first.
+    void draw(int instances);
+
+    Shader getShader() const { return shader; }
+
+private:
+    Shader shader{};
+    int mvpLoc{-1};
+    int floatStreams{0};
+    bool hasByteStream{false};
+    int capacity{0};
+    unsigned int vao{0};
+    unsigned int quadVbo{0};
+    unsigned int floatVbo[MaxFloatStreams]{};
+    unsigned int byteVbo{0};
+
+    void createInstanceBuffers(int instances);
+    void destroyInstanceBuffers();
+};
+
+} // namespace rendering
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,120 @@
+#include "InstancedShells.h"
+#include "src/physics/Icosphere.h"
+#include "raymath.h"
+
+namespace micro_idle {
+namespace rendering {
+
+namespace {
+
+// Flat-shaded unit icosahedron (one normal per face, so three vertices each)
+Mesh genIcosahedron() {
+    IcosphereMesh ico = GenerateIcosphere(0, 1.0f);
+
+    Mesh mesh = {0};
+    mesh.vertexCount = ico.triangleCount * 3;
+    mesh.triangleCount = ico.triangleCount;
+    mesh.vertices = (float*)MemAlloc((unsigned int)(mesh.vertexCount * 3 * sizeof(float)));
+    mesh.normals = (float*)MemAlloc((unsigned int)(mesh.vertexCount * 3 * sizeof(float)));
+
+    for (int t = 0; t < ico.triangleCount; t++) {
+        Vector3 a = ico.vertices[(size_t)ico.triangles[(size_t)t * 3 + 0]];
+        Vector3 b = ico.vertices[(size_t)ico.triangles[(size_t)t * 3 + 1]];
+        Vector3 c = ico.vertices[(size_t)ico.triangles[(size_t)t * 3 + 2]];
+        Vector3 n = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+
+        // Wind counter-clockwise seen from outside
+        if (Vector3DotProduct(n, Vector3Add(Vector3Add(a, b), c)) < 0.0f) {
+            Vector3 swap = b;
+            b = c;
+            c = swap;
+            n = Vector3Negate(n);
+        }
+
+        const Vector3 corners[3] = {a, b, c};
+        for (int k = 0; k < 3; k++) {
+            int v = (t * 3 + k) * 3;
+            mesh.vertices[v + 0] = corners[k].x;
+            mesh.vertices[v + 1] = corners[k].y;
+            mesh.vertices[v + 2] = corners[k].z;
+            mesh.normals[v + 0] = n.x;
+            mesh.normals[v + 1] = n.y;
+            mesh.normals[v + 2] = n.z;
+        }
+    }
+
+    UploadMesh(&mesh, false);
+    return mesh;
+}
+
+} // namespace
+
+bool InstancedShells::init(Shader shader) {
+    unload();
+    if (shader.id == 0) {
+        return false;
+    }
+
+    // DrawMeshInstanced feeds the per-instance matrices to the model matrix attribute
+    shader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(shader, "mvp");
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+    viewPosLoc = GetShaderLocation(shader, "viewPos");
+
+    material = LoadMaterialDefault();
+    material.shader = shader;
+
+    meshes[(int)ShellPart::Icosahedron] = genIcosahedron();
+    meshes[(int)ShellPart::Cylinder] = GenMeshCylinder(1.0f, 1.0f, 16);
+    meshes[(int)ShellPart::Cone] = GenMeshCone(1.0f, 1.0f, 6);
+
+    ready = true;
+    return true;
+}
+
+void InstancedShells::unload() {
+    if (!ready) {
+        return;
+    }
+    for (Mesh& mesh : meshes) {
+        UnloadMesh(mesh);
+        mesh = Mesh{0};
+    }
+    // Also unloads the shader
+    UnloadMaterial(material);
+    material = Material{};
+    for (auto& list : instances) {
+        list.clear();
+    }
+    ready = false;
+}
+
+Matrix InstancedShells::packInstance(const Matrix& transform, Color color) {
+    Matrix packed = transform;
+    packed.m3 = (float)color.r / 255.0f;
+    packed.m7 = (float)color.g / 255.0f;
+    packed.m11 = (float)color.b / 255.0f;
+    packed.m15 = 1.0f;
+    return packed;
+}
+
+void InstancedShells::add(ShellPart part, const Matrix& transform, Color color) {
+    instances[(int)part].push_back(packInstance(transform, color));
+}
+
+void InstancedShells::draw(Vector3 viewPosition) {
+    if (!ready) {
+        return;
+    }
+
+    SetShaderValue(material.shader, viewPosLoc, &viewPosition, SHADER_UNIFORM_VEC3);
+    for (int p = 0; p < (int)ShellPart::Count; p++) {
+        std::vector<Matrix>& list = instances[p];
+        if (!list.empty()) {
+            DrawMeshInstanced(meshes[p], material, list.data(), (int)list.size());
+            list.clear();
+        }
+    }
+}
+
+} // namespace rendering
+} // namespace micro_idle
@@ -0,0 +1,57 @@
+#ifndef MICRO_IDLE_INSTANCED_SHELLS_H
+#define MICRO_IDLE_INSTANCED_SHELLS_H
+
+#include <vector>
+#include "raylib.h"
+
+namespace micro_idle {
+namespace rendering {
+
+// Unit meshes the shells are built from
+enum class ShellPart {
+    Icosahedron,    // Radius 1, flat shaded
+    Cylinder,       // Radius 1, y in [0, 1]
+    Cone,           // Base radius 1 at y = 0, tip at y = 1
+    Count
+};
+
+/**
+ * Rigid shell meshes drawn with one instanced call per part
+ *
+ * Each instance is a model matrix plus a colour. Row 3 of an affine transform
+ * is always (0, 0, 0, 1), so the colour rides in it and the instance buffer
+ * stays one mat4 per instance (see packInstance and shell_instanced.vert).
+ *
+ * Shells write depth like any mesh; the SDF pass writes the depth of its
+ * raymarched hit, so the two intersect correctly whichever draws first.
+ *
+ * Needs a GL context: init() from the render thread once the window exists.
+ */
+class InstancedShells {
+public:
+    // Takes ownership of the shader. Returns false if the shader is invalid.
+    bool init(Shader shader);
+    bool isReady() const { return ready; }
+    void unload();
+
+    void add(ShellPart part, const Matrix& transform, Color color);
+    const std::vector<Matrix>& queued(ShellPart part) const { return instances[(int)part]; }
+
+    // Draw and clear everything added since the last draw. Call inside BeginMode3D.
+    void draw(Vector3 viewPosition);
+
+    // Store `color` in the transform's bottom row
+    static Matrix packInstance(const Matrix& transform, Color color);
+
+private:
+    bool ready{false};
+    Material material{};
+    Mesh meshes[(int)ShellPart::Count]{};
+    std::vector<Matrix> instances[(int)ShellPart::Count];
+    int viewPosLoc{-1};
+};
+
+} // namespace rendering
+} // namespace micro_idle
+
+#endif
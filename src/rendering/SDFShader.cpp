@@ -30,19 +30,16 @@ std::string joinPath(const char* base, const char* suffix) {
 
 } // namespace
 
-Shader loadSDFMembraneShader() {
-    // Try multiple paths to find the shader files
-    const char* paths[][2] = {
-        {"../shaders/sdf_membrane.vert", "../shaders/sdf_membrane.frag"},
-        {"shaders/sdf_membrane.vert", "shaders/sdf_membrane.frag"},
-        {"../data/shaders/sdf_membrane.vert", "../data/shaders/sdf_membrane.frag"},
-        {"data/shaders/sdf_membrane.vert", "data/shaders/sdf_membrane.frag"}
-    };
+Shader loadShaderFromDataPaths(const char* vertFile, const char* fragFile) {
+    // Try the shader folders relative to the working directory, then next to the executable
+    const char* dirs[] = {"../shaders/", "shaders/", "../data/shaders/", "data/shaders/"};
 
     Shader shader = {0};
 
-    for (int i = 0; i < 4; i++) {
-        if (tryLoadShader(shader, paths[i][0], paths[i][1])) {
+    for (const char* dir : dirs) {
+        std::string vert = std::string(dir) + vertFile;
+        std::string frag = std::string(dir) + fragFile;
+        if (tryLoadShader(shader, vert.c_str(), frag.c_str())) {
             break;
         }
     }
@@ -50,25 +47,24 @@ Shader loadSDFMembraneShader() {
     if (shader.id == 0) {
         const char* appDir = GetApplicationDirectory();
         if (appDir && appDir[0] != '\0') {
-            std::string appShadersVert = joinPath(appDir, "shaders/sdf_membrane.vert");
-            std::string appShadersFrag = joinPath(appDir, "shaders/sdf_membrane.frag");
-            std::string appDataVert = joinPath(appDir, "data/shaders/sdf_membrane.vert");
-            std::string appDataFrag = joinPath(appDir, "data/shaders/sdf_membrane.frag");
-            std::string parentShadersVert = joinPath(appDir, "../shaders/sdf_membrane.vert");
-            std::string parentShadersFrag = joinPath(appDir, "../shaders/sdf_membrane.frag");
-            std::string parentDataVert = joinPath(appDir, "../data/shaders/sdf_membrane.vert");
-            std::string parentDataFrag = joinPath(appDir, "../data/shaders/sdf_membrane.frag");
-
-            tryLoadShader(shader, appShadersVert.c_str(), appShadersFrag.c_str());
-            tryLoadShader(shader, appDataVert.c_str(), appDataFrag.c_str());
-            tryLoadShader(shader, parentShadersVert.c_str(), parentShadersFrag.c_str());
-            tryLoadShader(shader, parentDataVert.c_str(), parentDataFrag.c_str());
+            const char* appDirs[] = {"shaders/", "data/shaders/", "../shaders/", "../data/shaders/"};
+            for (const char* dir : appDirs) {
+                std::string vert = joinPath(appDir, (std::string(dir) + vertFile).c_str());
+                std::string frag = joinPath(appDir, (std::string(dir) + fragFile).c_str());
+                if (tryLoadShader(shader, vert.c_str(), frag.c_str())) {
+                    break;
+                }
+            }
         }
     }
 
     return shader;
 }
 
+Shader loadSDFMembraneShader() {
+    return loadShaderFromDataPaths("sdf_membrane.vert", "sdf_membrane.frag");
+}
+
 bool initializeSDFUniforms(Shader shader, SDFShaderUniforms& uniforms) {
     if (shader.id == 0) {
         return false;
@@ -85,6 +81,10 @@ bool initializeSDFUniforms(Shader shader, SDFShaderUniforms& uniforms) {
     uniforms.podExtents = GetShaderLocation(shader, "podExtents[0]");
     uniforms.podAnchors = GetShaderLocation(shader, "podAnchors[0]");
     uniforms.podCount = GetShaderLocation(shader, "podCount");
+    uniforms.microbeId = GetShaderLocation(shader, "microbeId");
+    uniforms.debugMode = GetShaderLocation(shader, "debugMode");
+    uniforms.relaxedTracing = GetShaderLocation(shader, "relaxedTracing");
+    uniforms.collectStats = GetShaderLocation(shader, "collectStats");
 
     // Check that critical uniforms were found
     return uniforms.viewPos >= 0 &&
@@ -110,6 +110,35 @@ void setTime(Shader shader, const SDFShaderUniforms& uniforms, float time) {
     SetShaderValue(shader, uniforms.time, &time, SHADER_UNIFORM_FLOAT);
 }
 
+void setMicrobeId(Shader shader, const SDFShaderUniforms& uniforms, int id) {
+    if (shader.id == 0 || uniforms.microbeId < 0) {
+        return;
+    }
+
+    float value = (float)id;
+    SetShaderValue(shader, uniforms.microbeId, &value, SHADER_UNIFORM_FLOAT);
+}
+
+void setRaymarchMode(Shader shader, const SDFShaderUniforms& uniforms, bool heatmap, bool relaxed,
+                     bool collectStats) {
+    if (shader.id == 0) {
+        return;
+    }
+
+    int debugMode = heatmap ? 1 : 0;
+    int relaxedTracing = relaxed ? 1 : 0;
+    int stats = collectStats ? 1 : 0;
+    if (uniforms.debugMode >= 0) {
+        SetShaderValue(shader, uniforms.debugMode, &debugMode, SHADER_UNIFORM_INT);
+    }
+    if (uniforms.relaxedTracing >= 0) {
+        SetShaderValue(shader, uniforms.relaxedTracing, &relaxedTracing, SHADER_UNIFORM_INT);
+    }
+    if (uniforms.collectStats >= 0) {
+        SetShaderValue(shader, uniforms.collectStats, &stats, SHADER_UNIFORM_INT);
+    }
+}
+
 void setMicrobeUniforms(Shader shader, const SDFShaderUniforms& uniforms,
                         int vertexCount, float baseRadius, Color microbeColor) {
     if (shader.id == 0) {
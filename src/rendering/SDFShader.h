@@ -20,8 +20,17 @@ struct SDFShaderUniforms {
     int podExtents{-1};
     int podAnchors{-1};
     int podCount{-1};
+    int microbeId{-1};
+    int debugMode{-1};
+    int relaxedTracing{-1};
+    int collectStats{-1};
 };
 
+// Load a vertex/fragment pair by file name from the standard shader folders
+// (shaders/, data/shaders/, relative to the working and executable directories)
+// Returns shader with id=0 on failure
+Shader loadShaderFromDataPaths(const char* vertFile, const char* fragFile);
+
 // Load SDF membrane shader from standard paths
 // Returns shader with id=0 on failure
 Shader loadSDFMembraneShader();
@@ -40,6 +49,14 @@ void setTime(Shader shader, const SDFShaderUniforms& uniforms, float time);
 void setMicrobeUniforms(Shader shader, const SDFShaderUniforms& uniforms,
                         int vertexCount, float baseRadius, Color microbeColor);
 
+// Set the G-buffer id written by this microbe's proxy (1-based; 0 = empty)
+void setMicrobeId(Shader shader, const SDFShaderUniforms& uniforms, int id);
+
+// Select the step-count heatmap and/or over-relaxed sphere tracing; with stats
+// on, rays that miss still record their work in the counts attachment
+void setRaymarchMode(Shader shader, const SDFShaderUniforms& uniforms, bool heatmap, bool relaxed,
+                     bool collectStats);
+
 // Set vertex positions uniform array (called for each microbe)
 void setVertexPositions(Shader shader, const SDFShaderUniforms& uniforms,
                         const Vector3* positions, int count);
@@ -0,0 +1,113 @@
+#include "InputRecording.h"
+
+namespace micro_idle {
+namespace replay {
+
+namespace {
+
+void recordButton(std::vector<ScenarioEvent>& events, int tick, int button,
+                  bool pressed, bool down, bool wasDown) {
+    if (pressed || (down && !wasDown)) {
+        events.push_back({tick, ScenarioEventType::Press, button, 0.0f, 0.0f});
+    }
+    if (!down && (wasDown || pressed)) {
+        events.push_back({tick, ScenarioEventType::Release, button, 0.0f, 0.0f});
+    }
+}
+
+} // namespace
+
+void InputRecorder::begin(const Scenario& header) {
+    scenario = header;
+    scenario.events.clear();
+    scenario.durationTicks = 0;
+    previous = components::InputState{};
+    active = true;
+}
+
+void InputRecorder::recordTick(int tick, const components::InputState& input) {
+    if (!active) {
+        return;
+    }
+
+    auto& events = scenario.events;
+    if (input.mouseWorldValid) {
+        if (!previous.mouseWorldValid ||
+            input.mouseWorld.x != previous.mouseWorld.x ||
+            input.mouseWorld.z != previous.mouseWorld.z) {
+            events.push_back({tick, ScenarioEventType::Cursor, 0, input.mouseWorld.x, input.mouseWorld.z});
+        }
+    } else if (previous.mouseWorldValid) {
+        events.push_back({tick, ScenarioEventType::CursorLost, 0, 0.0f, 0.0f});
+    }
+
+    recordButton(events, tick, ScenarioButtonLeft,
+                 input.mouseLeftPressed, input.mouseLeftDown, previous.mouseLeftDown);
+    recordButton(events, tick, ScenarioButtonRight,
+                 input.mouseRightPressed, input.mouseRightDown, previous.mouseRightDown);
+
+    previous = input;
+}
+
+void InputRecorder::recordDish(int tick, float width, float height) {
+    if (active) {
+        scenario.events.push_back({tick, ScenarioEventType::Dish, 0, width, height});
+    }
+}
+
+void InputRecorder::recordSimMode(int tick, bool reduced) {
+    if (active) {
+        scenario.events.push_back({tick, ScenarioEventType::SimMode, reduced ? 1 : 0, 0.0f, 0.0f});
+    }
+}
+
+void InputRecorder::recordFastForward(int tick, float seconds) {
+    if (active) {
+        scenario.events.push_back({tick, ScenarioEventType::FastForward, 0, seconds, 0.0f});
+    }
+}
+
+const Scenario& InputRecorder::finish(int ticksElapsed) {
+    scenario.durationTicks = ticksElapsed;
+    active = false;
+    return scenario;
+}
+
+InputPlayback::InputPlayback(const Scenario& scenario)
+    : scenario(&scenario) {
+}
+
+void InputPlayback::applyTick(int tick, components::InputState& input, std::vector<ScenarioEvent>& outOther) {
+    // Press edges last exactly one tick
+    input.mouseLeftPressed = false;
+    input.mouseRightPressed = false;
+    input.injected = true;
+
+    const auto& events = scenario->events;
+    while (next < events.size() && events[next].tick <= tick) {
+        const ScenarioEvent& e = events[next++];
+        bool left = e.button == ScenarioButtonLeft;
+        switch (e.type) {
+            case ScenarioEventType::Cursor:
+                input.mouseWorld = {e.x, 0.0f, e.z};
+                input.mouseWorldValid = true;
+                break;
+            case ScenarioEventType::CursorLost:
+                input.mouseWorldValid = false;
+                break;
+            case ScenarioEventType::Press:
+                (left ? input.mouseLeftDown : input.mouseRightDown) = true;
+                (left ? input.mouseLeftPressed : input.mouseRightPressed) = true;
+                break;
+            case ScenarioEventType::Release:
+                (left ? input.mouseLeftDown : input.mouseRightDown) = false;
+                break;
+            default:
+                outOther.push_back(e);
+                break;
+        }
+    }
+}
+
+} // namespace replay
+} // namespace micro_idle
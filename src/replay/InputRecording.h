@@ -0,0 +1,56 @@
+#ifndef MICRO_IDLE_INPUT_RECORDING_H
+#define MICRO_IDLE_INPUT_RECORDING_H
+
+#include "Scenario.h"
+#include "src/components/Input.h"
+#include <cstddef>
+
+namespace micro_idle {
+namespace replay {
+
+// Captures the InputState each fixed tick actually saw during play, plus the
+// out-of-band events that change the simulation (resize, sim mode, fast-forward),
+// as scenario events. Only changes are stored, so idle stretches cost nothing.
+class InputRecorder {
+public:
+    // Header (seed, dish, tick rate, spawn settings) comes from the caller
+    void begin(const Scenario& header);
+
+    // Call once per fixed tick with the input the tick consumed
+    void recordTick(int tick, const components::InputState& input);
+
+    void recordDish(int tick, float width, float height);
+    void recordSimMode(int tick, bool reduced);
+    void recordFastForward(int tick, float seconds);
+
+    // Recording with durationTicks set to the last recorded tick + 1
+    const Scenario& finish(int ticksElapsed);
+    const Scenario& recording() const { return scenario; }
+    bool isActive() const { return active; }
+
+private:
+    Scenario scenario;
+    components::InputState previous;
+    bool active{false};
+};
+
+// Applies scenario events to an injected InputState tick by tick
+class InputPlayback {
+public:
+    explicit InputPlayback(const Scenario& scenario);
+
+    // Input events for `tick` are applied to `input`; non-input events
+    // (dish, sim mode, fast-forward) are returned through `outOther` for the runner.
+    void applyTick(int tick, components::InputState& input, std::vector<ScenarioEvent>& outOther);
+
+    bool finished() const { return next >= scenario->events.size(); }
+
+private:
+    const Scenario* scenario;
+    size_t next{0};
+};
+
+} // namespace replay
+} // namespace micro_idle
+
+#endif
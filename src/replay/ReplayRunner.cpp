@@ -0,0 +1,181 @@
+#include "ReplayRunner.h"
+#include "InputRecording.h"
+#include "src/World.h"
+#include "src/components/Input.h"
+#include "src/components/Microbe.h"
+#include "src/components/Resource.h"
+#include "src/components/Transform.h"
+#include "src/components/WorldState.h"
+#include "src/swarm/BacteriaSwarm.h"
+#include "src/systems/SpawnSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+namespace micro_idle {
+namespace replay {
+
+namespace {
+
+uint64_t fnv1a(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = (size_t)(p * (double)(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+void applyWorldEvent(World& world, const ScenarioEvent& e) {
+    switch (e.type) {
+        case ScenarioEventType::Dish:
+            // Same sequence as game_handle_resize
+            world.updateScreenBoundaries(e.x, e.z);
+            world.repositionMicrobesInBounds(e.x, e.z);
+            break;
+        case ScenarioEventType::SimMode:
+            world.setReducedFidelity(e.button != 0);
+            break;
+        case ScenarioEventType::FastForward:
+            world.fastForward(e.x);
+            break;
+        default:
+            break;
+    }
+}
+
+void collectMetrics(World& world, ReplayMetrics& metrics) {
+    flecs::world& ecs = world.getWorld();
+    metrics.microbes = ecs.count<components::Microbe>();
+    auto drops = ecs.get<components::ResourceDrops>();
+    metrics.resources = drops ? drops->size() : 0;
+
+    auto inventory = ecs.get<components::ResourceInventory>();
+    metrics.inventoryTotal = inventory
+        ? inventory->sodium + inventory->glucose + inventory->iron + inventory->calcium +
+          inventory->lipids + inventory->oxygen + inventory->signalingMolecules
+        : 0.0f;
+
+    uint64_t hash = 0xCBF29CE484222325ull;
+    ecs.each([&hash](components::Microbe&, components::Transform& transform) {
+        hash = fnv1a(hash, &transform.position, sizeof(transform.position));
+    });
+    metrics.positionChecksum = hash;
+
+    const BacteriaSwarm& swarm = world.getSwarm();
+    uint64_t swarmHash = 0xCBF29CE484222325ull;
+    swarmHash = fnv1a(swarmHash, swarm.positionsX(), sizeof(float) * (size_t)swarm.size());
+    swarmHash = fnv1a(swarmHash, swarm.positionsZ(), sizeof(float) * (size_t)swarm.size());
+    metrics.swarmChecksum = swarmHash;
+}
+
+} // namespace
+
+bool runScenario(const Scenario& scenario, ReplayMetrics& metrics, ReplayTiming* timing, std::string* error) {
+    if (scenario.tickHz <= 0 || scenario.durationTicks < 0) {
+        if (error) {
+            *error = "scenario needs a positive tick_hz and non-negative duration";
+        }
+        return false;
+    }
+
+    metrics = ReplayMetrics{};
+
+    World world(scenario.seed);
+    flecs::world& ecs = world.getWorld();
+    world.createScreenBoundaries(scenario.dishWidth, scenario.dishHeight);
+    SpawnSystem::setSpawnRate(ecs, scenario.spawnRate);
+    if (auto worldState = ecs.get_mut<components::WorldState>()) {
+        worldState->spawnEnabled = scenario.spawnEnabled;
+    }
+
+    if (scenario.starters) {
+        world.createStarterMicrobes(scenario.dishWidth, scenario.dishHeight);
+    }
+    world.setAmbientBacteria(scenario.ambientBacteria);
+    for (const auto& population : scenario.populations) {
+        metrics.skippedPopulation += population.count - world.spawnPopulation(population.type, population.count);
+    }
+
+    InputPlayback playback(scenario);
+    std::vector<ScenarioEvent> worldEvents;
+    std::vector<double> tickMs;
+    tickMs.reserve((size_t)scenario.durationTicks);
+    float dt = 1.0f / (float)scenario.tickHz;
+
+    for (int tick = 0; tick < scenario.durationTicks; tick++) {
+        worldEvents.clear();
+        auto input = ecs.get_mut<components::InputState>();
+        playback.applyTick(tick, *input, worldEvents);
+        for (const auto& e : worldEvents) {
+            applyWorldEvent(world, e);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        world.update(dt);
+        auto end = std::chrono::steady_clock::now();
+        tickMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    metrics.ticks = scenario.durationTicks;
+    collectMetrics(world, metrics);
+
+    if (timing) {
+        *timing = ReplayTiming{};
+        for (double ms : tickMs) {
+            timing->totalMs += ms;
+        }
+        std::sort(tickMs.begin(), tickMs.end());
+        if (!tickMs.empty()) {
+            timing->tickMeanMs = timing->totalMs / (double)tickMs.size();
+            timing->tickMaxMs = tickMs.back();
+        }
+        timing->tickP50Ms = percentile(tickMs, 0.50);
+        timing->tickP95Ms = percentile(tickMs, 0.95);
+        timing->tickP99Ms = percentile(tickMs, 0.99);
+    }
+    return true;
+}
+
+bool metricsEqual(const ReplayMetrics& a, const ReplayMetrics& b) {
+    return a.ticks == b.ticks &&
+           a.microbes == b.microbes &&
+           a.resources == b.resources &&
+           a.skippedPopulation == b.skippedPopulation &&
+           std::memcmp(&a.inventoryTotal, &b.inventoryTotal, sizeof(float)) == 0 &&
+           a.positionChecksum == b.positionChecksum &&
+           a.swarmChecksum == b.swarmChecksum;
+}
+
+void printMetrics(FILE* out, const Scenario& scenario, const ReplayMetrics& metrics) {
+    std::fprintf(out, "scenario=%s\n", scenario.name.c_str());
+    std::fprintf(out, "seed=0x%llX\n", (unsigned long long)scenario.seed);
+    std::fprintf(out, "ticks=%d\n", metrics.ticks);
+    std::fprintf(out, "microbes=%d\n", metrics.microbes);
+    std::fprintf(out, "resources=%d\n", metrics.resources);
+    std::fprintf(out, "skipped_population=%d\n", metrics.skippedPopulation);
+    std::fprintf(out, "inventory_total=%.9g\n", (double)metrics.inventoryTotal);
+    std::fprintf(out, "position_checksum=0x%016llX\n", (unsigned long long)metrics.positionChecksum);
+    std::fprintf(out, "swarm_checksum=0x%016llX\n", (unsigned long long)metrics.swarmChecksum);
+}
+
+void printTiming(FILE* out, const ReplayTiming& timing) {
+    std::fprintf(out, "timing.total_ms=%.3f\n", timing.totalMs);
+    std::fprintf(out, "timing.tick_mean_ms=%.4f\n", timing.tickMeanMs);
+    std::fprintf(out, "timing.tick_p50_ms=%.4f\n", timing.tickP50Ms);
+    std::fprintf(out, "timing.tick_p95_ms=%.4f\n", timing.tickP95Ms);
+    std::fprintf(out, "timing.tick_p99_ms=%.4f\n", timing.tickP99Ms);
+    std::fprintf(out, "timing.tick_max_ms=%.4f\n", timing.tickMaxMs);
+}
+
+} // namespace replay
+} // namespace micro_idle
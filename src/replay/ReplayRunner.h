@@ -0,0 +1,46 @@
+#ifndef MICRO_IDLE_REPLAY_RUNNER_H
+#define MICRO_IDLE_REPLAY_RUNNER_H
+
+#include "Scenario.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace micro_idle {
+namespace replay {
+
+// Simulation outcome of a run. Identical for every run of the same scenario on
+// the same build; compare these before trusting a timing difference.
+struct ReplayMetrics {
+    int ticks{0};
+    int microbes{0};
+    int resources{0};
+    int skippedPopulation{0};     // requested microbes that could not be spawned
+    float inventoryTotal{0.0f};
+    uint64_t positionChecksum{0}; // FNV-1a over microbe position bits, entity order
+    uint64_t swarmChecksum{0};    // FNV-1a over ambient swarm positions
+};
+
+// Wall-clock cost of the fixed ticks (World::update only, setup excluded)
+struct ReplayTiming {
+    double totalMs{0.0};
+    double tickMeanMs{0.0};
+    double tickP50Ms{0.0};
+    double tickP95Ms{0.0};
+    double tickP99Ms{0.0};
+    double tickMaxMs{0.0};
+};
+
+// Run a scenario headless (no window needed). timing may be null.
+bool runScenario(const Scenario& scenario, ReplayMetrics& metrics, ReplayTiming* timing, std::string* error);
+
+bool metricsEqual(const ReplayMetrics& a, const ReplayMetrics& b);
+
+// `key=value` lines: metrics are stable across runs, timing lines are prefixed `timing.`
+void printMetrics(FILE* out, const Scenario& scenario, const ReplayMetrics& metrics);
+void printTiming(FILE* out, const ReplayTiming& timing);
+
+} // namespace replay
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,339 @@
+#include "Scenario.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace micro_idle {
+namespace replay {
+
+namespace {
+
+struct TypeName {
+    components::MicrobeType type;
+    const char* name;
+};
+
+const TypeName TypeNames[] = {
+    {components::MicrobeType::Amoeba, "amoeba"},
+    {components::MicrobeType::Stentor, "stentor"},
+    {components::MicrobeType::Lacrymaria, "lacrymaria"},
+    {components::MicrobeType::Vorticella, "vorticella"},
+    {components::MicrobeType::Didinium, "didinium"},
+    {components::MicrobeType::Heliozoa, "heliozoa"},
+    {components::MicrobeType::Radiolarian, "radiolarian"},
+    {components::MicrobeType::Diatom, "diatom"},
+    {components::MicrobeType::Coccus, "coccus"},
+    {components::MicrobeType::Bacillus, "bacillus"},
+    {components::MicrobeType::Vibrio, "vibrio"},
+    {components::MicrobeType::Spirillum, "spirillum"},
+    {components::MicrobeType::Icosahedral, "icosahedral"},
+    {components::MicrobeType::Bacteriophage, "bacteriophage"},
+};
+
+// Event before tick conversion (tick_hz may appear after the events)
+struct PendingEvent {
+    double time;
+    ScenarioEvent event;
+};
+
+std::string trim(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r");
+    return s.substr(begin, end - begin + 1);
+}
+
+bool parseOnOff(const std::string& value, bool& out) {
+    if (value == "on" || value == "true" || value == "1") {
+        out = true;
+        return true;
+    }
+    if (value == "off" || value == "false" || value == "0") {
+        out = false;
+        return true;
+    }
+    return false;
+}
+
+bool parseButton(const std::string& value, int& out) {
+    if (value == "left") {
+        out = ScenarioButtonLeft;
+        return true;
+    }
+    if (value == "right") {
+        out = ScenarioButtonRight;
+        return true;
+    }
+    return false;
+}
+
+// `<seconds> <kind> <args...>`
+bool parseEvent(const std::string& value, PendingEvent& out, std::string& why) {
+    std::istringstream in(value);
+    std::string kind;
+    if (!(in >> out.time) || out.time < 0.0 || !(in >> kind)) {
+        why = "expected `<seconds> <event> ...`";
+        return false;
+    }
+
+    ScenarioEvent& e = out.event;
+    std::string arg;
+    if (kind == "cursor") {
+        if (!(in >> arg)) {
+            why = "cursor needs `<x> <z>` or `none`";
+            return false;
+        }
+        if (arg == "none") {
+            e.type = ScenarioEventType::CursorLost;
+        } else {
+            e.type = ScenarioEventType::Cursor;
+            char* end = nullptr;
+            e.x = std::strtof(arg.c_str(), &end);
+            if (*end != '\0' || !(in >> e.z)) {
+                why = "cursor needs `<x> <z>` or `none`";
+                return false;
+            }
+        }
+    } else if (kind == "press" || kind == "release") {
+        e.type = kind == "press" ? ScenarioEventType::Press : ScenarioEventType::Release;
+        if (!(in >> arg) || !parseButton(arg, e.button)) {
+            why = "expected button `left` or `right`";
+            return false;
+        }
+    } else if (kind == "dish") {
+        e.type = ScenarioEventType::Dish;
+        if (!(in >> e.x >> e.z) || e.x <= 0.0f || e.z <= 0.0f) {
+            why = "dish needs positive `<width> <height>`";
+            return false;
+        }
+    } else if (kind == "sim_mode") {
+        e.type = ScenarioEventType::SimMode;
+        if (!(in >> arg) || (arg != "full" && arg != "reduced")) {
+            why = "sim_mode needs `full` or `reduced`";
+            return false;
+        }
+        e.button = arg == "reduced" ? 1 : 0;
+    } else if (kind == "fast_forward") {
+        e.type = ScenarioEventType::FastForward;
+        if (!(in >> e.x) || e.x < 0.0f) {
+            why = "fast_forward needs `<seconds>`";
+            return false;
+        }
+    } else {
+        why = "unknown event `" + kind + "`";
+        return false;
+    }
+
+    if (in >> arg) {
+        why = "trailing text after event";
+        return false;
+    }
+    return true;
+}
+
+// Shortest text that parses back to the same float
+std::string formatFloat(float value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", (double)value);
+    return buffer;
+}
+
+std::string formatTime(int tick, int tickHz) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", (double)tick / (double)tickHz);
+    return buffer;
+}
+
+} // namespace
+
+const char* microbeTypeName(components::MicrobeType type) {
+    for (const auto& entry : TypeNames) {
+        if (entry.type == type) {
+            return entry.name;
+        }
+    }
+    return "unknown";
+}
+
+bool microbeTypeFromName(const std::string& name, components::MicrobeType& out) {
+    for (const auto& entry : TypeNames) {
+        if (name == entry.name) {
+            out = entry.type;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parseScenario(const std::string& text, Scenario& out, std::string* error) {
+    Scenario scenario;
+    std::vector<PendingEvent> pending;
+    double durationSeconds = -1.0;
+
+    auto fail = [error](int line, const std::string& why) {
+        if (error) {
+            *error = "line " + std::to_string(line) + ": " + why;
+        }
+        return false;
+    };
+
+    std::istringstream lines(text);
+    std::string raw;
+    int lineNumber = 0;
+    while (std::getline(lines, raw)) {
+        lineNumber++;
+        size_t comment = raw.find('#');
+        std::string line = trim(comment == std::string::npos ? raw : raw.substr(0, comment));
+        if (line.empty()) {
+            continue;
+        }
+
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) {
+            return fail(lineNumber, "expected `key = value`");
+        }
+        std::string key = trim(line.substr(0, eq));
+        std::string value = trim(line.substr(eq + 1));
+        std::istringstream in(value);
+        bool ok = true;
+
+        if (key == "name") {
+            scenario.name = value;
+        } else if (key == "seed") {
+            char* end = nullptr;
+            scenario.seed = std::strtoull(value.c_str(), &end, 0);
+            ok = !value.empty() && *end == '\0';
+        } else if (key == "dish") {
+            ok = (bool)(in >> scenario.dishWidth >> scenario.dishHeight) &&
+                 scenario.dishWidth > 0.0f && scenario.dishHeight > 0.0f;
+        } else if (key == "tick_hz") {
+            ok = (bool)(in >> scenario.tickHz) && scenario.tickHz > 0;
+        } else if (key == "duration") {
+            ok = (bool)(in >> durationSeconds) && durationSeconds >= 0.0;
+        } else if (key == "ticks") {
+            ok = (bool)(in >> scenario.durationTicks) && scenario.durationTicks >= 0;
+        } else if (key == "spawn_rate") {
+            ok = (bool)(in >> scenario.spawnRate) && scenario.spawnRate >= 0.0f;
+        } else if (key == "spawn") {
+            ok = parseOnOff(value, scenario.spawnEnabled);
+        } else if (key == "starters") {
+            ok = parseOnOff(value, scenario.starters);
+        } else if (key == "ambient_bacteria") {
+            ok = (bool)(in >> scenario.ambientBacteria) && scenario.ambientBacteria >= 0;
+        } else if (key.rfind("population.", 0) == 0) {
+            ScenarioPopulation population;
+            if (!microbeTypeFromName(key.substr(11), population.type)) {
+                return fail(lineNumber, "unknown microbe type `" + key.substr(11) + "`");
+            }
+            ok = (bool)(in >> population.count) && population.count >= 0;
+            scenario.populations.push_back(population);
+        } else if (key == "event") {
+            PendingEvent event;
+            std::string why;
+            if (!parseEvent(value, event, why)) {
+                return fail(lineNumber, why);
+            }
+            pending.push_back(event);
+        } else {
+            return fail(lineNumber, "unknown key `" + key + "`");
+        }
+
+        if (!ok) {
+            return fail(lineNumber, "bad value for `" + key + "`");
+        }
+    }
+
+    if (durationSeconds >= 0.0) {
+        scenario.durationTicks = (int)std::lround(durationSeconds * scenario.tickHz);
+    }
+    for (auto& event : pending) {
+        event.event.tick = (int)std::lround(event.time * scenario.tickHz);
+        scenario.events.push_back(event.event);
+    }
+    std::stable_sort(scenario.events.begin(), scenario.events.end(),
+        [](const ScenarioEvent& a, const ScenarioEvent& b) { return a.tick < b.tick; });
+
+    out = std::move(scenario);
+    return true;
+}
+
+bool loadScenario(const char* path, Scenario& out, std::string* error) {
+    std::ifstream file(path);
+    if (!file) {
+        if (error) {
+            *error = std::string("cannot open ") + path;
+        }
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return parseScenario(buffer.str(), out, error);
+}
+
+std::string formatScenario(const Scenario& scenario) {
+    std::ostringstream out;
+    char seed[32];
+    std::snprintf(seed, sizeof(seed), "0x%llX", (unsigned long long)scenario.seed);
+
+    out << "name = " << scenario.name << "\n";
+    out << "seed = " << seed << "\n";
+    out << "dish = " << formatFloat(scenario.dishWidth) << " " << formatFloat(scenario.dishHeight) << "\n";
+    out << "tick_hz = " << scenario.tickHz << "\n";
+    out << "ticks = " << scenario.durationTicks << "\n";
+    out << "spawn_rate = " << formatFloat(scenario.spawnRate) << "\n";
+    out << "spawn = " << (scenario.spawnEnabled ? "on" : "off") << "\n";
+    out << "starters = " << (scenario.starters ? "on" : "off") << "\n";
+    if (scenario.ambientBacteria > 0) {
+        out << "ambient_bacteria = " << scenario.ambientBacteria << "\n";
+    }
+    for (const auto& population : scenario.populations) {
+        out << "population." << microbeTypeName(population.type) << " = " << population.count << "\n";
+    }
+
+    for (const auto& e : scenario.events) {
+        out << "event = " << formatTime(e.tick, scenario.tickHz) << " ";
+        const char* button = e.button == ScenarioButtonRight ? "right" : "left";
+        switch (e.type) {
+            case ScenarioEventType::Cursor:
+                out << "cursor " << formatFloat(e.x) << " " << formatFloat(e.z);
+                break;
+            case ScenarioEventType::CursorLost:
+                out << "cursor none";
+                break;
+            case ScenarioEventType::Press:
+                out << "press " << button;
+                break;
+            case ScenarioEventType::Release:
+                out << "release " << button;
+                break;
+            case ScenarioEventType::Dish:
+                out << "dish " << formatFloat(e.x) << " " << formatFloat(e.z);
+                break;
+            case ScenarioEventType::SimMode:
+                out << "sim_mode " << (e.button ? "reduced" : "full");
+                break;
+            case ScenarioEventType::FastForward:
+                out << "fast_forward " << formatFloat(e.x);
+                break;
+        }
+        out << "\n";
+    }
+    return out.str();
+}
+
+bool saveScenario(const char* path, const Scenario& scenario) {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    file << formatScenario(scenario);
+    return (bool)file;
+}
+
+} // namespace replay
+} // namespace micro_idle
@@ -0,0 +1,93 @@
+#ifndef MICRO_IDLE_SCENARIO_H
+#define MICRO_IDLE_SCENARIO_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "src/components/Microbe.h"
+
+namespace micro_idle {
+namespace replay {
+
+// Scenario files describe a reproducible run: world setup plus timed input.
+// Text format, one `key = value` per line, '#' starts a comment:
+//
+//   name = crowded_dish
+//   seed = 0xC0FFEE
+//   dish = 10.8 3.8             # world width/height
+//   tick_hz = 60
+//   duration = 30               # seconds (or `ticks = 1800`)
+//   spawn_rate = 2.0
+//   spawn = on                  # SpawnSystem enabled
+//   starters = on               # the two opening amoebas from game_create
+//   population.amoeba = 40      # extra microbes at random positions
+//   ambient_bacteria = 100000   # ambient swarm size
+//   event = 1.5 cursor 0.5 -1.0 # cursor world XZ (or `cursor none`)
+//   event = 2.0 press left      # press/release left|right
+//   event = 2.1 release left
+//   event = 5.0 dish 8.0 3.0    # resize the dish
+//   event = 6.0 sim_mode reduced
+//   event = 9.0 fast_forward 120
+//
+// Event times are in seconds and resolve to the nearest tick. Input recordings
+// (InputRecorder) are written in the same format.
+
+enum class ScenarioEventType {
+    Cursor,       // x, z = cursor world position
+    CursorLost,   // cursor left the dish / window
+    Press,        // button
+    Release,      // button
+    Dish,         // x = width, z = height
+    SimMode,      // button = 1 for reduced fidelity, 0 for full
+    FastForward   // x = seconds
+};
+
+enum ScenarioButton {
+    ScenarioButtonLeft = 0,
+    ScenarioButtonRight = 1
+};
+
+struct ScenarioEvent {
+    int tick{0};
+    ScenarioEventType type{ScenarioEventType::Cursor};
+    int button{0};
+    float x{0.0f};
+    float z{0.0f};
+};
+
+struct ScenarioPopulation {
+    components::MicrobeType type;
+    int count;
+};
+
+struct Scenario {
+    std::string name{"unnamed"};
+    uint64_t seed{0xC0FFEEu};         // World::DefaultSeed
+    float dishWidth{10.8f};           // game_create's 1280x720 view
+    float dishHeight{3.8f};
+    int tickHz{60};
+    int durationTicks{600};
+    float spawnRate{1.0f};
+    bool spawnEnabled{false};         // game_create starts with spawning off
+    bool starters{true};
+    int ambientBacteria{0};
+    std::vector<ScenarioPopulation> populations;
+    std::vector<ScenarioEvent> events; // sorted by tick, file order within a tick
+};
+
+// Parse scenario text. On failure returns false and describes the first bad line.
+bool parseScenario(const std::string& text, Scenario& out, std::string* error);
+bool loadScenario(const char* path, Scenario& out, std::string* error);
+
+// Serialize in the format parseScenario reads; floats round-trip exactly
+std::string formatScenario(const Scenario& scenario);
+bool saveScenario(const char* path, const Scenario& scenario);
+
+// Lower-case names used by `population.<type>` keys
+const char* microbeTypeName(components::MicrobeType type);
+bool microbeTypeFromName(const std::string& name, components::MicrobeType& out);
+
+} // namespace replay
+} // namespace micro_idle
+
+#endif
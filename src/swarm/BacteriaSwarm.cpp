@@ -0,0 +1,313 @@
+#include "BacteriaSwarm.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/RandomStreams.h"
+#include "src/math/Simd.h"
+#include "src/physics/ParallelFor.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace micro_idle {
+
+namespace {
+
+constexpr float TwoPi = 6.28318530718f;
+constexpr float U32ToUnit = 1.0f / 4294967296.0f;
+constexpr float FarAway = 1e9f;    // Dummy obstacle slot position
+
+int paddedSize(int n) {
+    return (n + 7) & ~7;
+}
+
+// Exponentially distributed run length from a uniform u in [0, 1)
+float sampleRunTime(float u, float mean) {
+    return -mean * std::log(1.0f - u);
+}
+
+} // namespace
+
+BacteriaSwarm::BacteriaSwarm(uint64_t seed) : seed(seed) {
+    rng8_seed(&spawnRng, seed, components::RandomStreamSwarmSpawn);
+}
+
+void BacteriaSwarm::reseed(uint64_t newSeed, float dishWidth, float dishHeight) {
+    int n = count;
+    seed = newSeed;
+    rng8_seed(&spawnRng, seed, components::RandomStreamSwarmSpawn);
+    chunkRng.clear();
+    count = 0;
+    setCount(n, dishWidth, dishHeight);
+}
+
+void BacteriaSwarm::setCount(int newCount, float dishWidth, float dishHeight) {
+    newCount = std::max(newCount, 0);
+    size_t padded = (size_t)paddedSize(newCount);
+
+    px.resize(padded);
+    pz.resize(padded);
+    dx.resize(padded);
+    dz.resize(padded);
+    speed.resize(padded);
+    runTimer.resize(padded);
+    type.resize(padded);
+
+    if (newCount > count) {
+        spawnRange(count, newCount, dishWidth, dishHeight);
+    }
+
+    // Padding lanes sit still and never tumble, so they never draw from a chunk stream
+    for (size_t i = (size_t)newCount; i < padded; i++) {
+        px[i] = 0.0f;
+        pz[i] = 0.0f;
+        dx[i] = 1.0f;
+        dz[i] = 0.0f;
+        speed[i] = 0.0f;
+        runTimer[i] = FLT_MAX;
+        type[i] = (uint8_t)SwarmAgentType::Coccus;
+    }
+
+    // Chunks that survive a resize keep their stream state
+    size_t chunks = (size_t)((newCount + ChunkSize - 1) / ChunkSize);
+    size_t oldChunks = chunkRng.size();
+    chunkRng.resize(chunks);
+    for (size_t c = oldChunks; c < chunks; c++) {
+        rng8_seed(&chunkRng[c], seed, components::RandomStreamSwarmChunkBase + c);
+    }
+
+    count = newCount;
+    typesVersion++;
+}
+
+void BacteriaSwarm::spawnRange(int begin, int end, float dishWidth, float dishHeight) {
+    float halfW = std::max(dishWidth * 0.5f - params.agentRadius, 0.0f);
+    float halfH = std::max(dishHeight * 0.5f - params.agentRadius, 0.0f);
+
+    // Six uniforms per agent, drawn eight agents at a time
+    float r[48];
+    for (int block = begin; block < end; block += 8) {
+        rng8_fill_f01(&spawnRng, r, 48);
+        int lanes = std::min(8, end - block);
+        for (int l = 0; l < lanes; l++) {
+            int i = block + l;
+            const float* u = r + l * 6;
+            bool rod = u[0] < params.bacillusFraction;
+            float angle = u[3] * TwoPi;
+            float base = rod ? params.bacillusSpeed : params.coccusSpeed;
+
+            type[i] = (uint8_t)(rod ? SwarmAgentType::Bacillus : SwarmAgentType::Coccus);
+            px[i] = (u[1] * 2.0f - 1.0f) * halfW;
+            pz[i] = (u[2] * 2.0f - 1.0f) * halfH;
+            dx[i] = std::cos(angle);
+            dz[i] = std::sin(angle);
+            speed[i] = base * (1.0f + params.speedJitter * (u[4] * 2.0f - 1.0f));
+            runTimer[i] = sampleRunTime(u[5], params.meanRunTime);
+        }
+    }
+}
+
+void BacteriaSwarm::step(float dt, float dishWidth, float dishHeight,
+                         const components::MicrobeIndex* obstacles, JPH::JobSystem* jobs) {
+    if (count == 0 || dt <= 0.0f) {
+        return;
+    }
+    float halfW = std::max(dishWidth * 0.5f - params.agentRadius, 0.0f);
+    float halfH = std::max(dishHeight * 0.5f - params.agentRadius, 0.0f);
+    if (obstacles && obstacles->size() == 0) {
+        obstacles = nullptr;
+    }
+    if (obstacles) {
+        buildObstacleSlots(*obstacles);
+    }
+
+    parallelFor(jobs, (int)chunkRng.size(), [&](int chunk) {
+        stepChunk(chunk, dt, halfW, halfH, obstacles);
+    });
+}
+
+void BacteriaSwarm::buildObstacleSlots(const components::MicrobeIndex& obstacles) {
+    const SpatialGrid& grid = obstacles.grid;
+    int cells = grid.cellCount();
+
+    slotsPerCell = 0;
+    for (int c = 0; c < cells; c++) {
+        int items = 0;
+        grid.cellItems(c, items);
+        slotsPerCell = std::max(slotsPerCell, items);
+    }
+
+    size_t slots = (size_t)cells * (size_t)slotsPerCell;
+    slotX.assign(slots, FarAway);
+    slotZ.assign(slots, FarAway);
+    slotReach.assign(slots, 0.0f);
+    for (int c = 0; c < cells; c++) {
+        int items = 0;
+        const int* cell = grid.cellItems(c, items);
+        for (int k = 0; k < items; k++) {
+            size_t slot = (size_t)c * (size_t)slotsPerCell + (size_t)k;
+            slotX[slot] = obstacles.x[(size_t)cell[k]];
+            slotZ[slot] = obstacles.z[(size_t)cell[k]];
+            slotReach[slot] = obstacles.radius[(size_t)cell[k]] + params.agentRadius;
+        }
+    }
+}
+
+void BacteriaSwarm::stepChunk(int chunk, float dt, float halfW, float halfH,
+                              const components::MicrobeIndex* obstacles) {
+    using math::Float8;
+    using math::Mask8;
+
+    int begin = chunk * ChunkSize;
+    int end = std::min(begin + ChunkSize, count);
+    int paddedEnd = paddedSize(end);
+    Rng8& rng = chunkRng[(size_t)chunk];
+
+    const Float8 vdt = Float8::broadcast(dt);
+    const Float8 zero = Float8::zero();
+    const Float8 hiX = Float8::broadcast(halfW);
+    const Float8 hiZ = Float8::broadcast(halfH);
+    const Float8 loX = -hiX;
+    const Float8 loZ = -hiZ;
+    const Float8 twoHiX = hiX * 2.0f;
+    const Float8 twoHiZ = hiZ * 2.0f;
+
+    for (int i = begin; i < paddedEnd; i += Float8::Width) {
+        Float8 timer = Float8::load(&runTimer[(size_t)i]) - vdt;
+        Mask8 tumble = timer <= zero;
+
+        if (tumble.any()) {
+            // Rare per block: pick a fresh heading and run length for expired lanes.
+            // A whole block always draws the same amount, so streams stay in step.
+            uint32_t angles[8], runs[8];
+            rng8_next_u32(&rng, angles);
+            rng8_next_u32(&rng, runs);
+            timer.store(&runTimer[(size_t)i]);
+            int bits = tumble.bits();
+            for (int l = 0; l < Float8::Width; l++) {
+                if (!(bits & (1 << l))) {
+                    continue;
+                }
+                size_t k = (size_t)(i + l);
+                float angle = (float)angles[l] * U32ToUnit * TwoPi;
+                dx[k] = std::cos(angle);
+                dz[k] = std::sin(angle);
+                runTimer[k] += sampleRunTime((float)runs[l] * U32ToUnit, params.meanRunTime);
+            }
+            timer = Float8::load(&runTimer[(size_t)i]);
+        }
+
+        Float8 x = Float8::load(&px[(size_t)i]);
+        Float8 z = Float8::load(&pz[(size_t)i]);
+        Float8 hx = Float8::load(&dx[(size_t)i]);
+        Float8 hz = Float8::load(&dz[(size_t)i]);
+        Float8 travel = Float8::load(&speed[(size_t)i]) * vdt;
+
+        x = math::fmadd(hx, travel, x);
+        z = math::fmadd(hz, travel, z);
+
+        // Mirror across the dish walls and turn the heading back inwards
+        Mask8 pastHiX = x > hiX;
+        x = math::select(pastHiX, twoHiX - x, x);
+        hx = math::select(pastHiX, -math::abs(hx), hx);
+        Mask8 pastLoX = x < loX;
+        x = math::select(pastLoX, -twoHiX - x, x);
+        hx = math::select(pastLoX, math::abs(hx), hx);
+
+        Mask8 pastHiZ = z > hiZ;
+        z = math::select(pastHiZ, twoHiZ - z, z);
+        hz = math::select(pastHiZ, -math::abs(hz), hz);
+        Mask8 pastLoZ = z < loZ;
+        z = math::select(pastLoZ, -twoHiZ - z, z);
+        hz = math::select(pastLoZ, math::abs(hz), hz);
+
+        // A single step longer than the dish (huge dt) still ends inside
+        x = math::clamp(x, loX, hiX);
+        z = math::clamp(z, loZ, hiZ);
+
+        x.store(&px[(size_t)i]);
+        z.store(&pz[(size_t)i]);
+        hx.store(&dx[(size_t)i]);
+        hz.store(&dz[(size_t)i]);
+        timer.store(&runTimer[(size_t)i]);
+    }
+
+    if (!obstacles) {
+        return;
+    }
+
+    // Microbe footprints: the grid stores circles in every cell they overlap, so
+    // one cell finds every candidate. Agents are in no spatial order, so test a
+    // fixed number of slots per cell for eight agents at once (no data-dependent
+    // branches) and only resolve the rare contacts lane by lane.
+    const components::MicrobeIndex& index = *obstacles;
+    const SpatialGrid& grid = index.grid;
+    const int slots = slotsPerCell;
+    for (int i = begin; i < end; i += Float8::Width) {
+        int lanes = std::min(Float8::Width, end - i);
+        int laneMask = (1 << lanes) - 1;
+        int base[8];
+        for (int l = 0; l < Float8::Width; l++) {
+            size_t k = (size_t)(i + l);
+            base[l] = grid.cellAt(px[k], pz[k]) * slots;
+        }
+
+        Float8 x = Float8::load(&px[(size_t)i]);
+        Float8 z = Float8::load(&pz[(size_t)i]);
+        int contacts = 0;
+        for (int s = 0; s < slots; s++) {
+            alignas(32) float sx[8], sz[8], sr[8];
+            for (int l = 0; l < Float8::Width; l++) {
+                size_t slot = (size_t)(base[l] + s);
+                sx[l] = slotX[slot];
+                sz[l] = slotZ[slot];
+                sr[l] = slotReach[slot];
+            }
+            Float8 ax = x - Float8::load(sx);
+            Float8 az = z - Float8::load(sz);
+            Float8 reach = Float8::load(sr);
+            contacts |= (ax * ax + az * az < reach * reach).bits();
+        }
+
+        contacts &= laneMask;
+        for (int l = 0; contacts != 0; l++, contacts >>= 1) {
+            if (contacts & 1) {
+                resolveContacts((size_t)(i + l), index, halfW, halfH);
+            }
+        }
+    }
+}
+
+void BacteriaSwarm::resolveContacts(size_t k, const components::MicrobeIndex& index, float halfW, float halfH) {
+    int items = 0;
+    const int* cell = index.grid.cellItems(index.grid.cellAt(px[k], pz[k]), items);
+    for (int c = 0; c < items; c++) {
+        size_t j = (size_t)cell[c];
+        float ox = px[k] - index.x[j];
+        float oz = pz[k] - index.z[j];
+        float reach = index.radius[j] + params.agentRadius;
+        float d2 = ox * ox + oz * oz;
+        if (d2 >= reach * reach) {
+            continue;
+        }
+
+        float nx, nz;
+        if (d2 > 1e-10f) {
+            float invD = 1.0f / std::sqrt(d2);
+            nx = ox * invD;
+            nz = oz * invD;
+        } else {
+            nx = -dx[k];
+            nz = -dz[k];
+        }
+
+        // Push out to the surface and reflect the heading off it
+        px[k] = std::clamp(index.x[j] + nx * reach, -halfW, halfW);
+        pz[k] = std::clamp(index.z[j] + nz * reach, -halfH, halfH);
+        float along = dx[k] * nx + dz[k] * nz;
+        if (along < 0.0f) {
+            dx[k] -= 2.0f * along * nx;
+            dz[k] -= 2.0f * along * nz;
+        }
+    }
+}
+
+} // namespace micro_idle
@@ -0,0 +1,107 @@
+#ifndef MICRO_IDLE_BACTERIA_SWARM_H
+#define MICRO_IDLE_BACTERIA_SWARM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/util/rng.h"
+
+namespace JPH {
+class JobSystem;
+}
+
+namespace components {
+struct MicrobeIndex;
+}
+
+namespace micro_idle {
+
+enum class SwarmAgentType : uint8_t {
+    Coccus = 0,     // Round, slow
+    Bacillus = 1    // Rod, fast
+};
+
+struct SwarmParams {
+    float coccusSpeed{0.25f};
+    float bacillusSpeed{0.6f};
+    float speedJitter{0.3f};        // Per-agent speed spread (fraction of type speed)
+    float meanRunTime{1.5f};        // Mean seconds between tumbles (exponential)
+    float agentRadius{0.025f};      // Collision radius against dish walls and microbes
+    float bacillusFraction{0.6f};
+};
+
+/**
+ * Ambient bacteria tier - hundreds of thousands of lightweight agents that live
+ * outside the ECS and the physics world
+ *
+ * State is SoA (one array per field, padded to a multiple of 8) so the
+ * run-and-tumble integrator works on eight agents per Float8. Agents are split
+ * into fixed chunks that run as jobs; each chunk owns its own random stream, so
+ * the result is identical for any number of worker threads.
+ *
+ * Agents collide with the dish walls and bounce off microbe footprints looked up
+ * in the MicrobeIndex grid; microbes never feel the agents.
+ */
+class BacteriaSwarm {
+public:
+    static constexpr int ChunkSize = 4096;
+
+    explicit BacteriaSwarm(uint64_t seed);
+
+    // Grow or shrink to `count` agents. New agents are scattered over the dish.
+    void setCount(int count, float dishWidth, float dishHeight);
+
+    // Re-scatter every agent from a new seed
+    void reseed(uint64_t seed, float dishWidth, float dishHeight);
+
+    /**
+     * Advance all agents by dt
+     *
+     * @param obstacles Microbe footprints to bounce off (may be null)
+     * @param jobs Job system to spread chunks over (null runs inline)
+     */
+    void step(float dt, float dishWidth, float dishHeight,
+              const components::MicrobeIndex* obstacles, JPH::JobSystem* jobs);
+
+    int size() const { return count; }
+
+    // Render / inspection streams, size() entries each
+    const float* positionsX() const { return px.data(); }
+    const float* positionsZ() const { return pz.data(); }
+    const float* headingsX() const { return dx.data(); }
+    const float* headingsZ() const { return dz.data(); }
+    const uint8_t* types() const { return type.data(); }
+
+    // Bumped whenever types() changes, so renderers re-upload it only then
+    uint32_t getTypesVersion() const { return typesVersion; }
+
+    SwarmParams params;
+
+private:
+    uint64_t seed;
+    int count{0};
+    uint32_t typesVersion{0};
+    Rng8 spawnRng;
+
+    std::vector<float> px, pz;      // Position on the dish floor
+    std::vector<float> dx, dz;      // Unit heading
+    std::vector<float> speed;
+    std::vector<float> runTimer;    // Seconds until the next tumble
+    std::vector<uint8_t> type;
+    std::vector<Rng8> chunkRng;
+
+    // Microbe footprints laid out per grid cell in fixed-width slots (padded with
+    // unreachable dummies), so the contact test runs branch-free on eight agents
+    int slotsPerCell{0};
+    std::vector<float> slotX, slotZ, slotReach;
+
+    void buildObstacleSlots(const components::MicrobeIndex& obstacles);
+    void spawnRange(int begin, int end, float dishWidth, float dishHeight);
+    void stepChunk(int chunk, float dt, float halfW, float halfH,
+                   const components::MicrobeIndex* obstacles);
+    void resolveContacts(size_t agent, const components::MicrobeIndex& obstacles, float halfW, float halfH);
+};
+
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,199 @@
+#include "AppendageSystem.h"
+#include "PhysicsSystem.h"
+#include "src/components/Appendage.h"
+#include "src/components/Microbe.h"
+#include "src/components/Rendering.h"
+#include "src/components/Transform.h"
+#include "src/components/WorldState.h"
+#include "src/physics/RodSolver.h"
+#include "src/systems/BodyPlanFactory.h"
+#include <cmath>
+
+namespace micro_idle {
+
+namespace {
+
+// Which end of the body a rod grows from, along the heading
+enum class Pole {
+    Front,
+    Rear,
+    Both        // One rod at each end
+};
+
+// Appendage layout per microbe type; lengths and widths are in body radii,
+// curvature, twist and beat are over the whole rod
+struct AppendageSpec {
+    Pole pole;
+    int nodes;
+    float length;
+    float thickness;
+    float bendStiffness;
+    float curvature;
+    float twist;
+    float beatAmplitude;
+    float beatFrequency;
+    float beatWavelength;
+};
+
+struct SpecEntry {
+    components::MicrobeType type;
+    AppendageSpec spec;
+};
+
+const SpecEntry Specs[] = {
+    // Neck up to 7 body lengths, swept slowly back and forth while hunting
+    {components::MicrobeType::Lacrymaria,
+        {Pole::Front, 24, 14.0f, 0.22f, 0.3f, 0.0f, 0.0f, 2.5f, 0.25f, 2.0f}},
+    // Stiff stalk that holds the bell off the substrate
+    {components::MicrobeType::Vorticella,
+        {Pole::Rear, 10, 5.0f, 0.15f, 0.9f, 0.8f, 0.0f, 0.0f, 0.0f, 1.0f}},
+    // Helical polar flagella, beating fast
+    {components::MicrobeType::Bacillus,
+        {Pole::Rear, 12, 5.0f, 0.18f, 0.4f, 4.0f, 12.0f, 1.5f, 4.0f, 0.5f}},
+    {components::MicrobeType::Vibrio,
+        {Pole::Rear, 12, 5.0f, 0.18f, 0.4f, 4.0f, 12.0f, 1.5f, 4.0f, 0.5f}},
+    {components::MicrobeType::Spirillum,
+        {Pole::Both, 8, 3.0f, 0.2f, 0.4f, 3.0f, 8.0f, 1.5f, 3.0f, 0.5f}},
+};
+
+const AppendageSpec* findSpec(components::MicrobeType type) {
+    for (const SpecEntry& entry : Specs) {
+        if (entry.type == type) {
+            return &entry.spec;
+        }
+    }
+    return nullptr;
+}
+
+// Sample point furthest along `side * axis` from the centre
+int extremeSample(const Vector3* points, int count, Vector3 center, Vector3 axis, float side) {
+    int best = 0;
+    float bestDot = -INFINITY;
+    for (int i = 0; i < count; i++) {
+        float d = side * ((points[i].x - center.x) * axis.x + (points[i].z - center.z) * axis.z);
+        if (d > bestDot) {
+            bestDot = d;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Direction from the centre to the anchor in the dish plane (falls back to `axis`)
+Vector3 outward(Vector3 anchor, Vector3 center, Vector3 fallback) {
+    Vector3 d = {anchor.x - center.x, 0.0f, anchor.z - center.z};
+    return (d.x * d.x + d.z * d.z) > 1e-8f ? d : fallback;
+}
+
+} // namespace
+
+int AppendageSystem::attach(components::Appendages& appendages, RodSolver& rods, PhysicsSystemState* physics,
+                            const components::Microbe& microbe, Vector3 center, float heading) {
+    const AppendageSpec* spec = findSpec(microbe.type);
+    if (!spec) {
+        return 0;
+    }
+
+    Vector3 points[64];
+    int count = BodyPlanFactory::ExtractSamplePoints(physics, microbe, points, 64);
+    if (count == 0) {
+        return 0;
+    }
+
+    // Body plans lay their spine along +X before the heading turns it about +Y
+    Vector3 axis = {std::cos(heading), 0.0f, -std::sin(heading)};
+    float sides[2] = {spec->pole == Pole::Rear ? -1.0f : 1.0f, -1.0f};
+    int rodCount = spec->pole == Pole::Both ? 2 : 1;
+
+    float radius = microbe.stats.baseRadius;
+    int before = appendages.count;
+    for (int i = 0; i < rodCount && appendages.count < components::Appendages::Max; i++) {
+        RodParams params;
+        params.nodes = spec->nodes;
+        params.length = spec->length * radius;
+        params.bendStiffness = spec->bendStiffness;
+        params.curvature = spec->curvature;
+        params.twist = spec->twist;
+        params.beatAmplitude = spec->beatAmplitude;
+        params.beatFrequency = spec->beatFrequency;
+        params.beatWavelength = spec->beatWavelength;
+        // Neighbours beat out of step
+        params.phase = (microbe.stats.seed + 0.5f * (float)i) * 6.28318530718f;
+
+        int anchor = extremeSample(points, count, center, axis, sides[i]);
+        Vector3 fallback = {axis.x * sides[i], 0.0f, axis.z * sides[i]};
+        int n = appendages.count++;
+        appendages.anchors[n] = anchor;
+        appendages.thickness[n] = spec->thickness * radius;
+        appendages.rods[n] = rods.addRod(params, points[anchor], outward(points[anchor], center, fallback));
+    }
+    return appendages.count - before;
+}
+
+void AppendageSystem::detach(const components::Appendages& appendages, RodSolver& rods) {
+    for (int i = 0; i < appendages.count; i++) {
+        rods.removeRod(appendages.rods[i]);
+    }
+}
+
+void AppendageSystem::registerSystem(flecs::world& world, RodSolver* rods, PhysicsSystemState* physics) {
+    // Re-anchor every rod to the sample points UpdateSDFUniforms just extracted
+    world.system<const components::Appendages, const components::Transform, const components::SDFRenderComponent>(
+            "AppendageAnchorSystem")
+        .kind(flecs::OnStore)
+        .each([rods](const components::Appendages& appendages,
+                     const components::Transform& transform,
+                     const components::SDFRenderComponent& sdf) {
+            for (int i = 0; i < appendages.count; i++) {
+                int anchor = appendages.anchors[i];
+                if (anchor >= sdf.vertexCount) {
+                    continue;
+                }
+                Vector3 point = sdf.vertexPositions[anchor];
+                Vector3 current = rods->getRod(appendages.rods[i]).node(1);
+                Vector3 fallback = {current.x - point.x, 0.0f, current.z - point.z};
+                rods->setAnchor(appendages.rods[i], point, outward(point, transform.position, fallback));
+            }
+        });
+
+    world.system("AppendageSystem")
+        .kind(flecs::OnStore)
+        .run([rods, physics](flecs::iter& it) {
+            if (!rods || rods->getRodCount() == 0) {
+                return;
+            }
+
+            // Anchors are frozen while UpdateSDFUniforms is off, so the rods would only settle
+            auto worldState = it.world().get<components::WorldState>();
+            if (!worldState || worldState->reducedFidelity) {
+                return;
+            }
+
+            rods->step(it.delta_time(), physics ? physics->jobSystem : nullptr);
+        });
+}
+
+void AppendageSystem::registerRenderSystem(flecs::world& world, RodSolver* rods) {
+    // Tapered cylinders from base to tip; cheap enough at a few dozen segments per rod
+    world.system<const components::Appendages, const components::Microbe>("AppendageRender")
+        .kind(flecs::PostUpdate)
+        .each([rods](const components::Appendages& appendages, const components::Microbe& microbe) {
+            Color color = microbe.stats.color;
+            color.r = (unsigned char)(color.r * 0.7f);
+            color.g = (unsigned char)(color.g * 0.7f);
+            color.b = (unsigned char)(color.b * 0.7f);
+
+            for (int i = 0; i < appendages.count; i++) {
+                RodView rod = rods->getRod(appendages.rods[i]);
+                float base = appendages.thickness[i];
+                for (int n = 1; n < rod.nodes; n++) {
+                    float t0 = (float)(n - 1) / (float)(rod.nodes - 1);
+                    float t1 = (float)n / (float)(rod.nodes - 1);
+                    DrawCylinderEx(rod.node(n - 1), rod.node(n),
+                                   base * (1.0f - 0.6f * t0), base * (1.0f - 0.6f * t1), 6, color);
+                }
+            }
+        });
+}
+
+} // namespace micro_idle
@@ -0,0 +1,38 @@
+#ifndef MICRO_IDLE_APPENDAGE_SYSTEM_H
+#define MICRO_IDLE_APPENDAGE_SYSTEM_H
+
+#include <flecs.h>
+#include "raylib.h"
+
+namespace components {
+struct Microbe;
+struct Appendages;
+}
+
+namespace micro_idle {
+
+class RodSolver;
+struct PhysicsSystemState;
+
+// Appendage systems - pin each microbe's rods to its membrane and step them
+// Step runs in OnStore phase (after UpdateSDFUniforms, whose sample points it
+// anchors to), draw in PostUpdate (before SDFRenderSystem)
+class AppendageSystem {
+public:
+    // Rod packets are spread over the physics job system
+    static void registerSystem(flecs::world& world, RodSolver* rods, PhysicsSystemState* physics);
+
+    static void registerRenderSystem(flecs::world& world, RodSolver* rods);
+
+    // Add the appendages for a microbe's type (if it has any). `heading` is the
+    // body's facing angle about +Y; fronts and rears are picked along it.
+    // Returns the number of rods created.
+    static int attach(components::Appendages& appendages, RodSolver& rods, PhysicsSystemState* physics,
+                      const components::Microbe& microbe, Vector3 center, float heading);
+
+    static void detach(const components::Appendages& appendages, RodSolver& rods);
+};
+
+} // namespace micro_idle
+
+#endif
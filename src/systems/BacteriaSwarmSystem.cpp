@@ -0,0 +1,97 @@
+#include "BacteriaSwarmSystem.h"
+#include "PhysicsSystem.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/WorldState.h"
+#include "src/rendering/InstancedBillboards.h"
+#include "src/rendering/SDFShader.h"
+#include "src/swarm/BacteriaSwarm.h"
+#include "raylib.h"
+#include <cstdint>
+#include <memory>
+
+namespace micro_idle {
+
+namespace {
+
+enum SwarmStream {
+    SwarmStreamX = 0,
+    SwarmStreamZ = 1,
+    SwarmStreamDirX = 2,
+    SwarmStreamDirZ = 3,
+    SwarmFloatStreams = 4
+};
+
+// Just above the dish floor, below every microbe
+constexpr float SwarmFloorHeight = 0.02f;
+
+} // namespace
+
+void BacteriaSwarmSystem::registerSystem(flecs::world& world, BacteriaSwarm* swarm, PhysicsSystemState* physics) {
+    world.system("BacteriaSwarmSystem")
+        .kind(flecs::OnStore)
+        .run([swarm, physics](flecs::iter& it) {
+            if (!swarm || swarm->size() == 0) {
+                return;
+            }
+
+            auto worldState = it.world().get<components::WorldState>();
+            if (!worldState || worldState->reducedFidelity) {
+                // Purely ambient: nobody sees it in the background
+                return;
+            }
+
+            auto index = it.world().get<components::MicrobeIndex>();
+            swarm->step(it.delta_time(), worldState->worldWidth, worldState->worldHeight,
+                        index, physics ? physics->jobSystem : nullptr);
+        });
+}
+
+bool BacteriaSwarmSystem::initRenderer(rendering::InstancedBillboards& billboards, const BacteriaSwarm& swarm) {
+    Shader shader = rendering::loadShaderFromDataPaths("bacteria_swarm.vert", "bacteria_swarm.frag");
+    if (!billboards.init(shader, SwarmFloatStreams, true)) {
+        return false;
+    }
+
+    // Constant for the lifetime of the shader
+    float agentRadius = swarm.params.agentRadius;
+    float floorHeight = SwarmFloorHeight;
+    Vector3 coccusColor = {0.55f, 0.78f, 0.42f};
+    Vector3 bacillusColor = {0.42f, 0.62f, 0.85f};
+    SetShaderValue(shader, GetShaderLocation(shader, "agentRadius"), &agentRadius, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(shader, GetShaderLocation(shader, "floorHeight"), &floorHeight, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(shader, GetShaderLocation(shader, "coccusColor"), &coccusColor, SHADER_UNIFORM_VEC3);
+    SetShaderValue(shader, GetShaderLocation(shader, "bacillusColor"), &bacillusColor, SHADER_UNIFORM_VEC3);
+    return true;
+}
+
+void BacteriaSwarmSystem::registerRenderSystem(flecs::world& world, BacteriaSwarm* swarm,
+                                               rendering::InstancedBillboards* billboards) {
+    // Types only change on resize; positions and headings are re-sent every frame
+    auto uploadedTypes = std::make_shared<uint32_t>(UINT32_MAX);
+
+    world.system("BacteriaSwarmRender")
+        .kind(flecs::PostUpdate)
+        .run([swarm, billboards, uploadedTypes](flecs::iter&) {
+            if (!swarm || !billboards || !billboards->isReady()) {
+                return;
+            }
+            int count = swarm->size();
+            if (count == 0) {
+                return;
+            }
+
+            billboards->reserve(count);
+            billboards->uploadFloatStream(SwarmStreamX, swarm->positionsX(), count);
+            billboards->uploadFloatStream(SwarmStreamZ, swarm->positionsZ(), count);
+            billboards->uploadFloatStream(SwarmStreamDirX, swarm->headingsX(), count);
+            billboards->uploadFloatStream(SwarmStreamDirZ, swarm->headingsZ(), count);
+            if (*uploadedTypes != swarm->getTypesVersion()) {
+                billboards->uploadByteStream(swarm->types(), count);
+                *uploadedTypes = swarm->getTypesVersion();
+            }
+
+            billboards->draw(count);
+        });
+}
+
+} // namespace micro_idle
@@ -0,0 +1,32 @@
+#ifndef MICRO_IDLE_BACTERIA_SWARM_SYSTEM_H
+#define MICRO_IDLE_BACTERIA_SWARM_SYSTEM_H
+
+#include <flecs.h>
+
+namespace micro_idle {
+
+class BacteriaSwarm;
+struct PhysicsSystemState;
+
+namespace rendering {
+class InstancedBillboards;
+}
+
+// Bacteria swarm systems - step the ambient swarm and draw it instanced
+// Step runs in OnStore phase (after MicrobeIndexSystem), draw in PostUpdate
+// (before SDFRenderSystem so microbes blend over the swarm)
+class BacteriaSwarmSystem {
+public:
+    // Chunks are spread over the physics job system between physics steps
+    static void registerSystem(flecs::world& world, BacteriaSwarm* swarm, PhysicsSystemState* physics);
+
+    static void registerRenderSystem(flecs::world& world, BacteriaSwarm* swarm,
+                                     rendering::InstancedBillboards* billboards);
+
+    // Load the swarm shader into `billboards` (needs a GL context)
+    static bool initRenderer(rendering::InstancedBillboards& billboards, const BacteriaSwarm& swarm);
+};
+
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,428 @@
+#include "BodyPlanFactory.h"
+#include "PhysicsSystem.h"
+#include "SoftBodyFactory.h"
+#include "src/physics/Icosphere.h"
+#include "src/physics/PhysicsRuntime.h"
+#include "src/math/BatchKernels.h"
+#include "src/math/JoltInterop.h"
+
+#include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/Body/BodyInterface.h>
+#include <Jolt/Physics/Collision/Shape/CapsuleShape.h>
+#include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
+#include <Jolt/Physics/Collision/Shape/RotatedTranslatedShape.h>
+#include <Jolt/Physics/Collision/Shape/ScaledShape.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/Collision/Shape/StaticCompoundShape.h>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+namespace micro_idle {
+
+namespace {
+
+using components::BodyPlanKind;
+using components::MicrobeType;
+
+constexpr float TwoPi = 6.28318530718f;
+constexpr float WaveAmplitude = 1.5f;     // Spirillum spine swing, in radii
+constexpr float SampleSpacing = 0.5f;     // Distance between SDF samples along a spine
+constexpr float SampleSpread = 0.35f;     // Sideways offset of the paired samples
+constexpr float CapsidSampleScale = 0.45f;
+constexpr float TailRadius = 0.3f;
+constexpr int MaxSpineSamples = 32;       // Two points each, fills SDFRenderComponent
+
+// Indexed by MicrobeType
+const BodyPlan PlanTable[components::MicrobeTypeCount] = {
+    // kind                              size   aspect bend  waves tail  reach
+    {BodyPlanKind::SoftMembrane,        1.0f,  1.0f,  0.0f, 0,    0.0f, 1.0f},   // Amoeba
+    {BodyPlanKind::SoftMembrane,        1.0f,  1.0f,  0.0f, 0,    0.0f, 1.0f},   // Stentor
+    {BodyPlanKind::SoftMembrane,        1.0f,  1.0f,  0.0f, 0,    0.0f, 1.0f},   // Lacrymaria
+    {BodyPlanKind::SoftMembrane,        1.0f,  1.0f,  0.0f, 0,    0.0f, 1.0f},   // Vorticella
+    {BodyPlanKind::SoftMembrane,        1.0f,  1.0f,  0.0f, 0,    0.0f, 1.0f},   // Didinium
+    {BodyPlanKind::SoftMembrane,        1.0f,  1.0f,  0.0f, 0,    0.0f, 1.0f},   // Heliozoa
+    {BodyPlanKind::SoftMembrane,        1.0f,  1.0f,  0.0f, 0,    0.0f, 1.0f},   // Radiolarian
+    {BodyPlanKind::SoftMembrane,        1.0f,  1.0f,  0.0f, 0,    0.0f, 1.0f},   // Diatom
+    {BodyPlanKind::RigidSphere,         0.35f, 1.0f,  0.0f, 0,    0.0f, 0.0f},   // Coccus
+    {BodyPlanKind::RigidCapsule,        0.3f,  2.5f,  0.0f, 0,    0.0f, 0.0f},   // Bacillus
+    {BodyPlanKind::RigidCurvedCompound, 0.3f,  2.5f,  1.4f, 0,    0.0f, 0.0f},   // Vibrio
+    {BodyPlanKind::RigidCurvedCompound, 0.25f, 6.0f,  0.0f, 2,    0.0f, 0.0f},   // Spirillum
+    {BodyPlanKind::RigidConvexCapsid,   0.2f,  1.0f,  0.0f, 0,    0.0f, 0.0f},   // Icosahedral
+    {BodyPlanKind::RigidConvexCapsid,   0.2f,  1.0f,  0.0f, 0,    2.0f, 0.0f},   // Bacteriophage
+};
+
+struct PlanTemplate {
+    BodyPlan plan;
+    JPH::ShapeRefC unitShape;           // Radius 1, scaled per body
+    std::vector<Vector3> samples;       // Radius 1, body space
+};
+
+std::once_flag templatesOnce;
+PlanTemplate templates[components::MicrobeTypeCount];
+
+// Centre line between the cap centres of a rod-like plan, centred on the origin
+std::vector<JPH::Vec3> buildSpine(const BodyPlan& plan) {
+    float length = 2.0f * std::max(plan.aspect - 1.0f, 0.1f);
+    int segments = 1;
+    if (plan.kind == BodyPlanKind::RigidCurvedCompound) {
+        segments = plan.waves > 0 ? plan.waves * 6 : 4;
+    }
+
+    std::vector<JPH::Vec3> spine;
+    float minZ = 0.0f;
+    float maxZ = 0.0f;
+    for (int i = 0; i <= segments; i++) {
+        float t = (float)i / (float)segments;
+        float x = (t - 0.5f) * length;
+        float z = 0.0f;
+        if (plan.kind == BodyPlanKind::RigidCurvedCompound && plan.waves > 0) {
+            z = WaveAmplitude * std::sin(TwoPi * (float)plan.waves * t);
+        } else if (plan.kind == BodyPlanKind::RigidCurvedCompound && plan.bend > 0.0f) {
+            // Circular arc of the same length turning through `bend`
+            float arcRadius = length / plan.bend;
+            float angle = (t - 0.5f) * plan.bend;
+            x = arcRadius * std::sin(angle);
+            z = arcRadius * (1.0f - std::cos(angle));
+        }
+        spine.push_back(JPH::Vec3(x, 0.0f, z));
+        minZ = std::min(minZ, z);
+        maxZ = std::max(maxZ, z);
+    }
+
+    JPH::Vec3 shift(0.0f, 0.0f, -0.5f * (minZ + maxZ));
+    for (JPH::Vec3& p : spine) {
+        p += shift;
+    }
+    return spine;
+}
+
+// Evenly spaced points along a polyline, in arc length
+std::vector<JPH::Vec3> resample(const std::vector<JPH::Vec3>& line, int count) {
+    std::vector<float> along(line.size(), 0.0f);
+    for (size_t i = 1; i < line.size(); i++) {
+        along[i] = along[i - 1] + (line[i] - line[i - 1]).Length();
+    }
+
+    std::vector<JPH::Vec3> points;
+    size_t seg = 1;
+    for (int i = 0; i < count; i++) {
+        float s = along.back() * (float)i / (float)std::max(count - 1, 1);
+        while (seg + 1 < line.size() && along[seg] < s) {
+            seg++;
+        }
+        float span = std::max(along[seg] - along[seg - 1], 1e-6f);
+        float t = std::clamp((s - along[seg - 1]) / span, 0.0f, 1.0f);
+        points.push_back(line[seg - 1] + (line[seg] - line[seg - 1]) * t);
+    }
+    return points;
+}
+
+JPH::ShapeRefC createShape(const JPH::ShapeSettings& settings) {
+    JPH::ShapeSettings::ShapeResult result = settings.Create();
+    return result.HasError() ? JPH::ShapeRefC() : JPH::ShapeRefC(result.Get());
+}
+
+Vector3 toRaylib(JPH::Vec3Arg v) {
+    return {v.GetX(), v.GetY(), v.GetZ()};
+}
+
+void buildRodTemplate(PlanTemplate& tpl) {
+    std::vector<JPH::Vec3> spine = buildSpine(tpl.plan);
+
+    if (tpl.plan.kind == BodyPlanKind::RigidCapsule) {
+        float halfHeight = 0.5f * (spine.back() - spine.front()).Length();
+        JPH::RotatedTranslatedShapeSettings lying(
+            JPH::Vec3::sZero(),
+            JPH::Quat::sRotation(JPH::Vec3::sAxisZ(), 0.5f * JPH::JPH_PI),
+            new JPH::CapsuleShapeSettings(halfHeight, 1.0f));
+        tpl.unitShape = createShape(lying);
+    } else {
+        JPH::StaticCompoundShapeSettings compound;
+        for (size_t i = 1; i < spine.size(); i++) {
+            JPH::Vec3 span = spine[i] - spine[i - 1];
+            float halfHeight = std::max(0.5f * span.Length(), 1e-3f);
+            compound.AddShape(
+                (spine[i] + spine[i - 1]) * 0.5f,
+                JPH::Quat::sFromTo(JPH::Vec3::sAxisY(), span.Normalized()),
+                new JPH::CapsuleShapeSettings(halfHeight, 1.0f));
+        }
+        tpl.unitShape = createShape(compound);
+    }
+
+    float reach = 0.0f;
+    for (const JPH::Vec3& p : spine) {
+        reach = std::max(reach, p.Length());
+    }
+    tpl.plan.reach = reach + 1.0f;
+
+    // Pairs of points either side of the spine so the blobs fill the rod's width
+    float length = 0.0f;
+    for (size_t i = 1; i < spine.size(); i++) {
+        length += (spine[i] - spine[i - 1]).Length();
+    }
+    int count = std::clamp((int)std::ceil(length / SampleSpacing) + 1, 2, MaxSpineSamples);
+    std::vector<JPH::Vec3> points = resample(spine, count);
+    for (int i = 0; i < count; i++) {
+        JPH::Vec3 dir = points[(size_t)std::min(i + 1, count - 1)] - points[(size_t)std::max(i - 1, 0)];
+        dir = dir.NormalizedOr(JPH::Vec3::sAxisX());
+        JPH::Vec3 side(-dir.GetZ(), 0.0f, dir.GetX());
+        tpl.samples.push_back(toRaylib(points[(size_t)i] + side * SampleSpread));
+        tpl.samples.push_back(toRaylib(points[(size_t)i] - side * SampleSpread));
+    }
+}
+
+void buildCapsidTemplate(PlanTemplate& tpl) {
+    IcosphereMesh head = GenerateIcosphere(0, 1.0f);
+    JPH::Array<JPH::Vec3> hull;
+    for (const Vector3& v : head.vertices) {
+        hull.push_back(JPH::Vec3(v.x, v.y, v.z));
+        tpl.samples.push_back({v.x * CapsidSampleScale, v.y * CapsidSampleScale, v.z * CapsidSampleScale});
+    }
+
+    float tail = tpl.plan.tail;
+    if (tail <= 0.0f) {
+        JPH::ConvexHullShapeSettings capsid(hull);
+        tpl.unitShape = createShape(capsid);
+        tpl.plan.reach = 1.0f;
+        return;
+    }
+
+    // Phage: the head sits at the origin with the tail lying along -X
+    float halfHeight = std::max(0.5f * tail - TailRadius, 1e-3f);
+    float tailCentre = -(1.0f + 0.5f * tail);
+    JPH::StaticCompoundShapeSettings phage;
+    phage.AddShape(JPH::Vec3::sZero(), JPH::Quat::sIdentity(), new JPH::ConvexHullShapeSettings(hull));
+    phage.AddShape(JPH::Vec3(tailCentre, 0.0f, 0.0f),
+                   JPH::Quat::sRotation(JPH::Vec3::sAxisZ(), 0.5f * JPH::JPH_PI),
+                   new JPH::CapsuleShapeSettings(halfHeight, TailRadius));
+    tpl.unitShape = createShape(phage);
+    tpl.plan.reach = 1.0f + tail;
+
+    int count = std::max((int)std::ceil(tail / SampleSpacing), 1);
+    for (int i = 1; i <= count; i++) {
+        tpl.samples.push_back({-1.0f - tail * (float)i / (float)count + TailRadius, 0.0f, 0.0f});
+    }
+}
+
+void buildTemplates() {
+    // Shapes need Jolt's allocator hooks
+    PhysicsRuntime::ensureInitialized();
+
+    for (int t = 0; t < components::MicrobeTypeCount; t++) {
+        PlanTemplate& tpl = templates[t];
+        tpl.plan = PlanTable[t];
+
+        switch (tpl.plan.kind) {
+            case BodyPlanKind::SoftMembrane:
+                break;
+            case BodyPlanKind::RigidSphere: {
+                JPH::SphereShapeSettings sphere(1.0f);
+                tpl.unitShape = createShape(sphere);
+                tpl.plan.reach = 1.0f;
+                tpl.samples = {
+                    {SampleSpread, 0.0f, 0.0f}, {-SampleSpread, 0.0f, 0.0f},
+                    {0.0f, 0.0f, SampleSpread}, {0.0f, 0.0f, -SampleSpread}
+                };
+                break;
+            }
+            case BodyPlanKind::RigidCapsule:
+            case BodyPlanKind::RigidCurvedCompound:
+                buildRodTemplate(tpl);
+                break;
+            case BodyPlanKind::RigidConvexCapsid:
+                buildCapsidTemplate(tpl);
+                break;
+        }
+    }
+}
+
+const PlanTemplate& templateFor(MicrobeType type) {
+    std::call_once(templatesOnce, buildTemplates);
+    int index = std::clamp((int)type, 0, components::MicrobeTypeCount - 1);
+    return templates[index];
+}
+
+} // namespace
+
+const BodyPlan& BodyPlanFactory::GetPlan(components::MicrobeType type) {
+    return templateFor(type).plan;
+}
+
+const std::vector<Vector3>& BodyPlanFactory::GetSamplePoints(components::MicrobeType type) {
+    return templateFor(type).samples;
+}
+
+bool BodyPlanFactory::CreateBody(
+    PhysicsSystemState* physics,
+    components::MicrobeType type,
+    Vector3 position,
+    float radius,
+    float heading,
+    components::Microbe& microbe,
+    std::vector<JPH::BodyID>& outSkeletonBodyIDs
+) {
+    const PlanTemplate& tpl = templateFor(type);
+    microbe.type = type;
+    microbe.plan = tpl.plan.kind;
+
+    if (!IsRigid(tpl.plan.kind)) {
+        int subdivisions = 1;  // 42 vertices (balanced detail vs. performance)
+        microbe.softBody.bodyID = SoftBodyFactory::CreateAmoeba(physics, position, radius, subdivisions, outSkeletonBodyIDs);
+        microbe.softBody.vertexCount = SoftBodyFactory::GetVertexCount(physics, microbe.softBody.bodyID);
+        microbe.softBody.subdivisions = subdivisions;
+        return !microbe.softBody.bodyID.IsInvalid();
+    }
+
+    outSkeletonBodyIDs.clear();
+    microbe.softBody.bodyID = JPH::BodyID();
+    microbe.softBody.vertexCount = 0;
+    microbe.softBody.subdivisions = 0;
+    if (tpl.unitShape == nullptr) {
+        return false;
+    }
+
+    JPH::ShapeRefC shape = new JPH::ScaledShape(tpl.unitShape, JPH::Vec3::sReplicate(radius));
+    JPH::BodyCreationSettings settings(
+        shape,
+        JPH::RVec3(position.x, position.y, position.z),
+        JPH::Quat::sRotation(JPH::Vec3::sAxisY(), heading),
+        JPH::EMotionType::Dynamic,
+        Layers::MOVING
+    );
+
+    // Falls onto the dish like the membranes, but never tips over
+    settings.mAllowedDOFs = JPH::EAllowedDOFs::TranslationX | JPH::EAllowedDOFs::TranslationY |
+                            JPH::EAllowedDOFs::TranslationZ | JPH::EAllowedDOFs::RotationY;
+    settings.mFriction = 0.8f;
+    settings.mRestitution = 0.0f;
+    settings.mLinearDamping = 2.4f;   // Same viscous medium as the membranes
+    settings.mAngularDamping = 2.4f;
+    settings.mGravityFactor = 2.2f;
+    // Sleeping stays allowed: idle bacteria drop out of the solver entirely
+
+    JPH::BodyID bodyID = physics->physicsSystem->GetBodyInterface().CreateAndAddBody(
+        settings, JPH::EActivation::Activate);
+    if (bodyID.IsInvalid()) {
+        return false;
+    }
+
+    microbe.softBody.bodyID = bodyID;
+    microbe.softBody.vertexCount = (int)tpl.samples.size();
+    return true;
+}
+
+void BodyPlanFactory::DestroyBody(
+    PhysicsSystemState* physics,
+    const components::Microbe& microbe,
+    const components::InternalSkeleton* skeleton
+) {
+    if (!physics) {
+        return;
+    }
+    if (skeleton) {
+        for (JPH::BodyID id : skeleton->skeletonBodyIDs) {
+            physics->destroyBody(id);
+        }
+    }
+    if (IsRigid(microbe.plan)) {
+        physics->destroyBody(microbe.softBody.bodyID);
+    } else {
+        SoftBodyFactory::ReleaseAmoeba(physics, microbe.softBody.bodyID);
+    }
+}
+
+bool BodyPlanFactory::Divide(
+    PhysicsSystemState* physics,
+    const components::Microbe& parent,
+    float splitAngle,
+    components::Microbe& outA,
+    components::Microbe& outB
+) {
+    if (!physics || IsRigid(parent.plan)) {
+        return false;
+    }
+
+    std::vector<Vector3> local;
+    std::vector<Vector3> velocities;
+    Vector3 center;
+    int count = SoftBodyFactory::ReadVertexState(physics, parent.softBody.bodyID, local, velocities, center);
+    if (count == 0) {
+        return false;
+    }
+
+    // Half the volume each; the parent's shape shrinks about its center of mass
+    const float scale = 1.0f / std::cbrt(2.0f);
+    float radius = parent.stats.baseRadius * scale;
+    for (Vector3& p : local) {
+        p = {p.x * scale, p.y * scale, p.z * scale};
+    }
+
+    // Daughters sit side by side where the parent was, just touching
+    Vector3 offset = {std::cos(splitAngle) * radius, 0.0f, -std::sin(splitAngle) * radius};
+    Vector3 centers[2] = {
+        {center.x + offset.x, center.y, center.z + offset.z},
+        {center.x - offset.x, center.y, center.z - offset.z},
+    };
+
+    int subdivisions = parent.softBody.subdivisions;
+    components::Microbe* daughters[2] = {&outA, &outB};
+    for (int i = 0; i < 2; i++) {
+        JPH::BodyID id = SoftBodyFactory::CreateAmoebaFromState(physics, centers[i], radius, subdivisions,
+                                                                local.data(), velocities.data(), count);
+        if (id.IsInvalid()) {
+            if (i == 1) {
+                SoftBodyFactory::ReleaseAmoeba(physics, outA.softBody.bodyID);
+            }
+            return false;
+        }
+
+        components::Microbe& daughter = *daughters[i];
+        daughter = parent;
+        daughter.stats.baseRadius = radius;
+        daughter.stats.energy = parent.stats.energy * 0.5f;
+        daughter.softBody.bodyID = id;
+        daughter.softBody.vertexCount = count;
+        daughter.softBody.subdivisions = subdivisions;
+    }
+
+    // Sibling membranes vary from each other, not just from the parent
+    outB.stats.seed = std::fmod(parent.stats.seed + 0.61803398875f, 1.0f);
+
+    SoftBodyFactory::ReleaseAmoeba(physics, parent.softBody.bodyID);
+    return true;
+}
+
+int BodyPlanFactory::ExtractSamplePoints(
+    PhysicsSystemState* physics,
+    const components::Microbe& microbe,
+    Vector3* outPositions,
+    int maxPositions,
+    math::PointBounds* outBounds
+) {
+    if (!IsRigid(microbe.plan)) {
+        return SoftBodyFactory::ExtractVertexPositions(physics, microbe.softBody.bodyID, outPositions,
+                                                       maxPositions, outBounds);
+    }
+    if (!physics || microbe.softBody.bodyID.IsInvalid()) {
+        return 0;
+    }
+
+    const std::vector<Vector3>& samples = templateFor(microbe.type).samples;
+    int count = std::min((int)samples.size(), maxPositions);
+    if (count <= 0) {
+        return 0;
+    }
+
+    JPH::RVec3 position;
+    JPH::Quat rotation;
+    physics->physicsSystem->GetBodyInterface().GetPositionAndRotation(microbe.softBody.bodyID, position, rotation);
+    math::RigidTransformA transform = math::from_jolt(rotation, JPH::Vec3(position));
+    math::PointBounds bounds;
+    math::transform_points_sampled_bounds(transform, math::strided(samples.data()), (size_t)count,
+                                          math::strided(outPositions), (size_t)count,
+                                          outBounds ? *outBounds : bounds, microbe.stats.baseRadius);
+    return count;
+}
+
+} // namespace micro_idle
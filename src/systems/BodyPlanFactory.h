@@ -0,0 +1,116 @@
+#ifndef MICRO_IDLE_BODY_PLAN_FACTORY_H
+#define MICRO_IDLE_BODY_PLAN_FACTORY_H
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/BodyID.h>
+#include "raylib.h"
+#include "src/components/Microbe.h"
+#include <vector>
+
+namespace math {
+struct PointBounds;
+}
+
+namespace micro_idle {
+
+struct PhysicsSystemState; // Forward declaration
+
+// Shape parameters for one microbe type, in units of the microbe's base radius
+struct BodyPlan {
+    components::BodyPlanKind kind;
+    float sizeScale;    // Spawn radius relative to a protist's
+    float aspect;       // Rod length / diameter (capsule, curved compound)
+    float bend;         // Curved compound: radians turned along a single arc
+    int waves;          // Curved compound: full waves along the spine (0 = single arc)
+    float tail;         // Convex capsid: tail length (0 = bare capsid)
+    float reach;        // Farthest point of the shape from its origin (filled in by the factory)
+};
+
+/**
+ * Factory for microbe bodies, one plan per MicrobeType
+ *
+ * Protists keep the soft membrane from SoftBodyFactory. Bacteria and viruses
+ * get a single rigid body (sphere, capsule, compound of capsules along a bent
+ * spine, or convex hull capsid) that may only yaw, so thousands of them cost
+ * rigid-body prices. Unit-radius shapes are built once per process and shared
+ * by every world; each body wraps one in a uniform scale.
+ *
+ * Rigid plans feed the same SDF render path by emitting a fixed set of sample
+ * points along their shape instead of soft body vertices.
+ */
+class BodyPlanFactory {
+public:
+    static const BodyPlan& GetPlan(components::MicrobeType type);
+
+    static bool IsRigid(components::BodyPlanKind kind) {
+        return kind != components::BodyPlanKind::SoftMembrane;
+    }
+
+    /**
+     * Create the body for a microbe type and record it in microbe.softBody / microbe.plan
+     *
+     * @param heading Initial yaw in radians (rigid plans only)
+     * @param outSkeletonBodyIDs Skeleton bodies of soft plans (always empty for rigid plans)
+     * @return false if Jolt could not create the body
+     */
+    static bool CreateBody(
+        PhysicsSystemState* physics,
+        components::MicrobeType type,
+        Vector3 position,
+        float radius,
+        float heading,
+        components::Microbe& microbe,
+        std::vector<JPH::BodyID>& outSkeletonBodyIDs
+    );
+
+    // Remove the microbe's body and any skeleton bodies. Soft bodies go back to
+    // the world's pool for reuse; everything else is destroyed.
+    static void DestroyBody(
+        PhysicsSystemState* physics,
+        const components::Microbe& microbe,
+        const components::InternalSkeleton* skeleton
+    );
+
+    /**
+     * Split a soft microbe into two daughters along a vertical plane through its center
+     *
+     * Each daughter has half the parent's volume (radius / cbrt 2) and starts from the
+     * parent's current vertex shape and velocities, scaled down, so a squashed or
+     * stretched parent divides into squashed or stretched daughters. Bodies come from
+     * the pool and the cached settings for the daughter size. On success the parent's
+     * body is released to the pool and must no longer be used.
+     *
+     * @param splitAngle Yaw of the axis the daughters separate along (radians)
+     * @param outA, outB Daughter microbes: type, stats and body (stats.energy is shared between them)
+     * @return false for rigid plans or if a body could not be created (parent untouched)
+     */
+    static bool Divide(
+        PhysicsSystemState* physics,
+        const components::Microbe& parent,
+        float splitAngle,
+        components::Microbe& outA,
+        components::Microbe& outB
+    );
+
+    /**
+     * World-space points for SDF rendering: soft body vertices, or the rigid
+     * plan's sample points moved by the body transform. Bounds of the points
+     * (optional) come from the same pass.
+     *
+     * @return Number of points written (at most maxPositions)
+     */
+    static int ExtractSamplePoints(
+        PhysicsSystemState* physics,
+        const components::Microbe& microbe,
+        Vector3* outPositions,
+        int maxPositions,
+        math::PointBounds* outBounds = nullptr
+    );
+
+    // Unit-radius sample points of a rigid plan in body space (empty for soft plans)
+    static const std::vector<Vector3>& GetSamplePoints(components::MicrobeType type);
+};
+
+} // namespace micro_idle
+
+#endif
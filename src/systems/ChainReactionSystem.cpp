@@ -0,0 +1,184 @@
+#include "ChainReactionSystem.h"
+#include "src/components/ChainReaction.h"
+#include "src/components/Damage.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/Resource.h"
+#include "src/components/Upgrades.h"
+#include "src/systems/ResourceSystem.h"
+#include "raylib.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace micro_idle {
+
+int ChainReactionSystem::maxHops(const components::PlayerUpgrades& upgrades) {
+    return upgrades.chainReaction > 0 ? 1 + 2 * upgrades.chainReaction : 0;
+}
+
+namespace {
+
+// One hop of `wave` is done; the wave is forgotten once nothing of it is left
+void retire(components::ChainReactions& chains, uint32_t wave) {
+    auto it = chains.waves.find(wave);
+    if (it != chains.waves.end() && --it->second.live <= 0) {
+        chains.waves.erase(it);
+    }
+}
+
+} // namespace
+
+uint32_t ChainReactionSystem::trigger(components::ChainReactions& chains, flecs::entity_t source, float x,
+                                      float z, float damage, int hops) {
+    if (hops <= 0 || chains.pending() >= chains.maxQueued) {
+        return 0;
+    }
+    uint32_t wave = chains.nextWave++;
+    if (chains.nextWave == 0) {
+        chains.nextWave = 1;
+    }
+    components::ChainWave& state = chains.waves[wave];
+    state.reached.insert(source);
+    state.live = 1;
+
+    // The source detonates on the next step (it is already dead, so it takes nothing)
+    chains.detonations.push_back({source, x, z, 0.0f, damage, chains.clock, wave, hops});
+    return wave;
+}
+
+bool ChainReactionSystem::detonate(components::ChainReactions& chains, flecs::entity_t entity, float x, float z) {
+    auto it = chains.armed.find(entity);
+    if (it == chains.armed.end()) {
+        return false;
+    }
+    components::ChainHop hop = it->second;
+    chains.armed.erase(it);
+    hop.x = x;
+    hop.z = z;
+    hop.due = chains.clock;
+    chains.detonations.push_back(hop);
+    return true;
+}
+
+int ChainReactionSystem::step(components::ChainReactions& chains, const components::MicrobeIndex& index,
+                              float dt, components::DamageBuffer& buffer) {
+    chains.clock += dt;
+    for (components::ChainFlash& flash : chains.flashes) {
+        flash.age += dt;
+    }
+    std::erase_if(chains.flashes, [](const components::ChainFlash& flash) { return flash.age > FlashLifetime; });
+
+    // Last tick's blasts that are still armed hit microbes that survived: the wave stops there
+    for (const auto& [entity, hop] : chains.armed) {
+        retire(chains, hop.wave);
+    }
+    chains.armed.clear();
+
+    // Detonations first, so a cascade keeps moving when the budget is tight
+    int fired = 0;
+    std::vector<std::pair<float, int>> near;
+    size_t done = 0;
+    for (; done < chains.detonations.size() && fired < chains.hopsPerTick; done++) {
+        components::ChainHop hop = chains.detonations[done];
+        fired++;
+        chains.flashes.push_back({hop.x, hop.z, 0.0f});
+        auto wave = chains.waves.find(hop.wave);
+        if (hop.hopsLeft > 0 && index.size() > 0 && wave != chains.waves.end()) {
+            // Footprints sit in every cell they overlap, so a query the size of the
+            // hop's reach finds every neighbour it can jump to (some more than once)
+            near.clear();
+            index.grid.forEachNear(hop.x, hop.z, chains.hopRadius, [&](int i) {
+                flecs::entity_t e = index.entities[(size_t)i];
+                if (e == hop.entity) {
+                    return;
+                }
+                float dx = index.x[(size_t)i] - hop.x;
+                float dz = index.z[(size_t)i] - hop.z;
+                float reach = chains.hopRadius + index.radius[(size_t)i];
+                float d2 = dx * dx + dz * dz;
+                if (d2 <= reach * reach) {
+                    near.push_back({d2, i});
+                }
+            });
+            std::sort(near.begin(), near.end());
+            near.erase(std::unique(near.begin(), near.end()), near.end());
+
+            int taken = 0;
+            for (const auto& [d2, i] : near) {
+                if (taken == chains.maxFanout || chains.pending() >= chains.maxQueued) {
+                    break;
+                }
+                flecs::entity_t e = index.entities[(size_t)i];
+                if (!wave->second.reached.insert(e).second) {
+                    continue;
+                }
+                chains.queue.push_back({e, index.x[(size_t)i], index.z[(size_t)i], hop.spread,
+                                        hop.spread * chains.falloff, chains.clock + chains.hopDelay, hop.wave,
+                                        hop.hopsLeft - 1});
+                wave->second.live++;
+                taken++;
+            }
+        }
+        retire(chains, hop.wave);
+    }
+    chains.detonations.erase(chains.detonations.begin(), chains.detonations.begin() + (std::ptrdiff_t)done);
+
+    // Blasts queue their damage and stay armed until DestructionSystem applies it:
+    // the ones that kill detonate (see detonate), the rest are dropped next step
+    while (fired < chains.hopsPerTick && chains.head < chains.queue.size() &&
+           chains.queue[chains.head].due <= chains.clock) {
+        const components::ChainHop& hop = chains.queue[chains.head++];
+        fired++;
+        buffer.add(hop.entity, hop.damage, components::DamageSource::Effect);
+        auto [slot, fresh] = chains.armed.try_emplace(hop.entity, hop);
+        if (!fresh) {
+            // Blasted by two waves in one tick: only the later one can carry on
+            retire(chains, slot->second.wave);
+            slot->second = hop;
+        }
+    }
+
+    // Drop fired blasts once they are half the queue
+    if (chains.head == chains.queue.size()) {
+        chains.queue.clear();
+        chains.head = 0;
+    } else if (chains.head * 2 >= chains.queue.size()) {
+        chains.queue.erase(chains.queue.begin(), chains.queue.begin() + (std::ptrdiff_t)chains.head);
+        chains.head = 0;
+    }
+    return fired;
+}
+
+void ChainReactionSystem::registerSystem(flecs::world& world) {
+    world.system("ChainReactionSystem")
+        .kind(flecs::OnUpdate)
+        .run([](flecs::iter& it) {
+            flecs::world w = it.world();
+            auto chains = w.get_mut<components::ChainReactions>();
+            auto index = w.get<components::MicrobeIndex>();
+            auto buffer = w.get_mut<components::DamageBuffer>();
+            if (chains && index && buffer) {
+                step(*chains, *index, it.delta_time(), *buffer);
+            }
+        });
+}
+
+void ChainReactionSystem::registerRenderSystem(flecs::world& world) {
+    // A ring per fired hop, growing and fading out on the dish floor
+    world.system("ChainReactionRender")
+        .kind(flecs::PostUpdate)
+        .run([](flecs::iter& it) {
+            auto chains = it.world().get<components::ChainReactions>();
+            if (!chains || chains->flashes.empty()) {
+                return;
+            }
+            Color color = ResourceSystem::colorFor(components::ResourceType::Sodium);
+            for (const components::ChainFlash& flash : chains->flashes) {
+                float t = flash.age / FlashLifetime;
+                DrawCircle3D({flash.x, 0.21f, flash.z}, FlashRadius * t, {1.0f, 0.0f, 0.0f}, 90.0f,
+                             Fade(color, 1.0f - t));
+            }
+        });
+}
+
+} // namespace micro_idle
@@ -0,0 +1,69 @@
+#ifndef MICRO_IDLE_CHAIN_REACTION_SYSTEM_H
+#define MICRO_IDLE_CHAIN_REACTION_SYSTEM_H
+
+#include <flecs.h>
+#include <cstdint>
+
+namespace components {
+struct ChainReactions;
+struct DamageBuffer;
+struct MicrobeIndex;
+struct PlayerUpgrades;
+}
+
+namespace micro_idle {
+
+// ChainReactionSystem - frame-budgeted chain detonations through the MicrobeIndex
+// Waves are set off by DestructionSystem (click kills, with the Sodium chain
+// upgrade), which also detonates the microbes a blast killed. Step runs in
+// OnUpdate phase (before DestructionSystem applies the damage buffer), draw in
+// PostUpdate.
+class ChainReactionSystem {
+public:
+    static constexpr float HopDamage = 60.0f;       // Taken by the first ring of neighbours
+    static constexpr float FlashLifetime = 0.4f;
+    static constexpr float FlashRadius = 0.5f;
+
+    // Register the system with FLECS world
+    static void registerSystem(flecs::world& world);
+
+    static void registerRenderSystem(flecs::world& world);
+
+    // Jumps a wave makes at the upgrade level (0 = no chain reactions)
+    static int maxHops(const components::PlayerUpgrades& upgrades);
+
+    /**
+     * Start a wave from a microbe that just died at (x, z): it detonates on the
+     * next step, and hopDelay later its neighbours take `damage`. Each one that
+     * dies of it detonates in turn, passing `damage * falloff` on, for up to
+     * `hops` jumps.
+     *
+     * @return Wave id, 0 if the queue is full
+     */
+    static uint32_t trigger(components::ChainReactions& chains, flecs::entity_t source, float x, float z,
+                            float damage, int hops);
+
+    /**
+     * A microbe died at (x, z). If a blast fired this tick hit it, it detonates
+     * on the next step and carries that blast's wave on.
+     *
+     * @return Whether the microbe was armed
+     */
+    static bool detonate(components::ChainReactions& chains, flecs::entity_t entity, float x, float z);
+
+    /**
+     * Advance the chain clock by dt and fire, at most hopsPerTick in all:
+     * waiting detonations, which schedule blasts at their nearest unreached
+     * neighbours hopDelay later, then due blasts in breadth-first order, which
+     * queue their damage and stay armed until it is applied. Armed blasts left
+     * over from the last tick missed their kill and end there.
+     *
+     * @return Number of hops fired
+     */
+    static int step(components::ChainReactions& chains, const components::MicrobeIndex& index, float dt,
+                    components::DamageBuffer& buffer);
+};
+
+} // namespace micro_idle
+
+#endif
@@ -1,16 +1,28 @@
 #include "DestructionSystem.h"
+#include "src/components/ChainReaction.h"
 #include "src/components/Microbe.h"
 #include "src/components/Transform.h"
 #include "src/components/Resource.h"
 #include "src/components/Input.h"
+#include "src/components/RandomStreams.h"
+#include "src/components/StatusEffects.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/Upgrades.h"
+#include "src/math/Simd.h"
+#include "src/systems/ChainReactionSystem.h"
 #include "src/systems/PhysicsSystem.h"
 #include "src/systems/ResourceSystem.h"
+#include "src/systems/StatusEffectSystem.h"
 #include "raylib.h"
+#include <algorithm>
 #include <cmath>
-#include <cstdio>
+#include <numeric>
+#include <vector>
 
 namespace micro_idle {
 
+using math::Float8;
+
 bool DestructionSystem::isPointInMicrobe(Vector3 point, Vector3 microbePos, float microbeRadius) {
     float dx = point.x - microbePos.x;
     float dy = point.y - microbePos.y;
@@ -20,102 +32,286 @@ bool DestructionSystem::isPointInMicrobe(Vector3 point, Vector3 microbePos, floa
     return distSq <= radiusSq;
 }
 
-bool DestructionSystem::applyDamage(flecs::entity microbeEntity, float damage) {
-    auto microbe = microbeEntity.get_mut<components::Microbe>();
-    if (!microbe) {
-        return false;
-    }
+float DestructionSystem::hoverRadius(const components::PlayerUpgrades& upgrades) {
+    return 0.3f + 0.25f * (float)std::max(upgrades.hoverRadius, 0);
+}
 
-    microbe->stats.health -= damage;
+int DestructionSystem::queueDiscDamage(const components::MicrobeIndex& index, float x, float z, float radius,
+                                       float amount, components::DamageSource source,
+                                       components::DamageBuffer& buffer) {
+    Vector2 point = {x, z};
+    return queueSweptDamage(index, &point, 1, radius, amount, source, buffer);
+}
 
-    if (microbe->stats.health <= 0.0f) {
-        return true;  // Microbe destroyed
+int DestructionSystem::findSwept(const components::MicrobeIndex& index, const Vector2* path, int count,
+                                 float radius, std::vector<int>& outSlots) {
+    outSlots.clear();
+    if (count <= 0) {
+        return 0;
     }
 
-    return false;
+    // Footprints are indexed in every cell they overlap, so the path's bounds
+    // grown by the disc find every candidate; one spanning several cells is
+    // visited more than once
+    float minX = path[0].x, maxX = path[0].x;
+    float minZ = path[0].y, maxZ = path[0].y;
+    for (int p = 1; p < count; p++) {
+        minX = std::min(minX, path[p].x);
+        maxX = std::max(maxX, path[p].x);
+        minZ = std::min(minZ, path[p].y);
+        maxZ = std::max(maxZ, path[p].y);
+    }
+
+    index.grid.forEachInBox(minX - radius, minZ - radius, maxX + radius, maxZ + radius, [&](int i) {
+        float x = index.x[(size_t)i];
+        float z = index.z[(size_t)i];
+        float reach = radius + index.radius[(size_t)i];
+        float reach2 = reach * reach;
+
+        // Closest point of each segment (a lone point is a zero-length segment)
+        int segments = std::max(count - 1, 1);
+        for (int p = 0; p < segments; p++) {
+            Vector2 a = path[p];
+            Vector2 b = path[std::min(p + 1, count - 1)];
+            float abx = b.x - a.x;
+            float abz = b.y - a.y;
+            float len2 = abx * abx + abz * abz;
+            float t = len2 > 0.0f ? std::clamp(((x - a.x) * abx + (z - a.y) * abz) / len2, 0.0f, 1.0f) : 0.0f;
+            float dx = x - (a.x + abx * t);
+            float dz = z - (a.y + abz * t);
+            if (dx * dx + dz * dz < reach2) {
+                outSlots.push_back(i);
+                return;
+            }
+        }
+    });
+    std::sort(outSlots.begin(), outSlots.end());
+    outSlots.erase(std::unique(outSlots.begin(), outSlots.end()), outSlots.end());
+    return (int)outSlots.size();
 }
 
-void DestructionSystem::destroyMicrobe(flecs::entity microbeEntity, flecs::world& world) {
-    auto microbe = microbeEntity.get<components::Microbe>();
-    if (!microbe) {
-        return;
+int DestructionSystem::queueSweptDamage(const components::MicrobeIndex& index, const Vector2* path, int count,
+                                        float radius, float amount, components::DamageSource source,
+                                        components::DamageBuffer& buffer) {
+    std::vector<int> hits;
+    findSwept(index, path, count, radius, hits);
+    for (int i : hits) {
+        buffer.add(index.entities[(size_t)i], amount, source);
     }
+    return (int)hits.size();
+}
 
-    auto transform = microbeEntity.get<components::Transform>();
-    if (!transform) {
-        return;
+int DestructionSystem::applyDamage(flecs::world& world, components::DamageBuffer& buffer) {
+    int n = buffer.size();
+    if (n == 0) {
+        return 0;
     }
 
-    // Spawn resources based on microbe type and traits
-    // For now, spawn basic resource drops
-    // This will be expanded when progression system is implemented
+    // Sum hits per entity, in entity order so the outcome does not depend on
+    // which system queued first
+    std::vector<int> order((size_t)n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return buffer.entities[(size_t)a] < buffer.entities[(size_t)b];
+    });
 
-    // Spawn a random resource drop (placeholder)
-    // TODO: Determine resource type based on microbe traits
-    components::ResourceType resourceType = components::ResourceType::Sodium;
-    float resourceAmount = 1.0f + (float)(rand() % 5);  // 1-5 units
+    std::vector<flecs::entity> targets;
+    std::vector<components::Microbe*> microbes;
+    std::vector<float> health;
+    std::vector<float> damage;
+    std::vector<uint8_t> clicked;
+    for (int k = 0; k < n; k++) {
+        size_t i = (size_t)order[(size_t)k];
+        flecs::entity_t id = buffer.entities[i];
+        bool click = buffer.sources[i] == (uint8_t)components::DamageSource::Click;
+        if (!targets.empty() && targets.back().id() == id) {
+            damage.back() += buffer.amounts[i];
+            clicked.back() |= click;
+            continue;
+        }
+        flecs::entity e(world, id);
+        if (!e.is_alive()) {
+            continue;
+        }
+        components::Microbe* microbe = e.get_mut<components::Microbe>();
+        if (!microbe) {
+            continue;
+        }
+        targets.push_back(e);
+        microbes.push_back(microbe);
+        health.push_back(microbe->stats.health);
+        damage.push_back(buffer.amounts[i]);
+        clicked.push_back(click);
+    }
+    buffer.clear();
 
-    ResourceSystem::spawnResource(world, resourceType, resourceAmount, transform->position);
+    // One pass over health; padding lanes take no damage and never die
+    int count = (int)targets.size();
+    size_t padded = (size_t)((count + Float8::Width - 1) & ~(Float8::Width - 1));
+    health.resize(padded, 1.0f);
+    damage.resize(padded, 0.0f);
+    const Float8 zero = Float8::zero();
+    std::vector<int> dead;
+    for (int i = 0; i < count; i += Float8::Width) {
+        Float8 h = Float8::load(&health[(size_t)i]) - Float8::load(&damage[(size_t)i]);
+        h.store(&health[(size_t)i]);
+        int died = (h <= zero).bits();
+        for (int lane = 0; lane < Float8::Width && i + lane < count; lane++) {
+            if (died & (1 << lane)) {
+                dead.push_back(i + lane);
+            }
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        microbes[(size_t)i]->stats.health = health[(size_t)i];
+    }
+    if (dead.empty()) {
+        return 0;
+    }
 
-    // Destroy the entity (FLECS will handle cleanup)
-    microbeEntity.destruct();
+    // Deaths as one batch: every drop first, then every entity in one deferred
+    // flush (bodies are released by the Microbe OnRemove observer)
+    // TODO: Determine resource type based on microbe traits
+    auto drops = world.get_mut<components::ResourceDrops>();
+    auto streams = world.get_mut<components::RandomStreams>();
+    auto chains = world.get_mut<components::ChainReactions>();
+    auto upgrades = world.get<components::PlayerUpgrades>();
+    int chainHops = upgrades ? ChainReactionSystem::maxHops(*upgrades) : 0;
+    for (int i : dead) {
+        auto transform = targets[(size_t)i].get<components::Transform>();
+        if (!transform) {
+            continue;
+        }
+        if (drops) {
+            float amount = streams ? (float)rng_range_i(&streams->destruction, 1, 5) : 1.0f;  // 1-5 units
+            ResourceSystem::addDrop(*drops, components::ResourceType::Sodium, amount,
+                                    transform->position.x, transform->position.z);
+        }
+        // Kills the player clicked set off a wave; microbes a blast killed pass theirs on
+        if (chains && chainHops > 0 && clicked[(size_t)i]) {
+            ChainReactionSystem::trigger(*chains, targets[(size_t)i].id(), transform->position.x,
+                                         transform->position.z, ChainReactionSystem::HopDamage, chainHops);
+        } else if (chains) {
+            ChainReactionSystem::detonate(*chains, targets[(size_t)i].id(), transform->position.x,
+                                          transform->position.z);
+        }
+    }
 
+    // Targets are in entity order, so the dead ids already come out sorted
+    auto effects = world.get_mut<components::StatusEffects>();
+    if (effects) {
+        std::vector<flecs::entity_t> ids;
+        ids.reserve(dead.size());
+        for (int i : dead) {
+            ids.push_back(targets[(size_t)i].id());
+        }
+        StatusEffectSystem::removeEntities(*effects, ids);
+    }
+
+    world.defer_begin();
+    for (int i : dead) {
+        targets[(size_t)i].destruct();
+    }
+    world.defer_end();
+    return (int)dead.size();
 }
 
 void DestructionSystem::registerSystem(flecs::world& world, PhysicsSystemState* physics) {
-    // System that handles hover/click detection and destruction
-    // Runs in OnUpdate phase (after Input, before physics)
+    (void)physics;
 
-    // Hover detection system
-    world.system<components::Microbe, components::Transform>("DestructionSystem_Hover")
+    // Cursor damage: everything the hover disc swept over since the last tick
+    // takes damage over time, a click hits what is directly under the cursor.
+    // Runs in OnUpdate phase (after Input), reading last tick's microbe index.
+    world.system("DestructionSystem_Cursor")
         .kind(flecs::OnUpdate)
-        .each([&world, physics](flecs::entity e, components::Microbe& microbe, components::Transform& transform) {
-            // Get input state
-            auto inputState = world.get<components::InputState>();
-            if (!inputState) {
+        .run([](flecs::iter& it) {
+            flecs::world w = it.world();
+            auto input = w.get_mut<components::InputState>();
+            if (!input) {
+                return;
+            }
+            if (!input->mouseWorldValid) {
+                input->mousePathCount = 0;
                 return;
             }
 
-            // Get mouse ray from camera
-            // TODO: Get camera from CameraState singleton
-            // For now, use a simple distance check from origin
+            // Injected input (replays) moves mouseWorld without sampling a path:
+            // sweep from where the last tick left off
+            float x = input->mouseWorld.x;
+            float z = input->mouseWorld.z;
+            int last = input->mousePathCount - 1;
+            if (last < 0 || input->mousePath[last].x != x || input->mousePath[last].y != z) {
+                if (input->mousePathCount == components::InputState::MaxPathPoints) {
+                    input->mousePathCount--;
+                }
+                input->mousePath[input->mousePathCount++] = {x, z};
+            }
 
-            // Simple hover detection: check if mouse is near microbe
-            // This is a placeholder - proper implementation needs ray casting
-            Vector3 mouseWorldPos = {0.0f, 0.0f, 0.0f};  // TODO: Get from input system
+            auto index = w.get<components::MicrobeIndex>();
+            auto buffer = w.get_mut<components::DamageBuffer>();
+            if (index && buffer && index->size() > 0) {
+                auto upgrades = w.get<components::PlayerUpgrades>();
+                float radius = upgrades ? hoverRadius(*upgrades) : hoverRadius(components::PlayerUpgrades{});
+                queueSweptDamage(*index, input->mousePath, input->mousePathCount, radius,
+                                 HoverDamagePerSecond * it.delta_time(), components::DamageSource::Hover, *buffer);
 
-            float hoverRadius = microbe.stats.baseRadius * 1.5f;  // Slightly larger than collision radius
-            if (isPointInMicrobe(mouseWorldPos, transform.position, hoverRadius)) {
-                // Microbe is being hovered - could add visual feedback here
-                // For now, just mark it (could add Hovered component)
+                // mouseLeftPressed is only true on the frame the button goes down
+                if (input->mouseLeftPressed) {
+                    queueDiscDamage(*index, x, z, ClickRadius, ClickDamage, components::DamageSource::Click, *buffer);
+                }
             }
+
+            // The next tick's sweep starts here
+            input->mousePath[0] = {x, z};
+            input->mousePathCount = 1;
         });
 
-    // Click destruction system
-    world.system<components::Microbe, components::Transform>("DestructionSystem_Click")
+    // Apply everything queued this tick in one batch
+    world.system("DestructionSystem_Apply")
         .kind(flecs::OnUpdate)
-        .each([&world, physics](flecs::entity e, components::Microbe& microbe, components::Transform& transform) {
-            // Get input state
-            auto inputState = world.get<components::InputState>();
-            if (!inputState) {
+        .run([](flecs::iter& it) {
+            flecs::world w = it.world();
+            auto buffer = w.get_mut<components::DamageBuffer>();
+            if (buffer && buffer->size() > 0) {
+                applyDamage(w, *buffer);
+            }
+        });
+}
+
+void DestructionSystem::registerRenderSystem(flecs::world& world) {
+    // Rings on the dish floor: the hover disc, and the footprint of every microbe under it
+    world.system("DestructionReticle")
+        .kind(flecs::PostUpdate)
+        .run([](flecs::iter& it) {
+            flecs::world w = it.world();
+            Vector3 cursor;
+            auto latch = w.get<components::CursorLatch>();
+            auto input = w.get<components::InputState>();
+            // Injected (replayed) input is the cursor; the OS one is not
+            if (latch && latch->valid && !(input && input->injected)) {
+                cursor = latch->mouseWorld;
+            } else if (input && input->mouseWorldValid) {
+                cursor = input->mouseWorld;
+            } else {
                 return;
             }
 
-            // Check if mouse was clicked (use mouseLeftPressed, not mouseLeftDown)
-            // mouseLeftDown stays true while held, mouseLeftPressed is only true on the frame it's pressed
-            if (inputState->mouseLeftPressed) {
-                // Simple click detection: check if mouse is near microbe
-                // TODO: Proper ray casting from camera
-                Vector3 mouseWorldPos = {0.0f, 0.0f, 0.0f};  // TODO: Get from input system
-
-                float clickRadius = microbe.stats.baseRadius * 1.2f;
-                if (isPointInMicrobe(mouseWorldPos, transform.position, clickRadius)) {
-                    // Apply damage
-                    float damage = 100.0f;  // Instant kill for now
-                    if (applyDamage(e, damage)) {
-                        destroyMicrobe(e, world);
-                    }
-                }
+            constexpr float ReticleHeight = 0.21f;     // Just above the dish floor
+            const Vector3 axis = {1.0f, 0.0f, 0.0f};   // Circles lie in XY; turn them flat
+            auto upgrades = w.get<components::PlayerUpgrades>();
+            float radius = upgrades ? hoverRadius(*upgrades) : hoverRadius(components::PlayerUpgrades{});
+            DrawCircle3D({cursor.x, ReticleHeight, cursor.z}, radius, axis, 90.0f, Fade(WHITE, 0.6f));
+
+            auto index = w.get<components::MicrobeIndex>();
+            if (!index || index->size() == 0) {
+                return;
+            }
+            std::vector<int> hovered;
+            Vector2 point = {cursor.x, cursor.z};
+            findSwept(*index, &point, 1, radius, hovered);
+            for (int i : hovered) {
+                DrawCircle3D({index->x[(size_t)i], ReticleHeight, index->z[(size_t)i]}, index->radius[(size_t)i],
+                             axis, 90.0f, Fade(RED, 0.5f));
             }
         });
 }
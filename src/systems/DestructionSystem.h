@@ -2,28 +2,83 @@
 #define MICRO_IDLE_DESTRUCTION_SYSTEM_H
 
 #include <flecs.h>
+#include "src/components/Damage.h"
 #include "raylib.h"
+#include <vector>
+
+namespace components {
+struct MicrobeIndex;
+struct PlayerUpgrades;
+}
 
 namespace micro_idle {
 
 struct PhysicsSystemState; // Forward declaration
 
-// DestructionSystem - handles hover/click detection and microbe destruction
+// DestructionSystem - hover/click damage and microbe destruction
+// Cursor hits (hover swept along the cursor's path since the last tick) are
+// queued into the DamageBuffer singleton, then the buffer is applied in one
+// batch. Both run in OnUpdate phase.
 class DestructionSystem {
 public:
+    static constexpr float HoverDamagePerSecond = 40.0f;
+    static constexpr float ClickDamage = 100.0f;
+    static constexpr float ClickRadius = 0.25f;
+
     // Register the system with FLECS world
     static void registerSystem(flecs::world& world, PhysicsSystemState* physics);
 
+    // Hover reticle and highlights (PostUpdate), drawn at the latched cursor
+    // (CursorLatch) so they follow the latest position, not the last tick's
+    static void registerRenderSystem(flecs::world& world);
+
     // Check if a point (mouse position) intersects with a microbe
     // Returns true if point is within microbe's collision radius
     static bool isPointInMicrobe(Vector3 point, Vector3 microbePos, float microbeRadius);
 
-    // Apply damage to a microbe
-    // Returns true if microbe was destroyed
-    static bool applyDamage(flecs::entity microbeEntity, float damage);
+    // Radius of the cursor's hover-damage disc for the bought upgrade level
+    static float hoverRadius(const components::PlayerUpgrades& upgrades);
+
+    /**
+     * Queue `amount` of damage for every indexed microbe whose footprint overlaps
+     * the disc (x, z, radius), each once
+     *
+     * @return Number of microbes hit
+     */
+    static int queueDiscDamage(const components::MicrobeIndex& index, float x, float z, float radius,
+                               float amount, components::DamageSource source,
+                               components::DamageBuffer& buffer);
+
+    /**
+     * Index slots of every microbe whose footprint overlaps the swept capsule
+     * of a cursor path: discs of `radius` dragged along each segment of `path`
+     * (x, z points; a single point is a disc). Candidates come from one grid
+     * query over the path's bounds. Each slot is listed once, in slot order.
+     */
+    static int findSwept(const components::MicrobeIndex& index, const Vector2* path, int count,
+                         float radius, std::vector<int>& outSlots);
+
+    /**
+     * Queue `amount` of damage, once each, for every indexed microbe whose
+     * footprint overlaps the swept capsule of a cursor path (see findSwept)
+     *
+     * @return Number of microbes hit
+     */
+    static int queueSweptDamage(const components::MicrobeIndex& index, const Vector2* path, int count,
+                                float radius, float amount, components::DamageSource source,
+                                components::DamageBuffer& buffer);
 
-    // Destroy a microbe and spawn resources
-    static void destroyMicrobe(flecs::entity microbeEntity, flecs::world& world);
+    /**
+     * Apply and clear the damage buffer: hits on the same entity are summed,
+     * health drops in one vectorized pass, then every microbe that died drops
+     * its resources and is destructed in one deferred batch (which tears down
+     * the bodies through the Microbe OnRemove observer). With the Sodium chain
+     * upgrade, each kill that took a click sets off a chain reaction, and each
+     * kill by a chain blast detonates to carry its wave on.
+     *
+     * @return Number of microbes destroyed
+     */
+    static int applyDamage(flecs::world& world, components::DamageBuffer& buffer);
 };
 
 } // namespace micro_idle
@@ -1,8 +1,10 @@
 #include "ECMLocomotionSystem.h"
 #include "src/components/Input.h"
 #include "src/components/Transform.h"
+#include "src/components/WorldState.h"
+#include "src/math/BatchKernels.h"
+#include "src/math/JoltInterop.h"
 #include <cmath>
-#include <cstdlib>
 #include <algorithm>
 #include <cstdint>
 #include <Jolt/Physics/Body/BodyInterface.h>
@@ -15,10 +17,6 @@ constexpr int POD_EXTEND = 1;
 constexpr int POD_HOLD = 2;
 constexpr int POD_RETRACT = 3;
 
-static float rand01() {
-    return (float)rand() / (float)RAND_MAX;
-}
-
 static float wrapAngle(float angle) {
     if (angle > PI) {
         angle = fmodf(angle + PI, 2.0f * PI) - PI;
@@ -105,19 +103,26 @@ void ECMLocomotionSystem::initialize(components::ECMLocomotion& locomotion, floa
     locomotion.orbitSign = hashToFloat(seed, 2) < 0.5f ? -1 : 1;
 
     locomotion.targetDirection = {cosf(locomotion.lastAngle), 0.0f, sinf(locomotion.lastAngle)};
+
+    // Derived from the seed so standalone components are reproducible; World
+    // replaces it with the entity's own stream
+    uint32_t seedBits = (uint32_t)(seed * 1000000.0f);
+    rng_seed_stream(&locomotion.rng, seedBits, 0);
 }
 
 void ECMLocomotionSystem::registerSystem(flecs::world& world, PhysicsSystemState* physics) {
     world.system<components::Microbe, components::ECMLocomotion, components::Transform>("ECMLocomotionSystem")
         .kind(flecs::OnUpdate)
         .run([physics](flecs::iter& it) {
+            auto worldState = it.world().get<components::WorldState>();
+            bool coarse = worldState && worldState->reducedFidelity;
             while (it.next()) {
                 auto microbes = it.field<components::Microbe>(0);
                 auto locomotions = it.field<components::ECMLocomotion>(1);
                 auto transforms = it.field<components::Transform>(2);
 
                 for (auto i : it) {
-                    update(it.entity(i), microbes[i], locomotions[i], transforms[i], physics, it.delta_time());
+                    update(it.entity(i), microbes[i], locomotions[i], transforms[i], physics, it.delta_time(), coarse);
                 }
             }
         });
@@ -129,7 +134,8 @@ void ECMLocomotionSystem::update(
     components::ECMLocomotion& locomotion,
     components::Transform& transform,
     PhysicsSystemState* physics,
-    float dt
+    float dt,
+    bool coarse
 ) {
     stepCortex(locomotion, dt);
 
@@ -150,7 +156,7 @@ void ECMLocomotionSystem::update(
         }
     }
 
-    applyPseudopodForces(locomotion, microbe, physics, dt);
+    applyPseudopodForces(locomotion, microbe, physics, dt, coarse);
 
     for (int i = 0; i < components::ECMLocomotion::MaxPods; i++) {
         auto& pod = locomotion.pods[i];
@@ -241,8 +247,7 @@ void ECMLocomotionSystem::update(
                 pod.state = POD_EXTEND;
                 pod.index = chosenIndex;
                 pod.time = 0.0f;
-                pod.duration = MIN_PSEUDOPOD_DURATION +
-                    rand01() * (MAX_PSEUDOPOD_DURATION - MIN_PSEUDOPOD_DURATION);
+                pod.duration = rng_range(&locomotion.rng, MIN_PSEUDOPOD_DURATION, MAX_PSEUDOPOD_DURATION);
                 pod.angle = (2.0f * PI * (float)chosenIndex) / (float)CortexSamples;
                 pod.extent = 0.0f;
                 pod.anchorSet = false;
@@ -336,11 +341,11 @@ bool ECMLocomotionSystem::tryStartPseudopod(components::ECMLocomotion& locomotio
     }
 
     float startChance = totalRate * dt;
-    if (rand01() >= std::min(1.0f, startChance)) {
+    if (rng_next_f01(&locomotion.rng) >= std::min(1.0f, startChance)) {
         return false;
     }
 
-    float pick = rand01() * totalRate;
+    float pick = rng_next_f01(&locomotion.rng) * totalRate;
     float accum = 0.0f;
     int chosen = 0;
     for (int i = 0; i < CortexSamples; i++) {
@@ -362,7 +367,8 @@ void ECMLocomotionSystem::applyPseudopodForces(
     components::ECMLocomotion& locomotion,
     components::Microbe& microbe,
     PhysicsSystemState* physics,
-    float dt
+    float dt,
+    bool coarse
 ) {
     if (microbe.softBody.bodyID.IsInvalid()) {
         return;
@@ -397,6 +403,8 @@ void ECMLocomotionSystem::applyPseudopodForces(
     float vertexSpeedScale = speed > maxVertexSpeed ? (maxVertexSpeed / speed) : 1.0f;
     float holdSpeedScale = std::max(0.6f, vertexSpeedScale);
 
+    // Extents are tracked in coarse mode too, so pods restored to the foreground
+    // are drawn (and bounded) where the membrane actually reached
     for (int i = 0; i < components::ECMLocomotion::MaxPods; i++) {
         auto& pod = locomotion.pods[i];
         if (pod.state == POD_INACTIVE) {
@@ -424,38 +432,13 @@ void ECMLocomotionSystem::applyPseudopodForces(
         }
     }
 
-    auto applyPod = [&](float angle, float magnitude, bool inward) {
-        if (magnitude <= 0.0f) {
-            return;
-        }
-        JPH::Vec3 worldDir(cosf(angle), 0.0f, sinf(angle));
-        JPH::Vec3 localDir = invRot * worldDir;
-        float targetAngle = atan2f(localDir.GetZ(), localDir.GetX());
-
-        for (auto& vertex : vertices) {
-            const JPH::Vec3& p = vertex.mPosition;
-            float radial = sqrtf(p.GetX() * p.GetX() + p.GetZ() * p.GetZ());
-            if (radial < minRadius) {
-                continue;
-            }
-
-            float angleAt = atan2f(p.GetZ(), p.GetX());
-            float delta = wrapAngle(angleAt - targetAngle);
-            float absDelta = fabsf(delta);
-            if (absDelta > arc) {
-                continue;
-            }
-
-            float radiusWeight = std::clamp((radial - minRadius) / denom, 0.0f, 1.0f);
-            float angleWeight = cosf((absDelta / arc) * (PI * 0.5f));
-            float weight = angleWeight * radiusWeight * radiusWeight;
-            if (weight > 0.0f) {
-                float sign = inward ? -1.0f : 1.0f;
-                vertex.mVelocity += localDir * (magnitude * weight * sign);
-            }
-        }
+    // Each active pod's push, in body space; signed for retraction
+    struct PodPush {
+        JPH::Vec3 impulse;
+        float targetAngle;
     };
-
+    PodPush pushes[components::ECMLocomotion::MaxPods];
+    int pushCount = 0;
     for (int i = 0; i < components::ECMLocomotion::MaxPods; i++) {
         const auto& pod = locomotion.pods[i];
         if (pod.state == POD_INACTIVE) {
@@ -467,15 +450,59 @@ void ECMLocomotionSystem::applyPseudopodForces(
         float rampOut = std::min(1.0f, remaining / FORCE_RAMP_TIME);
         float ramp = std::min(rampIn, rampOut);
 
+        float magnitude = 0.0f;
         if (pod.state == POD_EXTEND) {
-            float magnitude = FORCE_MAGNITUDE * vertexScale * ramp * vertexSpeedScale * dt;
-            applyPod(pod.angle, magnitude, false);
+            magnitude = FORCE_MAGNITUDE * vertexScale * ramp * vertexSpeedScale * dt;
         } else if (pod.state == POD_HOLD) {
-            float magnitude = FORCE_MAGNITUDE * vertexScale * HOLD_FORCE_SCALE * holdSpeedScale * dt;
-            applyPod(pod.angle, magnitude, false);
+            magnitude = FORCE_MAGNITUDE * vertexScale * HOLD_FORCE_SCALE * holdSpeedScale * dt;
         } else if (pod.state == POD_RETRACT) {
-            float magnitude = CONTRACTION_MAGNITUDE * vertexScale * RETRACT_FORCE_SCALE * ramp * vertexSpeedScale * dt;
-            applyPod(pod.angle, magnitude, true);
+            magnitude = -CONTRACTION_MAGNITUDE * vertexScale * RETRACT_FORCE_SCALE * ramp * vertexSpeedScale * dt;
+        }
+        if (magnitude == 0.0f) {
+            continue;
+        }
+        JPH::Vec3 localDir = invRot * JPH::Vec3(cosf(pod.angle), 0.0f, sinf(pod.angle));
+        pushes[pushCount++] = {localDir * magnitude, atan2f(localDir.GetZ(), localDir.GetX())};
+    }
+    if (pushCount == 0) {
+        return;
+    }
+
+    if (coarse) {
+        // Spread evenly over the membrane: the pods add up to one uniform impulse
+        JPH::Vec3 total = JPH::Vec3::sZero();
+        for (int p = 0; p < pushCount; p++) {
+            total += pushes[p].impulse;
+        }
+        math::apply_scaled(math::velocities_of(vertices), vertices.size(),
+                           math::from_jolt(total) * COARSE_FORCE_SCALE, nullptr);
+        return;
+    }
+
+    // One pass over the membrane for every pod: each vertex's radius and angle
+    // are computed once, and it takes the weighted sum of the pods whose arc it is in
+    for (auto& vertex : vertices) {
+        const JPH::Vec3& p = vertex.mPosition;
+        float radial = sqrtf(p.GetX() * p.GetX() + p.GetZ() * p.GetZ());
+        if (radial < minRadius) {
+            continue;
+        }
+        float radiusWeight = std::clamp((radial - minRadius) / denom, 0.0f, 1.0f);
+        float angleAt = atan2f(p.GetZ(), p.GetX());
+
+        JPH::Vec3 impulse = JPH::Vec3::sZero();
+        bool pushed = false;
+        for (int k = 0; k < pushCount; k++) {
+            float absDelta = fabsf(wrapAngle(angleAt - pushes[k].targetAngle));
+            if (absDelta > arc) {
+                continue;
+            }
+            float angleWeight = cosf((absDelta / arc) * (PI * 0.5f));
+            impulse += pushes[k].impulse * (angleWeight * radiusWeight * radiusWeight);
+            pushed = true;
+        }
+        if (pushed) {
+            vertex.mVelocity += impulse;
         }
     }
 }
@@ -48,6 +48,9 @@ private:
     static constexpr float RETRACT_DURATION = 2.2f;
     static constexpr float HOLD_FORCE_SCALE = 1.0f;
     static constexpr float RETRACT_FORCE_SCALE = 0.55f;
+    // Reduced fidelity: pod force spread evenly over the whole membrane.
+    // Roughly matches the net impulse of the per-vertex arc weighting.
+    static constexpr float COARSE_FORCE_SCALE = 0.1f;
 
     // System update function (called by FLECS)
     static void update(
@@ -56,7 +59,8 @@ private:
         components::ECMLocomotion& locomotion,
         components::Transform& transform,
         PhysicsSystemState* physics,
-        float dt
+        float dt,
+        bool coarse
     );
 
     static void stepCortex(components::ECMLocomotion& locomotion, float dt);
@@ -65,7 +69,8 @@ private:
         components::ECMLocomotion& locomotion,
         components::Microbe& microbe,
         PhysicsSystemState* physics,
-        float dt
+        float dt,
+        bool coarse
     );
 };
 
@@ -13,7 +13,7 @@ void InputSystem::registerSystem(flecs::world& world) {
         .run([](flecs::iter& it) {
             // Get or create InputState singleton
             auto input = it.world().get_mut<components::InputState>();
-            if (input) {
+            if (input && !input->injected) {
                 // Poll Raylib input and update FLECS component
                 input->mousePosition = GetMousePosition();
                 input->mouseDelta = GetMouseDelta();
@@ -0,0 +1,128 @@
+#include "KillerSystem.h"
+#include "src/components/Damage.h"
+#include "src/components/Killers.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/Upgrades.h"
+#include "src/systems/PhysicsSystem.h"
+#include "raylib.h"
+#include <algorithm>
+#include <cmath>
+
+namespace micro_idle {
+
+int KillerSystem::agentCount(const components::PlayerUpgrades& upgrades) {
+    return std::max(upgrades.killers, 0) * AgentsPerLevel;
+}
+
+void KillerSystem::setCount(components::KillerAgents& agents, int count) {
+    count = std::max(count, 0);
+    int old = agents.size();
+    agents.x.resize((size_t)count);
+    agents.z.resize((size_t)count);
+    agents.target.resize((size_t)count, 0);
+    agents.assigned.resize((size_t)count, -1);
+
+    // Golden-angle spiral: evenly spread however many are added
+    for (int i = old; i < count; i++) {
+        float r = 0.5f * std::sqrt((float)i);
+        float angle = (float)i * 2.3999632f;
+        agents.x[(size_t)i] = r * std::cos(angle);
+        agents.z[(size_t)i] = r * std::sin(angle);
+    }
+}
+
+int KillerSystem::retarget(components::KillerAgents& agents, const components::MicrobeIndex& index,
+                           JPH::JobSystem* jobs) {
+    int count = agents.size();
+    agents.assigned.assign((size_t)count, -1);
+    agents.target.assign((size_t)count, 0);
+    if (count == 0 || index.size() == 0) {
+        agents.targets.clear();
+        return 0;
+    }
+
+    // Bigger microbes score higher for bestInRadius callers
+    agents.targets.build(index.x.data(), index.z.data(), index.radius.data(), index.size(),
+                         index.grid.getCellSize(), jobs);
+    int assigned = agents.targets.assignTargets(agents.x.data(), agents.z.data(), count, Candidates, 0.0f, 1,
+                                                agents.assigned.data(), jobs);
+    for (int a = 0; a < count; a++) {
+        int slot = agents.assigned[(size_t)a];
+        if (slot >= 0) {
+            agents.target[(size_t)a] = index.entities[(size_t)slot];
+        }
+    }
+    return assigned;
+}
+
+int KillerSystem::step(components::KillerAgents& agents, const components::MicrobeIndex& index, float dt,
+                       components::DamageBuffer& buffer) {
+    int hits = 0;
+    float stride = Speed * dt;
+    for (int a = 0; a < agents.size(); a++) {
+        int slot = agents.assigned[(size_t)a];
+        if (slot < 0 || slot >= index.size()) {
+            continue;
+        }
+        float dx = index.x[(size_t)slot] - agents.x[(size_t)a];
+        float dz = index.z[(size_t)slot] - agents.z[(size_t)a];
+        float dist = std::sqrt(dx * dx + dz * dz);
+        float contact = index.radius[(size_t)slot] + Reach;
+        if (dist <= contact) {
+            buffer.add(index.entities[(size_t)slot], DamagePerSecond * dt, components::DamageSource::Effect);
+            hits++;
+            continue;
+        }
+        // Stop at the footprint's edge instead of running into the microbe
+        float move = std::min(stride, dist - index.radius[(size_t)slot]) / dist;
+        agents.x[(size_t)a] += dx * move;
+        agents.z[(size_t)a] += dz * move;
+    }
+    return hits;
+}
+
+void KillerSystem::registerSystem(flecs::world& world, PhysicsSystemState* physics) {
+    world.system("KillerSystem")
+        .kind(flecs::OnUpdate)
+        .run([physics](flecs::iter& it) {
+            flecs::world w = it.world();
+            auto agents = w.get_mut<components::KillerAgents>();
+            if (!agents) {
+                return;
+            }
+            auto upgrades = w.get<components::PlayerUpgrades>();
+            int wanted = upgrades ? agentCount(*upgrades) : 0;
+            if (agents->size() != wanted) {
+                setCount(*agents, wanted);
+            }
+            if (agents->size() == 0) {
+                return;
+            }
+
+            auto index = w.get<components::MicrobeIndex>();
+            auto buffer = w.get_mut<components::DamageBuffer>();
+            if (!index || !buffer) {
+                return;
+            }
+            retarget(*agents, *index, physics ? physics->jobSystem : nullptr);
+            step(*agents, *index, it.delta_time(), *buffer);
+        });
+}
+
+void KillerSystem::registerRenderSystem(flecs::world& world) {
+    world.system("KillerRender")
+        .kind(flecs::PostUpdate)
+        .run([](flecs::iter& it) {
+            auto agents = it.world().get<components::KillerAgents>();
+            if (!agents) {
+                return;
+            }
+            const Color color = {255, 120, 200, 220};
+            for (int a = 0; a < agents->size(); a++) {
+                DrawCircle3D({agents->x[(size_t)a], 0.22f, agents->z[(size_t)a]}, 0.08f,
+                             {1.0f, 0.0f, 0.0f}, 90.0f, color);
+            }
+        });
+}
+
+} // namespace micro_idle
@@ -0,0 +1,67 @@
+#ifndef MICRO_IDLE_KILLER_SYSTEM_H
+#define MICRO_IDLE_KILLER_SYSTEM_H
+
+#include <flecs.h>
+
+namespace JPH {
+class JobSystem;
+}
+
+namespace components {
+struct DamageBuffer;
+struct KillerAgents;
+struct MicrobeIndex;
+struct PlayerUpgrades;
+}
+
+namespace micro_idle {
+
+struct PhysicsSystemState;
+
+// KillerSystem - autonomous killer agents (README: "Idle / Automation")
+// Every tick each agent retargets through a TargetIndex over the MicrobeIndex,
+// moves towards its microbe and queues contact damage into the DamageBuffer.
+// Step runs in OnUpdate phase (before DestructionSystem applies the buffer),
+// draw in PostUpdate.
+class KillerSystem {
+public:
+    static constexpr int AgentsPerLevel = 4;
+    static constexpr float Speed = 1.5f;                // Dish units per second
+    static constexpr float Reach = 0.05f;               // Contact distance past a microbe's footprint
+    static constexpr float DamagePerSecond = 30.0f;
+    static constexpr int Candidates = 4;                // Nearest microbes each agent considers
+
+    // Batched queries are spread over the physics job system between physics steps
+    static void registerSystem(flecs::world& world, PhysicsSystemState* physics);
+
+    static void registerRenderSystem(flecs::world& world);
+
+    // Agents bought with the killer upgrade
+    static int agentCount(const components::PlayerUpgrades& upgrades);
+
+    // Grow or shrink to `count` agents; new ones start on a spiral around the dish centre
+    static void setCount(components::KillerAgents& agents, int count);
+
+    /**
+     * Rebuild the target index from the microbes and give every agent one of
+     * its nearest microbes that no other agent has claimed
+     *
+     * @param jobs Job system for the index build and batched queries (null runs inline)
+     * @return Number of agents with a target
+     */
+    static int retarget(components::KillerAgents& agents, const components::MicrobeIndex& index,
+                        JPH::JobSystem* jobs);
+
+    /**
+     * Move every agent towards its target and queue damage for those in contact
+     * (targets from the last retarget(), against the same index)
+     *
+     * @return Number of hits queued
+     */
+    static int step(components::KillerAgents& agents, const components::MicrobeIndex& index, float dt,
+                    components::DamageBuffer& buffer);
+};
+
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,205 @@
+#include "MembraneContactSystem.h"
+#include "src/components/Adhesion.h"
+#include "src/components/Microbe.h"
+#include "src/physics/AdhesionGraph.h"
+#include "src/physics/MembraneContacts.h"
+#include "src/systems/PhysicsSystem.h"
+#include <vector>
+#include <Jolt/Physics/SoftBody/SoftBodyMotionProperties.h>
+
+namespace micro_idle {
+
+namespace {
+
+static_assert(Layers::NUM_LAYERS <= (JPH::uint)MembraneContacts::MaxLayers,
+              "MembraneContacts layer table is too small for the object layers");
+
+// Bodies gathered this step, and buffers reused between them
+struct GatherScratch {
+    std::vector<JPH::BodyID> bodies;
+    std::vector<uint64_t> entities;
+    std::vector<uint8_t> adhesive;
+    std::vector<float> mobility;
+    std::vector<int> firstVertex;
+    std::vector<int> vertexCount;
+    std::vector<int> adhesionFirst;     // -1 = not in the adhesion graph
+    std::vector<Vector3> positions;
+    std::vector<Vector3> normals;
+    std::vector<JPH::Vec3> localNormals;
+};
+
+void gatherMembrane(PhysicsSystemState* physics, JPH::BodyID bodyID, uint64_t entity, bool adhesive,
+                    MembraneContacts& contacts, GatherScratch& scratch) {
+    JPH::BodyLockRead lock(physics->physicsSystem->GetBodyLockInterface(), bodyID);
+    if (!lock.Succeeded()) {
+        return;
+    }
+    const JPH::Body& body = lock.GetBody();
+    if (!body.IsSoftBody()) {
+        return;
+    }
+    const JPH::SoftBodyMotionProperties* motionProps =
+        static_cast<const JPH::SoftBodyMotionProperties*>(body.GetMotionProperties());
+    const JPH::Array<JPH::SoftBodyVertex>& vertices = motionProps->GetVertices();
+    if (vertices.empty()) {
+        return;
+    }
+
+    // Area-weighted vertex normals from the faces, in body space
+    size_t n = vertices.size();
+    scratch.localNormals.assign(n, JPH::Vec3::sZero());
+    for (const JPH::SoftBodySharedSettings::Face& face : motionProps->GetFaces()) {
+        JPH::Vec3 a = vertices[face.mVertex[0]].mPosition;
+        JPH::Vec3 b = vertices[face.mVertex[1]].mPosition;
+        JPH::Vec3 c = vertices[face.mVertex[2]].mPosition;
+        JPH::Vec3 faceNormal = (b - a).Cross(c - a);
+        for (int k = 0; k < 3; k++) {
+            scratch.localNormals[face.mVertex[k]] += faceNormal;
+        }
+    }
+
+    // Winding is not guaranteed outward; the body-space origin is the center of mass
+    JPH::RMat44 com = body.GetCenterOfMassTransform();
+    scratch.positions.resize(n);
+    scratch.normals.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        JPH::Vec3 local = vertices[i].mPosition;
+        JPH::Vec3 normal = scratch.localNormals[i];
+        if (normal.Dot(local) < 0.0f) {
+            normal = -normal;
+        }
+        JPH::RVec3 world = com * local;
+        JPH::Vec3 worldNormal = com.Multiply3x3(normal);
+        scratch.positions[i] = {(float)world.GetX(), (float)world.GetY(), (float)world.GetZ()};
+        scratch.normals[i] = {worldNormal.GetX(), worldNormal.GetY(), worldNormal.GetZ()};
+    }
+
+    // Sleeping membranes hold still; the awake side takes the whole push
+    float mobility = body.IsActive() ? 1.0f : 0.0f;
+    scratch.bodies.push_back(bodyID);
+    scratch.entities.push_back(entity);
+    scratch.adhesive.push_back(adhesive ? 1 : 0);
+    scratch.mobility.push_back(mobility);
+    scratch.vertexCount.push_back((int)n);
+    scratch.firstVertex.push_back(contacts.addMembrane((int)body.GetObjectLayer(), mobility,
+                                                       scratch.positions.data(), scratch.normals.data(),
+                                                       (int)n));
+}
+
+// Bonds between adhesive membranes, fed by this step's contact events
+void solveAdhesion(float dt, PhysicsSystemState* physics, const MembraneContacts& contacts,
+                   AdhesionGraph& adhesion, GatherScratch& scratch) {
+    size_t membranes = scratch.bodies.size();
+    scratch.adhesionFirst.assign(membranes, -1);
+    adhesion.beginStep();
+    for (size_t m = 0; m < membranes; m++) {
+        if (!scratch.adhesive[m]) {
+            continue;
+        }
+        int first = scratch.firstVertex[m];
+        int n = scratch.vertexCount[m];
+        scratch.positions.resize((size_t)n);
+        for (int i = 0; i < n; i++) {
+            scratch.positions[(size_t)i] = contacts.getPosition(first + i);
+        }
+        scratch.adhesionFirst[m] = adhesion.addMembrane(scratch.entities[m], scratch.mobility[m],
+                                                        scratch.positions.data(), n);
+    }
+
+    for (size_t m = 0; m < membranes; m++) {
+        if (!scratch.adhesive[m]) {
+            continue;
+        }
+        for (int i = 0; i < scratch.vertexCount[m]; i++) {
+            int partner = contacts.getContact(scratch.firstVertex[m] + i);
+            if (partner < 0) {
+                continue;
+            }
+            size_t other = (size_t)contacts.getMembraneOf(partner);
+            if (scratch.adhesive[other]) {
+                adhesion.requestBond(scratch.entities[m], i, scratch.entities[other],
+                                     partner - scratch.firstVertex[other]);
+            }
+        }
+    }
+    adhesion.solve(dt, physics->jobSystem);
+}
+
+void applyCorrections(PhysicsSystemState* physics, JPH::BodyID bodyID, int firstVertex,
+                      const MembraneContacts& contacts, const AdhesionGraph* adhesion, int adhesionFirst) {
+    JPH::BodyLockWrite lock(physics->physicsSystem->GetBodyLockInterface(), bodyID);
+    if (!lock.Succeeded()) {
+        return;
+    }
+    JPH::Body& body = lock.GetBody();
+    JPH::SoftBodyMotionProperties* motionProps =
+        static_cast<JPH::SoftBodyMotionProperties*>(body.GetMotionProperties());
+    JPH::Array<JPH::SoftBodyVertex>& vertices = motionProps->GetVertices();
+    JPH::Quat invRot = body.GetRotation().Conjugated();
+
+    for (size_t i = 0; i < vertices.size(); i++) {
+        JPH::SoftBodyVertex& vertex = vertices[i];
+        Vector3 d = contacts.getDisplacement(firstVertex + (int)i);
+        if (adhesion && adhesionFirst >= 0) {
+            Vector3 bond = adhesion->getDisplacement(adhesionFirst + (int)i);
+            d = {d.x + bond.x, d.y + bond.y, d.z + bond.z};
+        }
+        if ((d.x == 0.0f && d.y == 0.0f && d.z == 0.0f) || vertex.mInvMass == 0.0f) {
+            continue;
+        }
+        JPH::Vec3 delta = invRot * JPH::Vec3(d.x, d.y, d.z);
+        vertex.mPosition += delta;
+
+        // Drop the velocity that drove the vertex in, or the next step repeats it
+        JPH::Vec3 dir = delta.NormalizedOr(JPH::Vec3::sZero());
+        float approach = vertex.mVelocity.Dot(dir);
+        if (approach < 0.0f) {
+            vertex.mVelocity -= approach * dir;
+        }
+    }
+}
+
+} // namespace
+
+int MembraneContactSystem::resolve(flecs::world& world, MembraneContacts& contacts, PhysicsSystemState* physics,
+                                   float dt, AdhesionGraph* adhesion) {
+    GatherScratch scratch;
+    contacts.clear();
+
+    world.each([&](flecs::entity e, const components::Microbe& microbe) {
+        if (microbe.plan == components::BodyPlanKind::SoftMembrane && !microbe.softBody.bodyID.IsInvalid()) {
+            gatherMembrane(physics, microbe.softBody.bodyID, e.id(), e.has<components::Adhesive>(),
+                           contacts, scratch);
+        }
+    });
+
+    int pushed = contacts.solve(physics->jobSystem);
+    bool bonds = false;
+    if (adhesion) {
+        solveAdhesion(dt, physics, contacts, *adhesion, scratch);
+        bonds = adhesion->getBondCount() > 0;
+    }
+    if (pushed == 0 && !bonds) {
+        return 0;
+    }
+    for (size_t m = 0; m < scratch.bodies.size(); m++) {
+        int adhesionFirst = adhesion ? scratch.adhesionFirst[m] : -1;
+        applyCorrections(physics, scratch.bodies[m], scratch.firstVertex[m], contacts, adhesion, adhesionFirst);
+    }
+    return pushed;
+}
+
+void MembraneContactSystem::registerSystem(flecs::world& world, MembraneContacts* contacts,
+                                           AdhesionGraph* adhesion, PhysicsSystemState* physics) {
+    world.system("MembraneContactSystem")
+        .kind(flecs::OnUpdate)
+        .run([contacts, adhesion, physics](flecs::iter& it) {
+            if (!contacts || !physics) {
+                return;
+            }
+            flecs::world w = it.world();
+            resolve(w, *contacts, physics, it.delta_time(), adhesion);
+        });
+}
+
+} // namespace micro_idle
@@ -0,0 +1,33 @@
+#ifndef MICRO_IDLE_MEMBRANE_CONTACT_SYSTEM_H
+#define MICRO_IDLE_MEMBRANE_CONTACT_SYSTEM_H
+
+#include <flecs.h>
+
+namespace micro_idle {
+
+class MembraneContacts;
+class AdhesionGraph;
+struct PhysicsSystemState;
+
+// Membrane contact system - keeps soft membranes from passing through each other
+// and bonds adhesive ones where they touch
+// Runs first in the OnUpdate phase, straight after the Jolt step
+class MembraneContactSystem {
+public:
+    static void registerSystem(flecs::world& world, MembraneContacts* contacts, AdhesionGraph* adhesion,
+                               PhysicsSystemState* physics);
+
+    /**
+     * Gather every soft membrane's vertices, resolve soft-soft penetrations,
+     * bond and solve Adhesive membranes (when `adhesion` is set) and write the
+     * corrections back into the Jolt soft bodies
+     *
+     * @return Number of vertices that were pushed by contacts
+     */
+    static int resolve(flecs::world& world, MembraneContacts& contacts, PhysicsSystemState* physics,
+                       float dt = 0.0f, AdhesionGraph* adhesion = nullptr);
+};
+
+} // namespace micro_idle
+
+#endif
@@ -0,0 +1,56 @@
+#include "MicrobeIndexSystem.h"
+#include "src/components/Microbe.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/Transform.h"
+#include "src/components/WorldState.h"
+#include "src/systems/BodyPlanFactory.h"
+#include <algorithm>
+
+namespace micro_idle {
+
+float MicrobeIndexSystem::footprintRadius(const components::Microbe& microbe) {
+    if (BodyPlanFactory::IsRigid(microbe.plan)) {
+        return microbe.stats.baseRadius * BodyPlanFactory::GetPlan(microbe.type).reach;
+    }
+    // Soft bodies flatten and stretch pseudopods past their rest radius
+    return microbe.stats.baseRadius * 1.6f;
+}
+
+void MicrobeIndexSystem::registerSystem(flecs::world& world) {
+    auto microbes = world.query<const components::Microbe, const components::Transform>();
+
+    world.system("MicrobeIndexSystem")
+        .kind(flecs::OnStore)
+        .run([microbes](flecs::iter& it) {
+            auto index = it.world().get_mut<components::MicrobeIndex>();
+            if (!index) {
+                return;
+            }
+
+            index->entities.clear();
+            index->x.clear();
+            index->z.clear();
+            index->radius.clear();
+
+            float maxRadius = 0.0f;
+            microbes.each([&](flecs::entity e, const components::Microbe& microbe, const components::Transform& transform) {
+                float r = footprintRadius(microbe);
+                index->entities.push_back(e.id());
+                index->x.push_back(transform.position.x);
+                index->z.push_back(transform.position.z);
+                index->radius.push_back(r);
+                maxRadius = std::max(maxRadius, r);
+            });
+
+            auto worldState = it.world().get<components::WorldState>();
+            float halfW = (worldState ? worldState->worldWidth : 50.0f) * 0.5f;
+            float halfH = (worldState ? worldState->worldHeight : 50.0f) * 0.5f;
+
+            // Cells about one footprint across keep per-cell lists short
+            float cellSize = std::max(maxRadius * 2.0f, 0.25f);
+            index->grid.build(index->x.data(), index->z.data(), index->radius.data(), index->size(),
+                              cellSize, -halfW, -halfH, halfW, halfH);
+        });
+}
+
+} // namespace micro_idle
@@ -0,0 +1,26 @@
+#ifndef MICRO_IDLE_MICROBE_INDEX_SYSTEM_H
+#define MICRO_IDLE_MICROBE_INDEX_SYSTEM_H
+
+#include <flecs.h>
+
+namespace components {
+struct Microbe;
+}
+
+namespace micro_idle {
+
+// Microbe index system - rebuilds the MicrobeIndex singleton (positions, radii,
+// spatial grid) from the synced transforms
+// Runs in OnStore phase (after TransformSyncSystem)
+class MicrobeIndexSystem {
+public:
+    static void registerSystem(flecs::world& world);
+
+    // Footprint radius used for a microbe: its body plan's reach, with slack
+    // for soft membranes that flatten and stretch pseudopods
+    static float footprintRadius(const components::Microbe& microbe);
+};
+
+} // namespace micro_idle
+
+#endif
@@ -1,19 +1,8 @@
 #include "PhysicsSystem.h"
-
-// Jolt uses callbacks for trace and asserts
-static void TraceImpl(const char* inFMT, ...) {
-    (void)inFMT;
-}
-
-#ifdef JPH_ENABLE_ASSERTS
-static bool AssertFailedImpl(const char* inExpression, const char* inMessage, const char* inFile, JPH::uint inLine) {
-    (void)inExpression;
-    (void)inMessage;
-    (void)inFile;
-    (void)inLine;
-    return true; // Trigger breakpoint
-}
-#endif
+#include "src/physics/BodyPool.h"
+#include "src/physics/PhysicsRuntime.h"
+#include <algorithm>
+#include <cmath>
 
 namespace micro_idle {
 
@@ -79,32 +68,27 @@ bool ObjectLayerPairFilterImpl::ShouldCollide(JPH::ObjectLayer inObject1, JPH::O
 }
 
 // PhysicsSystemState implementation
-PhysicsSystemState::PhysicsSystemState() {
-    // Register allocation hook
-    JPH::RegisterDefaultAllocator();
+PhysicsSystemState::PhysicsSystemState(size_t tempAllocatorBytes) {
+    // Allocator hooks, callbacks and type registration happen once per process
+    PhysicsRuntime::ensureInitialized();
 
-    // Install callbacks
-    JPH::Trace = TraceImpl;
-#ifdef JPH_ENABLE_ASSERTS
-    JPH::AssertFailed = AssertFailedImpl;
-#endif
+    // Per-world scratch (worlds step concurrently and TempAllocatorImpl is not
+    // thread-safe), taken from the shared pool when the world first steps
+    this->tempAllocatorBytes = tempAllocatorBytes;
 
-    // Register all Jolt physics types
-    JPH::Factory::sInstance = new JPH::Factory();
-    JPH::RegisterTypes();
-
-    // Create temp allocator (need enough for long simulations)
-    tempAllocator = new JPH::TempAllocatorImpl(100 * 1024 * 1024); // 100 MB
-
-    // Create job system (use all cores)
-    jobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, std::thread::hardware_concurrency() - 1);
+    // Worker threads are shared by every world
+    jobSystem = PhysicsRuntime::jobSystem();
 
     // Create layer interfaces
     bpLayerInterface = new BPLayerInterfaceImpl();
     objectVsBroadPhaseFilter = new ObjectVsBroadPhaseLayerFilterImpl();
     objectLayerPairFilter = new ObjectLayerPairFilterImpl();
 
-    // Create physics system
+    // Create physics system. Jolt fixes these capacities at Init and cannot grow
+    // them later (body ids index a table sized here), so they cover a full dish
+    // rather than starting small. The body table, broad phase nodes and contact
+    // caches are mostly untouched virtual memory until bodies arrive; the part
+    // Init writes is the contact caches' hash buckets, well under a megabyte.
     const JPH::uint cMaxBodies = 10240;
     const JPH::uint cNumBodyMutexes = 0; // Auto-detect
     const JPH::uint cMaxBodyPairs = 65536;
@@ -124,23 +108,29 @@ PhysicsSystemState::PhysicsSystemState() {
     // Enable gravity so microbes fall back to petri dish (Y=0) if they get picked up or spawned high
     physicsSystem->SetGravity(JPH::Vec3(0, -9.81f, 0));
 
+    bodyPool = new BodyPool();
+
 }
 
 PhysicsSystemState::~PhysicsSystemState() {
+    bodyPool->clear(physicsSystem->GetBodyInterface());
+    delete bodyPool;
     delete physicsSystem;
     delete objectLayerPairFilter;
     delete objectVsBroadPhaseFilter;
     delete bpLayerInterface;
-    delete jobSystem;
-    delete tempAllocator;
-    delete JPH::Factory::sInstance;
-    JPH::Factory::sInstance = nullptr;
+    PhysicsRuntime::releaseTempAllocator(tempAllocator, tempAllocatorBytes);
 }
 
 void PhysicsSystemState::update(float dt) {
-    // Step the physics simulation
-    const int cCollisionSteps = 1;
-    physicsSystem->Update(dt, cCollisionSteps, tempAllocator, jobSystem);
+    // Step the physics simulation. Long ticks (background mode) are split so
+    // each collision step stays within what the soft bodies tolerate.
+    const float cMaxStepDt = 1.0f / 30.0f;
+    int collisionSteps = std::max(1, (int)ceilf(dt / cMaxStepDt - 0.001f));
+    if (!tempAllocator) {
+        tempAllocator = PhysicsRuntime::acquireTempAllocator(tempAllocatorBytes);
+    }
+    physicsSystem->Update(dt, collisionSteps, tempAllocator, jobSystem);
 }
 
 JPH::BodyID PhysicsSystemState::createSphere(JPH::Vec3 position, float radius, bool isStatic) {
@@ -1,6 +1,7 @@
 #ifndef MICRO_IDLE_PHYSICS_SYSTEM_H
 #define MICRO_IDLE_PHYSICS_SYSTEM_H
 
+#include <cstddef>
 #include <Jolt/Jolt.h>
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
@@ -16,6 +17,8 @@
 
 namespace micro_idle {
 
+class BodyPool;
+
 // Object layers for collision filtering
 namespace Layers {
     static constexpr JPH::ObjectLayer NON_MOVING = 0;
@@ -61,16 +64,22 @@ public:
     virtual bool ShouldCollide(JPH::ObjectLayer inObject1, JPH::ObjectLayer inObject2) const override;
 };
 
-// PhysicsSystem singleton - manages Jolt physics world
+// PhysicsSystem state - one Jolt physics world per World. Global Jolt setup and
+// the worker pool live in PhysicsRuntime and are shared, so any number of
+// these can exist (and step on different threads) at once.
 struct PhysicsSystemState {
-    JPH::TempAllocatorImpl* tempAllocator;
-    JPH::JobSystemThreadPool* jobSystem;
+    static constexpr size_t DefaultTempAllocatorBytes = 100 * 1024 * 1024; // Enough for long simulations
+
+    JPH::TempAllocatorImpl* tempAllocator{nullptr};  // Pooled; taken on the first update()
+    size_t tempAllocatorBytes;
+    JPH::JobSystemThreadPool* jobSystem;   // Shared, not owned
     BPLayerInterfaceImpl* bpLayerInterface;
     ObjectVsBroadPhaseLayerFilterImpl* objectVsBroadPhaseFilter;
     ObjectLayerPairFilterImpl* objectLayerPairFilter;
     JPH::PhysicsSystem* physicsSystem;
+    BodyPool* bodyPool;                    // Removed soft bodies kept for reuse (see SoftBodyFactory)
 
-    PhysicsSystemState();
+    explicit PhysicsSystemState(size_t tempAllocatorBytes = DefaultTempAllocatorBytes);
     ~PhysicsSystemState();
 
     void update(float dt);
@@ -0,0 +1,62 @@
+#include "RenderPacketSystem.h"
+#include "src/components/Microbe.h"
+#include "src/components/Transform.h"
+#include "src/components/Rendering.h"
+#include "src/components/RenderPacket.h"
+
+namespace micro_idle {
+
+void RenderPacketSystem::registerSystem(flecs::world& world) {
+    auto microbes = world.query<const components::Microbe, const components::Transform,
+                                const components::SDFRenderComponent*>();
+
+    world.system("RenderPacketSystem")
+        .kind(flecs::OnStore)
+        .run([microbes](flecs::iter& it) {
+            auto packets = it.world().get_mut<components::RenderPackets>();
+            if (!packets) {
+                return;
+            }
+
+            packets->packets.clear();
+            microbes.each([&](flecs::entity e, const components::Microbe& microbe,
+                              const components::Transform& transform,
+                              const components::SDFRenderComponent* sdf) {
+                components::RenderPacket packet;
+                packet.entity = e.id();
+                packet.position = transform.position;
+                packet.radius = microbe.stats.baseRadius;
+                packet.rotation = transform.rotation;
+                packet.color = microbe.stats.color;
+                packet.type = (int32_t)microbe.type;
+                packet.plan = (int32_t)microbe.plan;
+                packet.vertexCount = sdf ? sdf->vertexCount : 0;
+                packets->packets.push_back(packet);
+            });
+        });
+}
+
+int RenderPacketSystem::snapshot(flecs::world& world, const MicrobeSnapshot& out, int capacity) {
+    int count = 0;
+    world.query<const components::Microbe, const components::Transform,
+                const components::SDFRenderComponent*>()
+        .each([&](flecs::entity e, const components::Microbe& microbe,
+                  const components::Transform& transform,
+                  const components::SDFRenderComponent* sdf) {
+            int i = count++;
+            if (i >= capacity) {
+                return;
+            }
+            if (out.entity) out.entity[i] = e.id();
+            if (out.type) out.type[i] = (int32_t)microbe.type;
+            if (out.x) out.x[i] = transform.position.x;
+            if (out.y) out.y[i] = transform.position.y;
+            if (out.z) out.z[i] = transform.position.z;
+            if (out.radius) out.radius[i] = microbe.stats.baseRadius;
+            if (out.health) out.health[i] = microbe.stats.health;
+            if (out.vertexCount) out.vertexCount[i] = sdf ? sdf->vertexCount : 0;
+        });
+    return count;
+}
+
+} // namespace micro_idle
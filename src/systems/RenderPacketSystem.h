@@ -0,0 +1,38 @@
+#ifndef MICRO_IDLE_RENDER_PACKET_SYSTEM_H
+#define MICRO_IDLE_RENDER_PACKET_SYSTEM_H
+
+#include <flecs.h>
+#include <cstdint>
+
+namespace micro_idle {
+
+// Caller-owned SoA arrays for a microbe snapshot; any array may be null to skip it
+struct MicrobeSnapshot {
+    uint64_t* entity{nullptr};
+    int32_t* type{nullptr};
+    float* x{nullptr};
+    float* y{nullptr};
+    float* z{nullptr};
+    float* radius{nullptr};
+    float* health{nullptr};
+    int32_t* vertexCount{nullptr};
+};
+
+// Render packet system - rebuilds the RenderPackets singleton from the synced
+// transforms and extracted SDF sample points
+// Runs in OnStore phase (after UpdateSDFUniforms)
+class RenderPacketSystem {
+public:
+    static void registerSystem(flecs::world& world);
+
+    /**
+     * Fill `out` with up to `capacity` microbes in one pass over the ECS.
+     *
+     * @return Total number of microbes, which may exceed `capacity`
+     */
+    static int snapshot(flecs::world& world, const MicrobeSnapshot& out, int capacity);
+};
+
+} // namespace micro_idle
+
+#endif
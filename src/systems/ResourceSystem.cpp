@@ -1,137 +1,285 @@
 #include "ResourceSystem.h"
 #include "src/components/Resource.h"
-#include "src/components/Transform.h"
 #include "src/components/Input.h"
+#include "src/components/Upgrades.h"
+#include "src/math/Simd.h"
+#include "src/rendering/InstancedBillboards.h"
+#include "src/rendering/SDFShader.h"
 #include "raylib.h"
-#include <cstdio>
+#include <cmath>
 
 namespace micro_idle {
 
-flecs::entity ResourceSystem::spawnResource(flecs::world& world,
-                                            components::ResourceType type,
-                                            float amount,
-                                            Vector3 position) {
-    auto entity = world.entity();
-
-    // Set resource component
-    components::Resource resource;
-    resource.type = type;
-    resource.amount = amount;
-    resource.lifetime = 10.0f;  // 10 seconds default lifetime
-    resource.maxLifetime = resource.lifetime;
-    resource.isCollected = false;
-
-    // Set color based on resource type
-    switch (type) {
-        case components::ResourceType::Sodium:
-            resource.color = YELLOW;
-            break;
-        case components::ResourceType::Glucose:
-            resource.color = GREEN;
-            break;
-        case components::ResourceType::Iron:
-            resource.color = GRAY;
-            break;
-        case components::ResourceType::Calcium:
-            resource.color = WHITE;
-            break;
-        case components::ResourceType::Lipids:
-            resource.color = ORANGE;
-            break;
-        case components::ResourceType::Oxygen:
-            resource.color = BLUE;
-            break;
-        case components::ResourceType::SignalingMolecules:
-            resource.color = PURPLE;
-            break;
+namespace {
+
+using math::Float8;
+using math::Mask8;
+
+enum DropStream {
+    DropStreamX = 0,
+    DropStreamZ = 1,
+    DropStreamLife = 2,
+    DropFloatStreams = 3
+};
+
+constexpr float FarAway = 1e9f;            // Padding lane position
+constexpr float CollectedLife = -1e30f;    // Marks a drop collected this step
+constexpr float Drag = 4.0f;               // Velocity decay rate (1/s)
+
+// Flat on the floor box, just above the ambient swarm
+constexpr float DropFloorHeight = 0.23f;
+constexpr float DropRadius = 0.12f;
+constexpr float FadeTime = 3.0f;
+
+int paddedSize(int n) {
+    return (n + 7) & ~7;
+}
+
+void resize(components::ResourceDrops& drops, int count) {
+    size_t padded = (size_t)paddedSize(count);
+    drops.x.resize(padded);
+    drops.z.resize(padded);
+    drops.vx.resize(padded);
+    drops.vz.resize(padded);
+    drops.life.resize(padded);
+    drops.amount.resize(padded);
+    drops.type.resize(padded);
+
+    for (size_t i = (size_t)count; i < padded; i++) {
+        drops.x[i] = FarAway;
+        drops.z[i] = FarAway;
+        drops.vx[i] = 0.0f;
+        drops.vz[i] = 0.0f;
+        drops.life[i] = 0.0f;
+        drops.amount[i] = 0.0f;
+        drops.type[i] = 0;
     }
+    drops.count = count;
+}
 
-    entity.set<components::Resource>(resource);
+// Swap-remove every drop whose life ran out, crediting collected ones.
+// Returns how many were removed; `collected` counts the credited ones.
+int compact(components::ResourceDrops& drops, components::ResourceInventory* inventory, int& collected) {
+    int removed = 0;
+    collected = 0;
+    int i = 0;
+    int n = drops.count;
+    while (i < n) {
+        if (drops.life[(size_t)i] > 0.0f) {
+            i++;
+            continue;
+        }
+        if (inventory && drops.life[(size_t)i] == CollectedLife) {
+            inventory->add((components::ResourceType)drops.type[(size_t)i], drops.amount[(size_t)i]);
+            collected++;
+        }
 
-    // Set transform
-    entity.set<components::Transform>({
-        .position = position,
-        .rotation = {0.0f, 0.0f, 0.0f, 1.0f},
-        .scale = {1.0f, 1.0f, 1.0f}
-    });
+        size_t at = (size_t)i;
+        size_t last = (size_t)(n - 1);
+        drops.x[at] = drops.x[last];
+        drops.z[at] = drops.z[last];
+        drops.vx[at] = drops.vx[last];
+        drops.vz[at] = drops.vz[last];
+        drops.life[at] = drops.life[last];
+        drops.amount[at] = drops.amount[last];
+        drops.type[at] = drops.type[last];
+        n--;
+        removed++;
+    }
+    resize(drops, n);
+    return removed;
+}
 
-    return entity;
+} // namespace
+
+Color ResourceSystem::colorFor(components::ResourceType type) {
+    switch (type) {
+        case components::ResourceType::Sodium: return YELLOW;
+        case components::ResourceType::Glucose: return GREEN;
+        case components::ResourceType::Iron: return GRAY;
+        case components::ResourceType::Calcium: return WHITE;
+        case components::ResourceType::Lipids: return ORANGE;
+        case components::ResourceType::Oxygen: return BLUE;
+        case components::ResourceType::SignalingMolecules: return PURPLE;
+    }
+    return WHITE;
 }
 
-void ResourceSystem::collectResource(flecs::entity resourceEntity, flecs::world& world) {
-    auto resource = resourceEntity.get_mut<components::Resource>();
-    if (!resource || resource->isCollected) {
-        return;
+float ResourceSystem::attractionRadius(const components::PlayerUpgrades& upgrades) {
+    if (upgrades.pickupAttraction <= 0) {
+        return 0.0f;
     }
+    return 1.5f + 0.75f * (float)(upgrades.pickupAttraction - 1);
+}
+
+void ResourceSystem::addDrop(components::ResourceDrops& drops, components::ResourceType type,
+                             float amount, float x, float z) {
+    int i = drops.count;
+    resize(drops, i + 1);
+    drops.x[(size_t)i] = x;
+    drops.z[(size_t)i] = z;
+    drops.life[(size_t)i] = components::ResourceDrops::Lifetime;
+    drops.amount[(size_t)i] = amount;
+    drops.type[(size_t)i] = (uint8_t)type;
+}
 
-    // Get or create resource inventory singleton
-    auto inventory = world.get_mut<components::ResourceInventory>();
-    if (!inventory) {
-        world.set<components::ResourceInventory>({});
-        inventory = world.get_mut<components::ResourceInventory>();
+void ResourceSystem::spawnResource(flecs::world& world,
+                                   components::ResourceType type,
+                                   float amount,
+                                   Vector3 position) {
+    auto drops = world.get_mut<components::ResourceDrops>();
+    if (!drops) {
+        world.set<components::ResourceDrops>({});
+        drops = world.get_mut<components::ResourceDrops>();
     }
+    addDrop(*drops, type, amount, position.x, position.z);
+}
+
+int ResourceSystem::step(components::ResourceDrops& drops, float dt, const PickupParams& pickup,
+                         components::ResourceInventory& inventory) {
+    if (drops.count == 0) {
+        return 0;
+    }
+
+    // An invalid cursor touches and pulls nothing
+    float contact = pickup.cursorValid ? pickup.contactRadius : 0.0f;
+    float attract = pickup.cursorValid ? pickup.attractRadius : 0.0f;
+
+    const Float8 cx = Float8::broadcast(pickup.cursorX);
+    const Float8 cz = Float8::broadcast(pickup.cursorZ);
+    const Float8 contact2 = Float8::broadcast(contact * contact);
+    const Float8 attract2 = Float8::broadcast(attract * attract);
+    const Float8 pullDt = Float8::broadcast(pickup.pull * dt);
+    const Float8 drag = Float8::broadcast(std::exp(-Drag * dt));
+    const Float8 dtv = Float8::broadcast(dt);
+    const Float8 tiny = Float8::broadcast(1e-8f);
+    const Float8 zero = Float8::zero();
+    const Float8 collected = Float8::broadcast(CollectedLife);
 
-    // Add resource to inventory
-    inventory->add(resource->type, resource->amount);
+    int removals = 0;
+    int padded = paddedSize(drops.count);
+    for (int i = 0; i < padded; i += Float8::Width) {
+        Float8 x = Float8::load(&drops.x[(size_t)i]);
+        Float8 z = Float8::load(&drops.z[(size_t)i]);
+        Float8 vx = Float8::load(&drops.vx[(size_t)i]);
+        Float8 vz = Float8::load(&drops.vz[(size_t)i]);
+        Float8 life = Float8::load(&drops.life[(size_t)i]);
 
-    // Mark as collected
-    resource->isCollected = true;
+        // Accelerate along the unit direction to the cursor while in range
+        Float8 dx = cx - x;
+        Float8 dz = cz - z;
+        Float8 d2 = dx * dx + dz * dz;
+        Mask8 pulled = d2 < attract2;
+        Float8 scale = math::select(pulled, pullDt / math::sqrt(math::max(d2, tiny)), zero);
+        vx = math::fmadd(dx, scale, vx) * drag;
+        vz = math::fmadd(dz, scale, vz) * drag;
+        x = math::fmadd(vx, dtv, x);
+        z = math::fmadd(vz, dtv, z);
+        life = life - dtv;
 
-    // Destroy the resource entity
-    resourceEntity.destruct();
+        // Contact after the move, so a fast pull cannot skip over the cursor's disc
+        dx = cx - x;
+        dz = cz - z;
+        Mask8 touched = (dx * dx + dz * dz) < contact2;
+        life = math::select(touched, collected, life);
+        int valid = drops.count - i;
+        removals |= (life <= zero).bits() & (valid >= Float8::Width ? 0xFF : (1 << valid) - 1);
+
+        x.store(&drops.x[(size_t)i]);
+        z.store(&drops.z[(size_t)i]);
+        vx.store(&drops.vx[(size_t)i]);
+        vz.store(&drops.vz[(size_t)i]);
+        life.store(&drops.life[(size_t)i]);
+    }
+
+    // Most steps remove nothing, so the scalar compaction only runs when needed
+    int collectedCount = 0;
+    if (removals != 0) {
+        compact(drops, &inventory, collectedCount);
+    }
+    return collectedCount;
+}
+
+int ResourceSystem::age(components::ResourceDrops& drops, float seconds) {
+    for (int i = 0; i < drops.count; i++) {
+        drops.life[(size_t)i] -= seconds;
+    }
+    int collected = 0;
+    return compact(drops, nullptr, collected);
 }
 
 void ResourceSystem::registerSystem(flecs::world& world) {
-    // System that updates resource lifetime and handles collection
+    // System that ages drops, pulls them towards the cursor and collects them
     // Runs in OnUpdate phase
-
-    // Lifetime update system
-    world.system<components::Resource>("ResourceSystem_Lifetime")
+    world.system("ResourceSystem")
         .kind(flecs::OnUpdate)
-        .each([](flecs::entity e, components::Resource& resource) {
-            if (resource.isCollected) {
+        .run([](flecs::iter& it) {
+            flecs::world w = it.world();
+            auto drops = w.get_mut<components::ResourceDrops>();
+            auto inventory = w.get_mut<components::ResourceInventory>();
+            if (!drops || !inventory || drops->size() == 0) {
                 return;
             }
 
-            // Decrease lifetime (use delta time from iter)
-            float dt = 0.016f;  // TODO: Get from iter.delta_time() when available
-            resource.lifetime -= dt;
-
-            // Despawn if lifetime expired
-            if (resource.lifetime <= 0.0f) {
-                e.destruct();
+            PickupParams pickup;
+            auto input = w.get<components::InputState>();
+            if (input && input->mouseWorldValid) {
+                pickup.cursorX = input->mouseWorld.x;
+                pickup.cursorZ = input->mouseWorld.z;
+                pickup.cursorValid = true;
             }
+            auto upgrades = w.get<components::PlayerUpgrades>();
+            if (upgrades) {
+                pickup.attractRadius = attractionRadius(*upgrades);
+            }
+
+            step(*drops, it.delta_time(), pickup, *inventory);
         });
+}
 
-    // Collection system (hover/click to collect)
-    world.system<components::Resource, components::Transform>("ResourceSystem_Collection")
-        .kind(flecs::OnUpdate)
-        .each([&world](flecs::entity e, components::Resource& resource, components::Transform& transform) {
-            if (resource.isCollected) {
+bool ResourceSystem::initRenderer(rendering::InstancedBillboards& billboards) {
+    Shader shader = rendering::loadShaderFromDataPaths("resource_drop.vert", "resource_drop.frag");
+    if (!billboards.init(shader, DropFloatStreams, true)) {
+        return false;
+    }
+
+    // Constant for the lifetime of the shader
+    float radius = DropRadius;
+    float floorHeight = DropFloorHeight;
+    float fadeTime = FadeTime;
+    Vector3 colors[components::ResourceTypeCount];
+    for (int t = 0; t < components::ResourceTypeCount; t++) {
+        Color c = colorFor((components::ResourceType)t);
+        colors[t] = {(float)c.r / 255.0f, (float)c.g / 255.0f, (float)c.b / 255.0f};
+    }
+    SetShaderValue(shader, GetShaderLocation(shader, "dropRadius"), &radius, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(shader, GetShaderLocation(shader, "floorHeight"), &floorHeight, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(shader, GetShaderLocation(shader, "fadeTime"), &fadeTime, SHADER_UNIFORM_FLOAT);
+    SetShaderValueV(shader, GetShaderLocation(shader, "typeColors[0]"), colors, SHADER_UNIFORM_VEC3,
+                    components::ResourceTypeCount);
+    return true;
+}
+
+void ResourceSystem::registerRenderSystem(flecs::world& world, rendering::InstancedBillboards* billboards) {
+    // One instanced draw for every drop; the arrays change every step, so all are re-sent
+    world.system("ResourceRender")
+        .kind(flecs::PostUpdate)
+        .run([billboards](flecs::iter& it) {
+            if (!billboards || !billboards->isReady()) {
                 return;
             }
-
-            // Get input state
-            auto inputState = world.get_mut<components::InputState>();
-            if (!inputState) {
+            auto drops = it.world().get<components::ResourceDrops>();
+            if (!drops || drops->size() == 0) {
                 return;
             }
 
-            // Simple collection: click near resource
-            // TODO: Proper ray casting from camera
-            if (inputState->mouseLeftDown) {
-                Vector3 mouseWorldPos = {0.0f, 0.0f, 0.0f};  // TODO: Get from input system
-
-                float collectRadius = 1.0f;  // Collection radius
-                float dx = mouseWorldPos.x - transform.position.x;
-                float dy = mouseWorldPos.y - transform.position.y;
-                float dz = mouseWorldPos.z - transform.position.z;
-                float distSq = dx * dx + dy * dy + dz * dz;
-
-                if (distSq <= collectRadius * collectRadius) {
-                    collectResource(e, world);
-                }
-            }
+            int count = drops->size();
+            billboards->reserve(count);
+            billboards->uploadFloatStream(DropStreamX, drops->x.data(), count);
+            billboards->uploadFloatStream(DropStreamZ, drops->z.data(), count);
+            billboards->uploadFloatStream(DropStreamLife, drops->life.data(), count);
+            billboards->uploadByteStream(drops->type.data(), count);
+            billboards->draw(count);
         });
 }
 
@@ -5,22 +5,64 @@
 #include "src/components/Resource.h"
 #include "raylib.h"
 
+namespace components {
+struct PlayerUpgrades;
+}
+
 namespace micro_idle {
 
+namespace rendering {
+class InstancedBillboards;
+}
+
+// Cursor pickup for one step of the drops
+struct PickupParams {
+    float cursorX{0.0f};
+    float cursorZ{0.0f};
+    bool cursorValid{false};
+    float contactRadius{0.35f};     // Drops this close to the cursor are collected
+    float attractRadius{0.0f};      // Drops inside are pulled towards the cursor (0 = off)
+    float pull{12.0f};              // Acceleration towards the cursor
+};
+
 // ResourceSystem - handles resource drops, collection, and lifetime
+// Step runs in OnUpdate phase, draw in PostUpdate (one instanced batch)
 class ResourceSystem {
 public:
     // Register the system with FLECS world
     static void registerSystem(flecs::world& world);
 
-    // Spawn a resource drop at a position
-    static flecs::entity spawnResource(flecs::world& world,
-                                      components::ResourceType type,
-                                      float amount,
-                                      Vector3 position);
+    static void registerRenderSystem(flecs::world& world, rendering::InstancedBillboards* billboards);
+
+    // Load the drop shader into `billboards` (needs a GL context)
+    static bool initRenderer(rendering::InstancedBillboards& billboards);
+
+    // Spawn a resource drop at a position (on the dish floor below it)
+    static void spawnResource(flecs::world& world,
+                              components::ResourceType type,
+                              float amount,
+                              Vector3 position);
+
+    static void addDrop(components::ResourceDrops& drops, components::ResourceType type,
+                        float amount, float x, float z);
+
+    /**
+     * Advance every drop by dt in one vectorized pass: pull towards the cursor,
+     * collect on contact, age out. Collected drops are added to `inventory`.
+     *
+     * @return Number of drops collected
+     */
+    static int step(components::ResourceDrops& drops, float dt, const PickupParams& pickup,
+                    components::ResourceInventory& inventory);
+
+    // Age every drop by a block of time without moving it (fast-forward).
+    // Returns how many expired.
+    static int age(components::ResourceDrops& drops, float seconds);
+
+    // Pull radius bought with the Lipids pickup-attraction upgrade
+    static float attractionRadius(const components::PlayerUpgrades& upgrades);
 
-    // Collect a resource (add to inventory and mark for removal)
-    static void collectResource(flecs::entity resourceEntity, flecs::world& world);
+    static Color colorFor(components::ResourceType type);
 };
 
 } // namespace micro_idle
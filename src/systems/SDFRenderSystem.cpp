@@ -5,22 +5,54 @@
 #include "src/components/Rendering.h"
 #include "src/rendering/RaymarchBounds.h"
 #include "src/rendering/SDFShader.h"
+#include "src/rendering/DeferredSDF.h"
+#include "rlgl.h"
 #include "raylib.h"
 #include "raymath.h"
 #include <algorithm>
 #include <cmath>
+#include <memory>
 
 namespace micro_idle {
 
-void SDFRenderSystem::registerSystem(flecs::world& world) {
+void SDFRenderSystem::registerSystem(flecs::world& world, rendering::DeferredSDF* deferred) {
+    // Shared by the three passes for the current frame
+    struct FrameState {
+        int nextId{1};          // G-buffer id of the next proxy drawn (1-based, 0 = empty)
+        components::RaymarchDebug debug;
+    };
+    auto frame = std::make_shared<FrameState>();
+
+    // Route the proxies below into the G-buffer
+    world.system("SDFGeometryPass")
+        .kind(flecs::PostUpdate)
+        .run([&world, deferred, frame](flecs::iter&) {
+            frame->nextId = 1;
+            const auto* debug = world.get<components::RaymarchDebug>();
+            frame->debug = debug ? *debug : components::RaymarchDebug{};
+            if (deferred && deferred->isReady()) {
+                deferred->setHeatmap(frame->debug.heatmap);
+                deferred->setCollectStats(frame->debug.collectStats);
+                deferred->beginGeometry(GetRenderWidth(), GetRenderHeight());
+            }
+        });
+
     // System that renders microbes using SDF raymarching
-    world.system<const components::Microbe, const components::ECMLocomotion, const components::Transform, const components::SDFRenderComponent>("SDFRenderSystem")
+    // Locomotion is optional: rigid body plans have no pseudopods
+    // Microbes whose shell replaces the membrane are drawn by ShellRenderSystem alone
+    world.system<const components::Microbe, const components::ECMLocomotion*, const components::Transform,
+                 const components::SDFRenderComponent, const components::ShellRender*>("SDFRenderSystem")
         .kind(flecs::PostUpdate)
-        .each([&world](const components::Microbe& microbe,
-                       const components::ECMLocomotion& locomotion,
-                       const components::Transform& transform,
-                       const components::SDFRenderComponent& sdf) {
+        .each([&world, frame](const components::Microbe& microbe,
+                              const components::ECMLocomotion* locomotion,
+                              const components::Transform& transform,
+                              const components::SDFRenderComponent& sdf,
+                              const components::ShellRender* shell) {
             (void)transform;
+            if (shell && shell->replacesMembrane) {
+                return;
+            }
+
             const auto* cameraState = world.get<components::CameraState>();
             if (!cameraState) {
                 return;
@@ -42,6 +74,9 @@ void SDFRenderSystem::registerSystem(flecs::world& world) {
 
             rendering::setCameraPosition(sdf.shader, uniforms, cameraState->position);
             rendering::setTime(sdf.shader, uniforms, (float)GetTime());
+            rendering::setMicrobeId(sdf.shader, uniforms, frame->nextId++);
+            rendering::setRaymarchMode(sdf.shader, uniforms, frame->debug.heatmap, frame->debug.relaxedTracing,
+                                       frame->debug.collectStats);
             rendering::setMicrobeUniforms(
                 sdf.shader,
                 uniforms,
@@ -54,17 +89,9 @@ void SDFRenderSystem::registerSystem(flecs::world& world) {
                 sdf.vertexPositions,
                 count);
 
-            Vector3 minPos = sdf.vertexPositions[0];
-            Vector3 maxPos = sdf.vertexPositions[0];
-            for (int i = 1; i < count; i++) {
-                const Vector3& p = sdf.vertexPositions[i];
-                minPos.x = fminf(minPos.x, p.x);
-                minPos.y = fminf(minPos.y, p.y);
-                minPos.z = fminf(minPos.z, p.z);
-                maxPos.x = fmaxf(maxPos.x, p.x);
-                maxPos.y = fmaxf(maxPos.y, p.y);
-                maxPos.z = fmaxf(maxPos.z, p.z);
-            }
+            // Bounds were reduced during extraction
+            Vector3 minPos = sdf.boundsMin;
+            Vector3 maxPos = sdf.boundsMax;
 
             Vector3 center = {
                 (minPos.x + maxPos.x) * 0.5f,
@@ -103,8 +130,9 @@ void SDFRenderSystem::registerSystem(flecs::world& world) {
                 podCount++;
             };
 
-            for (int i = 0; i < components::ECMLocomotion::MaxPods; i++) {
-                const auto& pod = locomotion.pods[i];
+            int podSlots = locomotion ? components::ECMLocomotion::MaxPods : 0;
+            for (int i = 0; i < podSlots; i++) {
+                const auto& pod = locomotion->pods[i];
                 if (pod.state == kPodExtend && pod.index >= 0) {
                     float progress = pod.duration > 0.0f ? pod.time / pod.duration : 0.0f;
                     progress = std::clamp(progress, 0.0f, 1.0f);
@@ -112,15 +140,15 @@ void SDFRenderSystem::registerSystem(flecs::world& world) {
                 }
             }
 
-            for (int i = 0; i < components::ECMLocomotion::MaxPods; i++) {
-                const auto& pod = locomotion.pods[i];
+            for (int i = 0; i < podSlots; i++) {
+                const auto& pod = locomotion->pods[i];
                 if (pod.state == kPodHold && pod.index >= 0) {
                     addPod(pod, 1.0f, 0.8f);
                 }
             }
 
-            for (int i = 0; i < components::ECMLocomotion::MaxPods; i++) {
-                const auto& pod = locomotion.pods[i];
+            for (int i = 0; i < podSlots; i++) {
+                const auto& pod = locomotion->pods[i];
                 if (pod.state == 3 && pod.index >= 0) {
                     float progress = pod.duration > 0.0f ? 1.0f - (pod.time / pod.duration) : 0.0f;
                     progress = std::clamp(progress, 0.0f, 1.0f);
@@ -152,6 +180,23 @@ void SDFRenderSystem::registerSystem(flecs::world& world) {
                      WHITE);
             EndShaderMode();
         });
+
+    // Light every covered pixel once, composited by depth against the meshes already drawn
+    world.system("SDFLightingPass")
+        .kind(flecs::PostUpdate)
+        .run([&world, deferred](flecs::iter&) {
+            if (!deferred || !deferred->isReady()) {
+                return;
+            }
+            deferred->endGeometry();
+
+            const auto* cameraState = world.get<components::CameraState>();
+            if (!cameraState) {
+                return;
+            }
+            Matrix viewProj = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+            deferred->light(cameraState->position, MatrixInvert(viewProj));
+        });
 }
 
 } // namespace micro_idle
@@ -6,12 +6,18 @@
 
 namespace micro_idle {
 
+namespace rendering {
+class DeferredSDF;
+}
+
 // SDF render system - renders microbes using SDF raymarching
 // Runs in PostUpdate phase (final phase, after all simulation)
+// With a ready DeferredSDF the proxies only fill its G-buffer and a single
+// full-screen pass lights them; without one they draw their albedo directly.
 class SDFRenderSystem {
 public:
     // Register the system with FLECS world
-    static void registerSystem(flecs::world& world);
+    static void registerSystem(flecs::world& world, rendering::DeferredSDF* deferred = nullptr);
 };
 
 } // namespace micro_idle
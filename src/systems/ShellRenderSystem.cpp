@@ -0,0 +1,151 @@
+#include "ShellRenderSystem.h"
+#include "src/components/Microbe.h"
+#include "src/components/Rendering.h"
+#include "src/components/Transform.h"
+#include "src/rendering/InstancedShells.h"
+#include "src/rendering/SDFShader.h"
+#include "src/systems/BodyPlanFactory.h"
+#include "raymath.h"
+#include <cmath>
+
+namespace micro_idle {
+
+namespace {
+
+using rendering::ShellPart;
+
+constexpr float GoldenAngle = 2.39996323f;
+constexpr float PhageTailRadius = 0.25f;   // In capsid radii
+constexpr float PhageTailStart = 0.8f;     // Tucked under the capsid faces
+
+// Spine layout; lengths and widths in body radii
+struct SpineSpec {
+    int count;
+    float length;
+    float width;
+    float tilt;         // Alternating elevation out of the dish plane (radians)
+};
+
+const SpineSpec RadiolarianSpines = {16, 2.4f, 0.06f, 0.35f};
+const SpineSpec HeliozoaSpines = {24, 1.8f, 0.03f, 0.5f};
+
+// Shell parts sit inside the membrane by this much, so the join is hidden
+constexpr float SpineRoot = 0.4f;
+
+const SpineSpec& spinesFor(components::MicrobeType type) {
+    return type == components::MicrobeType::Heliozoa ? HeliozoaSpines : RadiolarianSpines;
+}
+
+Color lighten(Color c, float amount) {
+    return {
+        (unsigned char)(c.r + (255 - c.r) * amount),
+        (unsigned char)(c.g + (255 - c.g) * amount),
+        (unsigned char)(c.b + (255 - c.b) * amount),
+        c.a
+    };
+}
+
+} // namespace
+
+bool ShellRenderSystem::shellFor(components::MicrobeType type, components::ShellRender& out) {
+    switch (type) {
+        case components::MicrobeType::Icosahedral:
+            out = {components::ShellKind::Capsid, true};
+            return true;
+        case components::MicrobeType::Bacteriophage:
+            out = {components::ShellKind::Phage, true};
+            return true;
+        case components::MicrobeType::Diatom:
+            out = {components::ShellKind::Frustule, true};
+            return true;
+        case components::MicrobeType::Radiolarian:
+        case components::MicrobeType::Heliozoa:
+            out = {components::ShellKind::Spines, false};
+            return true;
+        default:
+            return false;
+    }
+}
+
+int ShellRenderSystem::addInstances(rendering::InstancedShells& shells, const components::ShellRender& shell,
+                                    const components::Microbe& microbe, const components::Transform& transform) {
+    float r = microbe.stats.baseRadius;
+    Matrix body = MatrixMultiply(QuaternionToMatrix(transform.rotation),
+                                 MatrixTranslate(transform.position.x, transform.position.y, transform.position.z));
+    Color color = microbe.stats.color;
+
+    switch (shell.kind) {
+        case components::ShellKind::Capsid:
+            shells.add(ShellPart::Icosahedron, MatrixMultiply(MatrixScale(r, r, r), body), color);
+            return 1;
+
+        case components::ShellKind::Phage: {
+            shells.add(ShellPart::Icosahedron, MatrixMultiply(MatrixScale(r, r, r), body), color);
+
+            // Tail along body -X, as laid out by the body plan
+            float tail = BodyPlanFactory::GetPlan(microbe.type).tail + (1.0f - PhageTailStart);
+            Matrix local = MatrixMultiply(MatrixScale(PhageTailRadius * r, tail * r, PhageTailRadius * r),
+                                          MatrixRotateZ(0.5f * PI));
+            local = MatrixMultiply(local, MatrixTranslate(-PhageTailStart * r, 0.0f, 0.0f));
+            shells.add(ShellPart::Cylinder, MatrixMultiply(local, body), lighten(color, 0.25f));
+            return 2;
+        }
+
+        case components::ShellKind::Frustule: {
+            // Flat pillbox around the flattened membrane
+            Matrix local = MatrixMultiply(MatrixScale(1.15f * r, 0.8f * r, 1.15f * r),
+                                          MatrixTranslate(0.0f, -0.4f * r, 0.0f));
+            shells.add(ShellPart::Cylinder, MatrixMultiply(local, body), lighten(color, 0.35f));
+            return 1;
+        }
+
+        case components::ShellKind::Spines: {
+            const SpineSpec& spec = spinesFor(microbe.type);
+            Color spineColor = lighten(color, 0.5f);
+            float offset = microbe.stats.seed * 2.0f * PI;
+            for (int i = 0; i < spec.count; i++) {
+                float yaw = offset + GoldenAngle * (float)i;
+                float pitch = (i & 1) ? spec.tilt : -0.5f * spec.tilt;
+                Vector3 dir = {std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch)};
+
+                // Unit cone points up +Y; lift its base inside the membrane, then aim it
+                Matrix local = MatrixMultiply(MatrixScale(spec.width * r, spec.length * r, spec.width * r),
+                                              MatrixTranslate(0.0f, SpineRoot * r, 0.0f));
+                Quaternion aim = QuaternionFromVector3ToVector3({0.0f, 1.0f, 0.0f}, dir);
+                local = MatrixMultiply(local, QuaternionToMatrix(aim));
+                shells.add(ShellPart::Cone, MatrixMultiply(local, body), spineColor);
+            }
+            return spec.count;
+        }
+    }
+    return 0;
+}
+
+bool ShellRenderSystem::initRenderer(rendering::InstancedShells& shells) {
+    return shells.init(rendering::loadShaderFromDataPaths("shell_instanced.vert", "shell_instanced.frag"));
+}
+
+void ShellRenderSystem::registerSystem(flecs::world& world, rendering::InstancedShells* shells) {
+    auto query = world.query<const components::ShellRender, const components::Microbe, const components::Transform>();
+
+    world.system("ShellRenderSystem")
+        .kind(flecs::PostUpdate)
+        .run([shells, query](flecs::iter& it) {
+            if (!shells || !shells->isReady()) {
+                return;
+            }
+            auto cameraState = it.world().get<components::CameraState>();
+            if (!cameraState) {
+                return;
+            }
+
+            query.each([shells](const components::ShellRender& shell,
+                                const components::Microbe& microbe,
+                                const components::Transform& transform) {
+                addInstances(*shells, shell, microbe, transform);
+            });
+            shells->draw(cameraState->position);
+        });
+}
+
+} // namespace micro_idle
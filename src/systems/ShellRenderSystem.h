@@ -0,0 +1,40 @@
+#ifndef MICRO_IDLE_SHELL_RENDER_SYSTEM_H
+#define MICRO_IDLE_SHELL_RENDER_SYSTEM_H
+
+#include <flecs.h>
+#include "raylib.h"
+
+namespace components {
+struct Microbe;
+struct ShellRender;
+struct Transform;
+enum class MicrobeType;
+}
+
+namespace micro_idle {
+
+namespace rendering {
+class InstancedShells;
+}
+
+// Shell render system - rasterizes rigid shells and spines with one instanced
+// draw per mesh part. Runs in PostUpdate before SDFRenderSystem; the SDF pass
+// skips microbes whose shell replaces their membrane.
+class ShellRenderSystem {
+public:
+    static void registerSystem(flecs::world& world, rendering::InstancedShells* shells);
+
+    // Shell for a microbe type; false if it is drawn by the SDF pass alone
+    static bool shellFor(components::MicrobeType type, components::ShellRender& out);
+
+    // Queue one microbe's shell parts. Returns the number of instances added.
+    static int addInstances(rendering::InstancedShells& shells, const components::ShellRender& shell,
+                            const components::Microbe& microbe, const components::Transform& transform);
+
+    // Load the shell shader into `shells` (needs a GL context)
+    static bool initRenderer(rendering::InstancedShells& shells);
+};
+
+} // namespace micro_idle
+
+#endif
@@ -1,7 +1,10 @@
 #include "SoftBodyFactory.h"
 #include "PhysicsSystem.h"
+#include "src/physics/BodyPool.h"
 #include "src/physics/Icosphere.h"
 #include "src/physics/Constraints.h"
+#include "src/math/BatchKernels.h"
+#include "src/math/JoltInterop.h"
 
 #include <Jolt/Physics/SoftBody/SoftBodyCreationSettings.h>
 #include <Jolt/Physics/SoftBody/SoftBodyMotionProperties.h>
@@ -10,18 +13,20 @@
 #include <Jolt/Physics/Body/BodyInterface.h>
 #include <Jolt/Physics/Constraints/DistanceConstraint.h>
 #include <Jolt/Physics/Collision/Shape/SphereShape.h>
-#include <vector>
+#include <algorithm>
 #include <cmath>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace micro_idle {
 
-JPH::BodyID SoftBodyFactory::CreateAmoeba(
-    PhysicsSystemState* physics,
-    Vector3 position,
-    float radius,
-    int subdivisions,
-    std::vector<JPH::BodyID>& outSkeletonBodyIDs
-) {
+namespace {
+
+constexpr size_t MaxCachedSettings = 256;   // Past this, unusual sizes are built uncached
+
+// Step 1-3 of an amoeba: icosphere mesh, vertices and faces, constraints
+JPH::Ref<JPH::SoftBodySharedSettings> buildSharedSettings(float radius, int subdivisions) {
 
     // Step 1: Generate icosphere mesh
     IcosphereMesh mesh = GenerateIcosphere(subdivisions, radius);
@@ -31,7 +36,7 @@ JPH::BodyID SoftBodyFactory::CreateAmoeba(
     }
 
     // Step 2: Create SoftBodySharedSettings
-    auto sharedSettings = new JPH::SoftBodySharedSettings();
+    JPH::Ref<JPH::SoftBodySharedSettings> sharedSettings = new JPH::SoftBodySharedSettings();
 
     // Add vertices
     for (int i = 0; i < mesh.vertexCount; i++) {
@@ -68,36 +73,127 @@ JPH::BodyID SoftBodyFactory::CreateAmoeba(
 
     // Optimize the soft body for parallel execution
     sharedSettings->Optimize();
+    return sharedSettings;
+}
+
+// Shared settings are immutable once built, so one per (subdivisions, size
+// bucket) serves every world. Entries are never evicted: pooled bodies are
+// keyed by the settings pointer, and a size keeps the same settings for good.
+JPH::Ref<JPH::SoftBodySharedSettings> cachedSharedSettings(float radius, int subdivisions) {
+    static std::mutex mutex;
+    static std::unordered_map<uint64_t, JPH::Ref<JPH::SoftBodySharedSettings>> cache;
+
+    int bucket = SoftBodyFactory::SizeBucket(radius);
+    uint64_t key = ((uint64_t)(uint32_t)subdivisions << 32) | (uint32_t)bucket;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    JPH::Ref<JPH::SoftBodySharedSettings> settings =
+        buildSharedSettings(SoftBodyFactory::BucketRadius(bucket), subdivisions);
+    if (cache.size() < MaxCachedSettings) {
+        cache.emplace(key, settings);
+    }
+    return settings;
+}
+
+// Steps 4-5: take a pooled body built from the same settings, or create one, set its
+// vertex state (rest pose when localPositions is null) and add it to the simulation
+JPH::BodyID spawnAmoeba(
+    PhysicsSystemState* physics,
+    const JPH::Ref<JPH::SoftBodySharedSettings>& sharedSettings,
+    Vector3 position,
+    float radius,
+    const Vector3* localPositions,
+    const Vector3* velocities
+) {
+    JPH::BodyInterface& bodyInterface = physics->physicsSystem->GetBodyInterface();
+    JPH::RVec3 center(position.x, position.y, position.z);
+
+    JPH::BodyID bodyID = physics->bodyPool->acquire(sharedSettings.GetPtr());
+    bool pooled = !bodyID.IsInvalid();
+    if (pooled) {
+        bodyInterface.SetPositionAndRotation(bodyID, center, JPH::Quat::sIdentity(), JPH::EActivation::DontActivate);
+    } else {
+        // Step 4: Create SoftBodyCreationSettings
+        JPH::SoftBodyCreationSettings creationSettings(
+            sharedSettings,
+            center,
+            JPH::Quat::sIdentity(),
+            Layers::SKIN  // Skin layer: collides with ground and skeleton
+        );
+
+        // Configure soft body physics properties for a thick, gel-like response
+        creationSettings.mPressure = 0.4f;             // Lower pressure for more deformable membrane
+        creationSettings.mRestitution = 0.0f;          // No bounce for gel-like response
+        creationSettings.mFriction = 1.8f;             // Grip for crawling without locking motion
+        creationSettings.mLinearDamping = 2.4f;        // Damping for gel-like response
+        creationSettings.mGravityFactor = 2.2f;        // Heavier to keep contact with substrate
+        creationSettings.mNumIterations = 24;          // Stability for stiffer constraints
+        creationSettings.mMaxLinearVelocity = std::max(3.0f, radius * 9.0f);
+        creationSettings.mUpdatePosition = true;       // Update body position
+        creationSettings.mMakeRotationIdentity = true; // Bake rotation into vertices
+        creationSettings.mAllowSleeping = false;       // Keep always active for gameplay
+
+        // Step 5: Create the soft body
+        JPH::Body* body = bodyInterface.CreateSoftBody(creationSettings);
+        if (body == nullptr) {
+            return JPH::BodyID();
+        }
+        bodyID = body->GetID();
+    }
+
+    // A new body already starts at rest; a pooled one still has its last shape
+    if (pooled || localPositions) {
+        JPH::BodyLockWrite lock(physics->physicsSystem->GetBodyLockInterface(), bodyID);
+        if (lock.Succeeded()) {
+            auto* motionProps = static_cast<JPH::SoftBodyMotionProperties*>(lock.GetBody().GetMotionProperties());
+            JPH::Array<JPH::SoftBodyVertex>& vertices = motionProps->GetVertices();
+            for (size_t i = 0; i < vertices.size(); i++) {
+                JPH::SoftBodyVertex& vertex = vertices[i];
+                if (localPositions) {
+                    vertex.mPosition = JPH::Vec3(localPositions[i].x, localPositions[i].y, localPositions[i].z);
+                } else {
+                    vertex.mPosition = JPH::Vec3(sharedSettings->mVertices[i].mPosition);
+                }
+                vertex.mPreviousPosition = vertex.mPosition;
+                vertex.mVelocity = velocities
+                    ? JPH::Vec3(velocities[i].x, velocities[i].y, velocities[i].z)
+                    : JPH::Vec3::sZero();
+            }
+        }
+    }
+
+    bodyInterface.AddBody(bodyID, JPH::EActivation::Activate);
+    return bodyID;
+}
+
+} // namespace
 
+int SoftBodyFactory::SizeBucket(float radius) {
+    return (int)std::lround(std::log(std::max(radius, 1e-4f)) / std::log(SizeBucketRatio));
+}
+
+float SoftBodyFactory::BucketRadius(int bucket) {
+    return std::pow(SizeBucketRatio, (float)bucket);
+}
+
+JPH::BodyID SoftBodyFactory::CreateAmoeba(
+    PhysicsSystemState* physics,
+    Vector3 position,
+    float radius,
+    int subdivisions,
+    std::vector<JPH::BodyID>& outSkeletonBodyIDs
+) {
 
-    // Step 4: Create SoftBodyCreationSettings
-    JPH::SoftBodyCreationSettings creationSettings(
-        sharedSettings,
-        JPH::RVec3(position.x, position.y, position.z),
-        JPH::Quat::sIdentity(),
-        Layers::SKIN  // Skin layer: collides with ground and skeleton
-    );
-
-    // Configure soft body physics properties for a thick, gel-like response
-    creationSettings.mPressure = 0.4f;             // Lower pressure for more deformable membrane
-    creationSettings.mRestitution = 0.0f;          // No bounce for gel-like response
-    creationSettings.mFriction = 1.8f;             // Grip for crawling without locking motion
-    creationSettings.mLinearDamping = 2.4f;        // Damping for gel-like response
-    creationSettings.mGravityFactor = 2.2f;        // Heavier to keep contact with substrate
-    creationSettings.mNumIterations = 24;          // Stability for stiffer constraints
-    creationSettings.mMaxLinearVelocity = std::max(3.0f, radius * 9.0f);
-    creationSettings.mUpdatePosition = true;       // Update body position
-    creationSettings.mMakeRotationIdentity = true; // Bake rotation into vertices
-    creationSettings.mAllowSleeping = false;       // Keep always active for gameplay
-
-    // Step 5: Create and add the soft body
-    JPH::BodyID bodyID = physics->physicsSystem->GetBodyInterface().CreateAndAddSoftBody(
-        creationSettings,
-        JPH::EActivation::Activate
-    );
+    // Steps 1-5: cached shared settings, pooled or new body
+    JPH::Ref<JPH::SoftBodySharedSettings> sharedSettings = cachedSharedSettings(radius, subdivisions);
+    float bodyRadius = BucketRadius(SizeBucket(radius));
+    JPH::BodyID bodyID = spawnAmoeba(physics, sharedSettings, position, bodyRadius, nullptr, nullptr);
 
     if (bodyID.IsInvalid()) {
-        delete sharedSettings;
         return JPH::BodyID();
     }
 
@@ -156,11 +252,88 @@ JPH::BodyID SoftBodyFactory::CreateAmoeba(
     return bodyID;
 }
 
+JPH::BodyID SoftBodyFactory::CreateAmoebaFromState(
+    PhysicsSystemState* physics,
+    Vector3 position,
+    float radius,
+    int subdivisions,
+    const Vector3* localPositions,
+    const Vector3* velocities,
+    int count
+) {
+    JPH::Ref<JPH::SoftBodySharedSettings> sharedSettings = cachedSharedSettings(radius, subdivisions);
+    if (localPositions == nullptr || count != (int)sharedSettings->mVertices.size()) {
+        localPositions = nullptr;
+        velocities = nullptr;
+    }
+    return spawnAmoeba(physics, sharedSettings, position, BucketRadius(SizeBucket(radius)), localPositions,
+                       velocities);
+}
+
+int SoftBodyFactory::ReadVertexState(
+    PhysicsSystemState* physics,
+    JPH::BodyID bodyID,
+    std::vector<Vector3>& outLocal,
+    std::vector<Vector3>& outVelocities,
+    Vector3& outCenter
+) {
+    outLocal.clear();
+    outVelocities.clear();
+    if (bodyID.IsInvalid()) {
+        return 0;
+    }
+
+    JPH::BodyLockRead lock(physics->physicsSystem->GetBodyLockInterface(), bodyID);
+    if (!lock.Succeeded() || !lock.GetBody().IsSoftBody()) {
+        return 0;
+    }
+
+    const JPH::Body& body = lock.GetBody();
+    const auto* motionProps = static_cast<const JPH::SoftBodyMotionProperties*>(body.GetMotionProperties());
+    const JPH::Array<JPH::SoftBodyVertex>& vertices = motionProps->GetVertices();
+
+    // Rotation is baked into the vertices at creation, but undo it anyway
+    JPH::Quat rotation = body.GetRotation();
+    JPH::RVec3 center = body.GetCenterOfMassPosition();
+    outCenter = {(float)center.GetX(), (float)center.GetY(), (float)center.GetZ()};
+    outLocal.reserve(vertices.size());
+    outVelocities.reserve(vertices.size());
+    for (const JPH::SoftBodyVertex& vertex : vertices) {
+        JPH::Vec3 p = rotation * vertex.mPosition;
+        outLocal.push_back({p.GetX(), p.GetY(), p.GetZ()});
+        outVelocities.push_back({vertex.mVelocity.GetX(), vertex.mVelocity.GetY(), vertex.mVelocity.GetZ()});
+    }
+    return (int)vertices.size();
+}
+
+void SoftBodyFactory::ReleaseAmoeba(
+    PhysicsSystemState* physics,
+    JPH::BodyID bodyID
+) {
+    if (bodyID.IsInvalid()) {
+        return;
+    }
+
+    // Pool key: the shared settings the body was built from
+    const void* key = nullptr;
+    {
+        JPH::BodyLockRead lock(physics->physicsSystem->GetBodyLockInterface(), bodyID);
+        if (!lock.Succeeded()) {
+            return;
+        }
+        if (lock.GetBody().IsSoftBody()) {
+            key = static_cast<const JPH::SoftBodyMotionProperties*>(lock.GetBody().GetMotionProperties())->GetSettings();
+        }
+    }
+    physics->bodyPool->release(physics->physicsSystem->GetBodyInterface(), key, bodyID);
+}
+
 int SoftBodyFactory::ExtractVertexPositions(
     PhysicsSystemState* physics,
     JPH::BodyID bodyID,
     Vector3* outPositions,
-    int maxPositions
+    int maxPositions,
+    math::PointBounds* outBounds
 ) {
     if (bodyID.IsInvalid()) {
         return 0;
@@ -188,36 +361,15 @@ int SoftBodyFactory::ExtractVertexPositions(
         return 0;
     }
 
-    // Get the center of mass transform to convert from local to world space
-    JPH::RVec3 comPos = body.GetCenterOfMassPosition();
-    JPH::Quat comRot = body.GetRotation();
-    JPH::RMat44 comTransform = JPH::RMat44::sRotationTranslation(comRot, comPos);
-
-    if ((int)vertexCount <= maxPositions) {
-        for (int i = 0; i < count; i++) {
-            // Transform from local space (relative to center of mass) to world space
-            JPH::Vec3 localPos = vertices[i].mPosition;
-            JPH::Vec3 worldPos = comTransform * localPos;
-            outPositions[i].x = worldPos.GetX();
-            outPositions[i].y = worldPos.GetY();
-            outPositions[i].z = worldPos.GetZ();
-        }
-    } else if (count == 1) {
-        JPH::Vec3 localPos = vertices[0].mPosition;
-        JPH::Vec3 worldPos = comTransform * localPos;
-        outPositions[0].x = worldPos.GetX();
-        outPositions[0].y = worldPos.GetY();
-        outPositions[0].z = worldPos.GetZ();
+    // Transform from local space (relative to center of mass) to world space,
+    // evenly subsampling when the caller's buffer is smaller than the mesh
+    math::RigidTransformA comTransform = math::from_jolt(body.GetRotation(), JPH::Vec3(body.GetCenterOfMassPosition()));
+    if (outBounds) {
+        math::transform_points_sampled_bounds(comTransform, math::positions_of(vertices), vertexCount,
+                                              math::strided(outPositions), (size_t)count, *outBounds);
     } else {
-        float step = (float)(vertexCount - 1) / (float)(count - 1);
-        for (int i = 0; i < count; i++) {
-            int idx = (int)(i * step + 0.5f);
-            JPH::Vec3 localPos = vertices[idx].mPosition;
-            JPH::Vec3 worldPos = comTransform * localPos;
-            outPositions[i].x = worldPos.GetX();
-            outPositions[i].y = worldPos.GetY();
-            outPositions[i].z = worldPos.GetZ();
-        }
+        math::transform_points_sampled(comTransform, math::positions_of(vertices), vertexCount,
+                                       math::strided(outPositions), (size_t)count);
     }
 
     return count;
@@ -7,6 +7,10 @@
 #include "raylib.h"
 #include <vector>
 
+namespace math {
+struct PointBounds;
+}
+
 namespace micro_idle {
 
 struct PhysicsSystemState; // Forward declaration
@@ -17,9 +21,21 @@ struct PhysicsSystemState; // Forward declaration
  * Uses the Puppet architecture: single Jolt soft body for physics simulation,
  * with vertex positions extracted for SDF raymarching rendering.
  * Forces are applied directly to soft body vertices for EC&M locomotion.
+ *
+ * Shared settings (mesh, constraints) are cached per size bucket and shared by
+ * every world; removed amoebas go to the world's BodyPool and are reset and
+ * re-added by the next amoeba in the same bucket instead of being built from
+ * scratch. Spawn radii are continuous, so the body is built at its bucket's
+ * radius, within 2% of the one asked for.
  */
 class SoftBodyFactory {
 public:
+    static constexpr float SizeBucketRatio = 1.04f;    // Neighbouring bucket radii differ by 4%
+
+    // Size bucket of a radius, and the radius bodies in that bucket are built at
+    static int SizeBucket(float radius);
+    static float BucketRadius(int bucket);
+
     /**
      * Create an amoeba soft body using proper Jolt soft body physics
      * Implements "Internal Motor" model: soft body skin with internal rigid skeleton
@@ -39,6 +55,48 @@ public:
         std::vector<JPH::BodyID>& outSkeletonBodyIDs
     );
 
+    /**
+     * Create an amoeba whose vertices start from a given state instead of the rest pose
+     * (cell division). The state must match the template's vertex count, otherwise the
+     * rest pose is used. Reuses a pooled body and the cached settings like CreateAmoeba.
+     *
+     * @param localPositions Vertex positions relative to `position` (count entries)
+     * @param velocities Vertex velocities, or null for none
+     * @return Jolt BodyID of the soft body, invalid on failure
+     */
+    static JPH::BodyID CreateAmoebaFromState(
+        PhysicsSystemState* physics,
+        Vector3 position,
+        float radius,
+        int subdivisions,
+        const Vector3* localPositions,
+        const Vector3* velocities,
+        int count
+    );
+
+    /**
+     * Read a soft body's current vertex state
+     *
+     * @param outLocal Vertex positions relative to the center of mass
+     * @param outVelocities Vertex velocities
+     * @param outCenter Center of mass in world space
+     * @return Number of vertices (0 if the body is not a soft body)
+     */
+    static int ReadVertexState(
+        PhysicsSystemState* physics,
+        JPH::BodyID bodyID,
+        std::vector<Vector3>& outLocal,
+        std::vector<Vector3>& outVelocities,
+        Vector3& outCenter
+    );
+
+    // Take a soft body out of the simulation and keep it in the world's pool for
+    // the next amoeba of the same size (destroyed instead when the pool is full)
+    static void ReleaseAmoeba(
+        PhysicsSystemState* physics,
+        JPH::BodyID bodyID
+    );
+
     /**
      * Extract vertex positions from a soft body for SDF rendering
      *
@@ -46,13 +104,16 @@ public:
      * @param bodyID The soft body BodyID
      * @param outPositions Output array (must be pre-allocated)
      * @param maxPositions Maximum number of positions to extract
+     * @param outBounds Optional AABB, centroid and extent of the written
+     *        positions, reduced in the same pass
      * @return Number of vertices extracted
      */
     static int ExtractVertexPositions(
         PhysicsSystemState* physics,
         JPH::BodyID bodyID,
         Vector3* outPositions,
-        int maxPositions
+        int maxPositions,
+        math::PointBounds* outBounds = nullptr
     );
 
     /**
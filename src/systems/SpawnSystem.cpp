@@ -2,15 +2,12 @@
 #include "src/components/Microbe.h"
 #include "src/components/Transform.h"
 #include "src/components/WorldState.h"
+#include "src/components/RandomStreams.h"
 #include "src/World.h"
-#include <cstdlib>
 #include <cmath>
 
 namespace micro_idle {
 
-float SpawnSystem::spawnRate = 1.0f;  // Default: 1 microbe per second
-float SpawnSystem::spawnAccumulator = 0.0f;
-
 void SpawnSystem::registerSystem(flecs::world& world, World* worldInstance) {
     // System that spawns microbes based on spawn rate
     // Runs in OnUpdate phase (simulation phase)
@@ -20,46 +17,41 @@ void SpawnSystem::registerSystem(flecs::world& world, World* worldInstance) {
         .run([worldInstance](flecs::iter& it) {
             float dt = it.delta_time();
 
-            static int callCount = 0;
-
+            // Spawn clock and bounds live in the world state singleton so every
+            // World starts from the same state
+            auto worldState = it.world().get_mut<components::WorldState>();
+            if (!worldState || worldState->spawnRate <= 0.0f) {
+                return;
+            }
 
-            spawnAccumulator += dt;
+            worldState->spawnAccumulator += dt;
 
             // Calculate how many microbes to spawn this frame
-            float spawnInterval = 1.0f / spawnRate;
+            float spawnInterval = 1.0f / worldState->spawnRate;
             int spawnCount = 0;
 
             // Spawn as many as we can (handle floating point precision issues)
-            while (spawnAccumulator >= spawnInterval - 0.0001f) {  // Small epsilon for floating point
+            while (worldState->spawnAccumulator >= spawnInterval - 0.0001f) {  // Small epsilon for floating point
                 spawnCount++;
-                spawnAccumulator -= spawnInterval;
+                worldState->spawnAccumulator -= spawnInterval;
             }
 
-            // Disabled excessive logging for performance
-            // if (callCount < 20 || spawnCount > 0) {
-            //     printf("SpawnSystem [call %d]: spawnAcc=%.6f (AFTER add), spawnCount=%d\n",
-            //            callCount, spawnAccumulator + (spawnCount * spawnInterval), spawnCount);
-            // }
-            callCount++;
-
-            if (spawnCount == 0) {
+            if (spawnCount == 0 || !worldState->spawnEnabled) {
                 return;  // Nothing to spawn this frame
             }
 
-            // Get world bounds from singleton
-            auto worldState = it.world().get<components::WorldState>();
-            if (worldState && !worldState->spawnEnabled) {
-                return;
-            }
-
-            float worldWidth = worldState ? worldState->worldWidth : 50.0f;
-            float worldHeight = worldState ? worldState->worldHeight : 50.0f;
+            float worldWidth = worldState->worldWidth;
+            float worldHeight = worldState->worldHeight;
             float spawnHeight = 1.5f;  // Spawn near ground for cohesive visuals
 
+            auto streams = it.world().get_mut<components::RandomStreams>();
+            if (!streams) {
+                return;
+            }
 
             // Queue spawn requests (will be executed after world.progress() to avoid readonly issues)
             for (int i = 0; i < spawnCount; i++) {
-                SpawnRequest request = generateSpawnRequest(worldWidth, worldHeight, spawnHeight);
+                SpawnRequest request = generateSpawnRequest(&streams->spawn, worldWidth, worldHeight, spawnHeight);
                 worldInstance->spawnQueue.push_back(request);
             }
 
@@ -70,36 +62,66 @@ void SpawnSystem::registerSystem(flecs::world& world, World* worldInstance) {
         });
 }
 
-SpawnRequest SpawnSystem::generateSpawnRequest(float worldWidth,
-                                                float worldHeight,
-                                                float spawnHeight) {
+// Maps six uniform [0,1) samples onto a spawn request so the scalar and
+// batched paths share one distribution
+static SpawnRequest makeSpawnRequest(const float u[6],
+                                     float worldWidth,
+                                     float worldHeight,
+                                     float spawnHeight) {
     // Random position within bounds (accounting for microbe radius)
     float margin = 2.0f;  // Margin from walls
     float halfWidth = worldWidth / 2.0f - margin;
     float halfHeight = worldHeight / 2.0f - margin;
 
-    float randX = (float)rand() / RAND_MAX;
-    float randZ = (float)rand() / RAND_MAX;
-    float x = randX * 2.0f * halfWidth - halfWidth;
-    float z = randZ * 2.0f * halfHeight - halfHeight;
+    float x = u[0] * 2.0f * halfWidth - halfWidth;
+    float z = u[1] * 2.0f * halfHeight - halfHeight;
     float y = spawnHeight;
 
     Vector3 position = {x, y, z};
 
     // Random radius (0.2 to 0.35)
-    float radius = 0.2f + ((float)rand() / RAND_MAX) * 0.15f;
+    float radius = 0.2f + u[2] * 0.15f;
 
     // Random color (variation of green/blue for microbes)
     Color color = {
-        (unsigned char)(90 + (rand() % 60)),
-        (unsigned char)(170 + (rand() % 60)),
-        (unsigned char)(110 + (rand() % 60)),
+        (unsigned char)(90 + (int)(u[3] * 60.0f)),
+        (unsigned char)(170 + (int)(u[4] * 60.0f)),
+        (unsigned char)(110 + (int)(u[5] * 60.0f)),
         255
     };
 
     return SpawnRequest{position, radius, color};
 }
 
+SpawnRequest SpawnSystem::generateSpawnRequest(Rng* rng,
+                                                float worldWidth,
+                                                float worldHeight,
+                                                float spawnHeight) {
+    float u[6];
+    for (float& value : u) {
+        value = rng_next_f01(rng);
+    }
+    return makeSpawnRequest(u, worldWidth, worldHeight, spawnHeight);
+}
+
+void SpawnSystem::generateSpawnRequests(Rng8* rng,
+                                        int count,
+                                        float worldWidth,
+                                        float worldHeight,
+                                        float spawnHeight,
+                                        std::vector<SpawnRequest>& out) {
+    if (count <= 0) {
+        return;
+    }
+    std::vector<float> samples((size_t)count * 6);
+    rng8_fill_f01(rng, samples.data(), (int)samples.size());
+
+    out.reserve(out.size() + (size_t)count);
+    for (int i = 0; i < count; i++) {
+        out.push_back(makeSpawnRequest(&samples[(size_t)i * 6], worldWidth, worldHeight, spawnHeight));
+    }
+}
+
 flecs::entity SpawnSystem::spawnMicrobe(World* worldInstance,
                                         float worldWidth,
                                         float worldHeight,
@@ -108,18 +130,39 @@ flecs::entity SpawnSystem::spawnMicrobe(World* worldInstance,
         return flecs::entity();
     }
 
-    SpawnRequest request = generateSpawnRequest(worldWidth, worldHeight, spawnHeight);
+    auto streams = worldInstance->getWorld().get_mut<components::RandomStreams>();
+    if (!streams) {
+        return flecs::entity();
+    }
+    SpawnRequest request = generateSpawnRequest(&streams->spawn, worldWidth, worldHeight, spawnHeight);
 
     // Create amoeba using World factory method
     return worldInstance->createAmoeba(request.position, request.radius, request.color);
 }
 
-float SpawnSystem::getSpawnRate() {
-    return spawnRate;
+float SpawnSystem::getSpawnRate(const flecs::world& world) {
+    auto worldState = world.get<components::WorldState>();
+    return worldState ? worldState->spawnRate : 0.0f;
 }
 
-void SpawnSystem::setSpawnRate(float rate) {
-    spawnRate = rate > 0.0f ? rate : 0.0f;
+void SpawnSystem::setSpawnRate(flecs::world& world, float rate) {
+    auto worldState = world.get_mut<components::WorldState>();
+    if (worldState) {
+        worldState->spawnRate = rate > 0.0f ? rate : 0.0f;
+    }
+}
+
+int SpawnSystem::consumeElapsed(flecs::world& world, float seconds) {
+    auto worldState = world.get_mut<components::WorldState>();
+    if (!worldState || seconds <= 0.0f || worldState->spawnRate <= 0.0f) {
+        return 0;
+    }
+    // Same bookkeeping as the per-tick path, without iterating one interval at a time
+    worldState->spawnAccumulator += seconds;
+    float spawnInterval = 1.0f / worldState->spawnRate;
+    int spawnCount = (int)floorf(worldState->spawnAccumulator / spawnInterval);
+    worldState->spawnAccumulator -= (float)spawnCount * spawnInterval;
+    return spawnCount;
 }
 
 } // namespace micro_idle
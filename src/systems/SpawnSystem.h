@@ -2,7 +2,9 @@
 #define MICRO_IDLE_SPAWN_SYSTEM_H
 
 #include <flecs.h>
+#include <vector>
 #include "raylib.h"
+#include "engine/util/rng.h"
 #include "../SpawnRequest.h"
 
 namespace micro_idle {
@@ -17,10 +19,19 @@ public:
     static void registerSystem(flecs::world& world, World* worldInstance);
 
     // Generate a spawn request (for deferred spawning)
-    static SpawnRequest generateSpawnRequest(float worldWidth,
+    static SpawnRequest generateSpawnRequest(Rng* rng,
+                                             float worldWidth,
                                              float worldHeight,
                                              float spawnHeight);
 
+    // Generate a batch of spawn requests from one bulk random fill
+    static void generateSpawnRequests(Rng8* rng,
+                                      int count,
+                                      float worldWidth,
+                                      float worldHeight,
+                                      float spawnHeight,
+                                      std::vector<SpawnRequest>& out);
+
     // Spawn a single microbe at a random position within bounds
     // Returns the created entity
     static flecs::entity spawnMicrobe(World* worldInstance,
@@ -29,14 +40,14 @@ public:
                                       float spawnHeight);
 
     // Get current spawn rate (microbes per second)
-    static float getSpawnRate();
+    static float getSpawnRate(const flecs::world& world);
 
     // Set spawn rate
-    static void setSpawnRate(float rate);
+    static void setSpawnRate(flecs::world& world, float rate);
 
-private:
-    static float spawnRate;  // Current spawn rate (microbes per second)
-    static float spawnAccumulator;  // Accumulated time since last spawn
+    // Advance the spawn clock by a block of elapsed time (fast-forward)
+    // Returns how many spawns fell due in that block
+    static int consumeElapsed(flecs::world& world, float seconds);
 };
 
 } // namespace micro_idle
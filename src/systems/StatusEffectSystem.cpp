@@ -0,0 +1,282 @@
+#include "StatusEffectSystem.h"
+#include "src/components/Damage.h"
+#include "src/math/Simd.h"
+#include <algorithm>
+#include <vector>
+
+namespace micro_idle {
+
+namespace {
+
+using components::EffectBucket;
+using components::EffectType;
+using math::Float8;
+
+int paddedSize(int n) {
+    return (n + 7) & ~7;
+}
+
+void resize(EffectBucket& bucket, int count) {
+    size_t padded = (size_t)paddedSize(count);
+    bucket.entities.resize(padded);
+    bucket.tags.resize(padded);
+    bucket.remaining.resize(padded);
+    bucket.magnitude.resize(padded);
+    for (size_t i = (size_t)count; i < padded; i++) {
+        bucket.entities[i] = 0;
+        bucket.tags[i] = 0;
+        bucket.remaining[i] = 0.0f;
+        bucket.magnitude[i] = 0.0f;
+    }
+    bucket.count = count;
+}
+
+bool keyLess(flecs::entity_t entityA, uint32_t tagA, flecs::entity_t entityB, uint32_t tagB) {
+    return entityA < entityB || (entityA == entityB && tagA < tagB);
+}
+
+// First slot whose key is not below (entity, tag)
+int lowerBound(const EffectBucket& bucket, flecs::entity_t entity, uint32_t tag) {
+    int lo = 0;
+    int hi = bucket.count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (keyLess(bucket.entities[(size_t)mid], bucket.tags[(size_t)mid], entity, tag)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Remove expired effects (keeping the order), listing them in `expired`
+int compact(EffectBucket& bucket, EffectType type, std::vector<components::EffectExpiry>& expired) {
+    int write = 0;
+    for (int i = 0; i < bucket.count; i++) {
+        size_t k = (size_t)i;
+        if (bucket.remaining[k] <= 0.0f) {
+            expired.push_back({bucket.entities[k], bucket.tags[k], type});
+            continue;
+        }
+        size_t w = (size_t)write++;
+        bucket.entities[w] = bucket.entities[k];
+        bucket.tags[w] = bucket.tags[k];
+        bucket.remaining[w] = bucket.remaining[k];
+        bucket.magnitude[w] = bucket.magnitude[k];
+    }
+    int removed = bucket.count - write;
+    resize(bucket, write);
+    return removed;
+}
+
+// Remove the effects of entities in `sorted` (keeping the order)
+void removeSorted(EffectBucket& bucket, const std::vector<flecs::entity_t>& sorted) {
+    int write = 0;
+    size_t d = 0;
+    for (int i = 0; i < bucket.count; i++) {
+        size_t k = (size_t)i;
+        while (d < sorted.size() && sorted[d] < bucket.entities[k]) {
+            d++;
+        }
+        if (d < sorted.size() && sorted[d] == bucket.entities[k]) {
+            continue;
+        }
+        size_t w = (size_t)write++;
+        bucket.entities[w] = bucket.entities[k];
+        bucket.tags[w] = bucket.tags[k];
+        bucket.remaining[w] = bucket.remaining[k];
+        bucket.magnitude[w] = bucket.magnitude[k];
+    }
+    if (write != bucket.count) {
+        resize(bucket, write);
+    }
+}
+
+} // namespace
+
+void StatusEffectSystem::merge(components::StatusEffects& effects) {
+    if (effects.pending.empty()) {
+        return;
+    }
+    auto& pending = effects.pending;
+    std::stable_sort(pending.begin(), pending.end(), [](const auto& a, const auto& b) {
+        if (a.type != b.type) {
+            return a.type < b.type;
+        }
+        return keyLess(a.entity, a.tag, b.entity, b.tag);
+    });
+
+    // Merge each type's sorted requests into its sorted bucket; equal keys combine
+    EffectBucket merged;
+    size_t r = 0;
+    while (r < pending.size()) {
+        EffectType type = pending[r].type;
+        EffectBucket& bucket = effects.buckets[(int)type];
+        merged.entities.clear();
+        merged.tags.clear();
+        merged.remaining.clear();
+        merged.magnitude.clear();
+
+        auto push = [&](flecs::entity_t entity, uint32_t tag, float remaining, float magnitude) {
+            if (!merged.entities.empty() && merged.entities.back() == entity && merged.tags.back() == tag) {
+                merged.remaining.back() = std::max(merged.remaining.back(), remaining);
+                merged.magnitude.back() = std::max(merged.magnitude.back(), magnitude);
+                return;
+            }
+            merged.entities.push_back(entity);
+            merged.tags.push_back(tag);
+            merged.remaining.push_back(remaining);
+            merged.magnitude.push_back(magnitude);
+        };
+
+        size_t i = 0;
+        size_t count = (size_t)bucket.count;
+        while (i < count || (r < pending.size() && pending[r].type == type)) {
+            bool takeRequest = r < pending.size() && pending[r].type == type &&
+                               (i >= count || !keyLess(bucket.entities[i], bucket.tags[i],
+                                                       pending[r].entity, pending[r].tag));
+            if (takeRequest) {
+                const auto& request = pending[r++];
+                if (request.duration > 0.0f) {
+                    push(request.entity, request.tag, request.duration, request.magnitude);
+                }
+            } else {
+                push(bucket.entities[i], bucket.tags[i], bucket.remaining[i], bucket.magnitude[i]);
+                i++;
+            }
+        }
+
+        std::swap(bucket.entities, merged.entities);
+        std::swap(bucket.tags, merged.tags);
+        std::swap(bucket.remaining, merged.remaining);
+        std::swap(bucket.magnitude, merged.magnitude);
+        resize(bucket, (int)bucket.entities.size());
+    }
+    pending.clear();
+}
+
+int StatusEffectSystem::tick(components::StatusEffects& effects, float dt, components::DamageBuffer& buffer) {
+    merge(effects);
+    effects.expired.clear();
+
+    const Float8 dtv = Float8::broadcast(dt);
+    const Float8 zero = Float8::zero();
+    std::vector<float> damage;
+    int expiredCount = 0;
+
+    for (int t = 0; t < components::EffectTypeCount; t++) {
+        EffectBucket& bucket = effects.buckets[t];
+        if (bucket.count == 0) {
+            continue;
+        }
+        bool dot = t == (int)EffectType::DamageOverTime;
+        int padded = paddedSize(bucket.count);
+        if (dot) {
+            damage.resize((size_t)padded);
+        }
+
+        // Padding lanes have nothing left, so they deal nothing and never expire
+        int removals = 0;
+        for (int i = 0; i < padded; i += Float8::Width) {
+            Float8 left = Float8::load(&bucket.remaining[(size_t)i]);
+            if (dot) {
+                // Only the part of dt the effect was still running for deals damage
+                Float8 active = math::max(math::min(left, dtv), zero);
+                (Float8::load(&bucket.magnitude[(size_t)i]) * active).store(&damage[(size_t)i]);
+            }
+            left = left - dtv;
+            left.store(&bucket.remaining[(size_t)i]);
+            int valid = bucket.count - i;
+            removals |= (left <= zero).bits() & (valid >= Float8::Width ? 0xFF : (1 << valid) - 1);
+        }
+
+        if (dot) {
+            // Sorted by entity: sum each entity's run, then take off its armor.
+            // Armor is sampled as it stood at the start of the tick (its bucket
+            // counts down after this one), so armor running out mid-tick still
+            // blocks that whole tick's damage. Intended: at most one tick of
+            // overlap, and an effect never splits a tick into pieces.
+            const EffectBucket& armor = effects.bucket(EffectType::Armor);
+            int a = 0;
+            for (int i = 0; i < bucket.count;) {
+                flecs::entity_t entity = bucket.entities[(size_t)i];
+                float sum = 0.0f;
+                for (; i < bucket.count && bucket.entities[(size_t)i] == entity; i++) {
+                    sum += damage[(size_t)i];
+                }
+                float blocked = 0.0f;
+                while (a < armor.count && armor.entities[(size_t)a] < entity) {
+                    a++;
+                }
+                for (int j = a; j < armor.count && armor.entities[(size_t)j] == entity; j++) {
+                    blocked = std::max(blocked, armor.magnitude[(size_t)j]);
+                }
+                sum *= 1.0f - std::clamp(blocked, 0.0f, 1.0f);
+                if (sum > 0.0f) {
+                    buffer.add(entity, sum, components::DamageSource::Effect);
+                }
+            }
+        }
+
+        // Most ticks expire nothing, so the scalar compaction only runs when needed
+        if (removals != 0) {
+            expiredCount += compact(bucket, (EffectType)t, effects.expired);
+        }
+    }
+    return expiredCount;
+}
+
+void StatusEffectSystem::removeEntities(components::StatusEffects& effects,
+                                        const std::vector<flecs::entity_t>& sorted) {
+    if (sorted.empty()) {
+        return;
+    }
+    for (EffectBucket& bucket : effects.buckets) {
+        removeSorted(bucket, sorted);
+    }
+    std::erase_if(effects.pending, [&](const components::StatusEffects::Request& request) {
+        return std::binary_search(sorted.begin(), sorted.end(), request.entity);
+    });
+}
+
+float StatusEffectSystem::strongest(const components::StatusEffects& effects, flecs::entity_t entity,
+                                    EffectType type) {
+    const EffectBucket& bucket = effects.bucket(type);
+    float best = 0.0f;
+    for (int i = lowerBound(bucket, entity, 0); i < bucket.count && bucket.entities[(size_t)i] == entity; i++) {
+        best = std::max(best, bucket.magnitude[(size_t)i]);
+    }
+    return best;
+}
+
+float StatusEffectSystem::remaining(const components::StatusEffects& effects, flecs::entity_t entity,
+                                   EffectType type, uint32_t tag) {
+    const EffectBucket& bucket = effects.bucket(type);
+    int i = lowerBound(bucket, entity, tag);
+    if (i < bucket.count && bucket.entities[(size_t)i] == entity && bucket.tags[(size_t)i] == tag) {
+        return bucket.remaining[(size_t)i];
+    }
+    return 0.0f;
+}
+
+bool StatusEffectSystem::has(const components::StatusEffects& effects, flecs::entity_t entity, EffectType type) {
+    const EffectBucket& bucket = effects.bucket(type);
+    int i = lowerBound(bucket, entity, 0);
+    return i < bucket.count && bucket.entities[(size_t)i] == entity;
+}
+
+void StatusEffectSystem::registerSystem(flecs::world& world) {
+    world.system("StatusEffectSystem")
+        .kind(flecs::OnUpdate)
+        .run([](flecs::iter& it) {
+            flecs::world w = it.world();
+            auto effects = w.get_mut<components::StatusEffects>();
+            auto buffer = w.get_mut<components::DamageBuffer>();
+            if (effects && buffer) {
+                tick(*effects, it.delta_time(), *buffer);
+            }
+        });
+}
+
+} // namespace micro_idle
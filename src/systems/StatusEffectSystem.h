@@ -0,0 +1,61 @@
+#ifndef MICRO_IDLE_STATUS_EFFECT_SYSTEM_H
+#define MICRO_IDLE_STATUS_EFFECT_SYSTEM_H
+
+#include <flecs.h>
+#include <cstdint>
+#include <vector>
+#include "src/components/StatusEffects.h"
+
+namespace components {
+struct DamageBuffer;
+}
+
+namespace micro_idle {
+
+// StatusEffectSystem - ticks every timed effect and cooldown in the
+// StatusEffects singleton. Runs in OnUpdate phase, before DestructionSystem
+// applies the damage buffer.
+class StatusEffectSystem {
+public:
+    // Register the system with FLECS world
+    static void registerSystem(flecs::world& world);
+
+    // Fold pending requests into the buckets (tick() starts with this)
+    static void merge(components::StatusEffects& effects);
+
+    /**
+     * Merge requests, then count every bucket down by dt in one vectorized pass
+     *
+     * Damage-over-time for the elapsed part of dt is summed per entity, reduced
+     * by the entity's strongest armor and queued as DamageSource::Effect.
+     * Effects that ran out are removed and listed in effects.expired.
+     *
+     * @return Number of effects that expired
+     */
+    static int tick(components::StatusEffects& effects, float dt, components::DamageBuffer& buffer);
+
+    // Drop every effect and pending request on entities that died (sorted
+    // ascending); they are gone, not expired, so nothing is listed
+    static void removeEntities(components::StatusEffects& effects, const std::vector<flecs::entity_t>& sorted);
+
+    // Strongest magnitude of a type on an entity, over all tags (0 if none)
+    static float strongest(const components::StatusEffects& effects, flecs::entity_t entity,
+                           components::EffectType type);
+
+    // Seconds left on one (entity, tag) effect (0 if none)
+    static float remaining(const components::StatusEffects& effects, flecs::entity_t entity,
+                           components::EffectType type, uint32_t tag);
+
+    // Any effect of a type on an entity
+    static bool has(const components::StatusEffects& effects, flecs::entity_t entity,
+                    components::EffectType type);
+
+    // Ability off cooldown (owner 0 is the player)
+    static bool isReady(const components::StatusEffects& effects, flecs::entity_t owner, uint32_t ability) {
+        return remaining(effects, owner, components::EffectType::Cooldown, ability) <= 0.0f;
+    }
+};
+
+} // namespace micro_idle
+
+#endif
@@ -1,12 +1,14 @@
 #include "UpdateSDFUniforms.h"
 #include "src/components/Microbe.h"
 #include "src/components/Rendering.h"
-#include "src/systems/SoftBodyFactory.h"
+#include "src/systems/BodyPlanFactory.h"
+#include "src/math/BatchKernels.h"
 
 namespace micro_idle {
 
 void UpdateSDFUniforms::registerSystem(flecs::world& world, PhysicsSystemState* physics) {
-    // System that extracts vertex positions from soft bodies and updates shader uniforms
+    // System that extracts vertex positions from soft bodies (or sample points
+    // from rigid body plans) and updates shader uniforms
     // Runs in OnStore phase (after TransformSync, before rendering)
     world.system<components::Microbe, components::SDFRenderComponent>("UpdateSDFUniforms")
         .kind(flecs::OnStore)
@@ -16,15 +18,24 @@ void UpdateSDFUniforms::registerSystem(flecs::world& world, PhysicsSystemState*
                 return;
             }
 
-            // Extract vertex positions from Jolt soft body
-            int count = SoftBodyFactory::ExtractVertexPositions(
+            // Extract vertex positions from the Jolt body, with their bounds
+            // reduced in the same pass so the renderer never re-reads them
+            math::PointBounds bounds;
+            int count = BodyPlanFactory::ExtractSamplePoints(
                 physics,
-                microbe.softBody.bodyID,
+                microbe,
                 sdf.vertexPositions,
-                64
+                64,
+                &bounds
             );
 
             sdf.vertexCount = count;
+            if (count > 0) {
+                sdf.boundsMin = bounds.min.to_vector3();
+                sdf.boundsMax = bounds.max.to_vector3();
+                sdf.centroid = bounds.centroid.to_vector3();
+                sdf.extent = bounds.maxRadius;
+            }
         });
 }
 
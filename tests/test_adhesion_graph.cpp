@@ -0,0 +1,196 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/World.h"
+#include "src/components/Adhesion.h"
+#include "src/physics/AdhesionGraph.h"
+#include "src/physics/Icosphere.h"
+#include "src/physics/MembraneContacts.h"
+#include "src/physics/PhysicsRuntime.h"
+#include "src/systems/PhysicsSystem.h"
+#include <Jolt/Core/JobSystemThreadPool.h>
+#include <cmath>
+#include <vector>
+
+using namespace micro_idle;
+using Catch::Approx;
+
+namespace {
+
+constexpr float Dt = 1.0f / 60.0f;
+
+float gap(const AdhesionGraph& graph, int a, int b, const std::vector<Vector3>& start) {
+    Vector3 da = graph.getDisplacement(a);
+    Vector3 db = graph.getDisplacement(b);
+    float dx = start[(size_t)a].x + da.x - start[(size_t)b].x - db.x;
+    float dy = start[(size_t)a].y + da.y - start[(size_t)b].y - db.y;
+    float dz = start[(size_t)a].z + da.z - start[(size_t)b].z - db.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+// Two single-vertex membranes `distance` apart along x
+void addPair(AdhesionGraph& graph, float distance) {
+    Vector3 a{0.0f, 0.0f, 0.0f};
+    Vector3 b{distance, 0.0f, 0.0f};
+    graph.beginStep();
+    graph.addMembrane(1, 1.0f, &a, 1);
+    graph.addMembrane(2, 1.0f, &b, 1);
+}
+
+} // namespace
+
+TEST_CASE("AdhesionGraph - a requested bond pulls its vertices to rest length", "[adhesion]") {
+    AdhesionGraph graph;
+    addPair(graph, 0.15f);
+    graph.requestBond(2, 0, 1, 0);
+    graph.requestBond(1, 0, 2, 0);     // The other side of the same contact
+    REQUIRE(graph.solve(Dt, nullptr) == 1);
+    REQUIRE(graph.getLastCreated() == 1);
+
+    std::vector<Vector3> start = {{0.0f, 0.0f, 0.0f}, {0.15f, 0.0f, 0.0f}};
+    float after = gap(graph, 0, 1, start);
+    REQUIRE(after < 0.15f);
+    REQUIRE(after == Approx(graph.restLength).margin(0.01f));
+    REQUIRE(graph.getDisplacement(0).x == Approx(-graph.getDisplacement(1).x));
+
+    // The bond persists across steps without new requests
+    addPair(graph, 0.1f);
+    REQUIRE(graph.solve(Dt, nullptr) == 1);
+    REQUIRE(graph.getLastCreated() == 0);
+}
+
+TEST_CASE("AdhesionGraph - bonds break when overstretched or orphaned", "[adhesion]") {
+    AdhesionGraph graph;
+    addPair(graph, 0.1f);
+    graph.requestBond(1, 0, 2, 0);
+    REQUIRE(graph.solve(Dt, nullptr) == 1);
+
+    // Pulled far apart by the step: the bond snaps before it is solved
+    addPair(graph, 2.0f);
+    REQUIRE(graph.solve(Dt, nullptr) == 0);
+    REQUIRE(graph.getLastBroken() == 1);
+
+    // Requests past the break length are never created
+    addPair(graph, 2.0f);
+    graph.requestBond(1, 0, 2, 0);
+    REQUIRE(graph.solve(Dt, nullptr) == 0);
+
+    // A bond whose membrane is no longer gathered is dropped
+    addPair(graph, 0.1f);
+    graph.requestBond(1, 0, 2, 0);
+    REQUIRE(graph.solve(Dt, nullptr) == 1);
+    Vector3 a{0.0f, 0.0f, 0.0f};
+    graph.beginStep();
+    graph.addMembrane(1, 1.0f, &a, 1);
+    REQUIRE(graph.solve(Dt, nullptr) == 0);
+    REQUIRE(graph.getLastBroken() == 1);
+}
+
+TEST_CASE("AdhesionGraph - a vertex holds at most one bond", "[adhesion]") {
+    AdhesionGraph graph;
+    Vector3 a{0.0f, 0.0f, 0.0f};
+    Vector3 b[2] = {{0.1f, 0.0f, 0.0f}, {-0.1f, 0.0f, 0.0f}};
+    Vector3 c{0.0f, 0.1f, 0.0f};
+    graph.beginStep();
+    graph.addMembrane(1, 1.0f, &a, 1);
+    graph.addMembrane(2, 1.0f, b, 2);
+    graph.addMembrane(3, 1.0f, &c, 1);
+    graph.requestBond(1, 0, 2, 0);
+    graph.requestBond(1, 0, 2, 1);
+    graph.requestBond(3, 0, 1, 0);
+    graph.requestBond(2, 1, 3, 0);
+    REQUIRE(graph.solve(Dt, nullptr) == 2);
+    REQUIRE(graph.getLastCreated() == 2);
+}
+
+TEST_CASE("AdhesionGraph - a clump of hundreds of cells settles the same on any thread count", "[adhesion]") {
+    // A 20 x 20 grid of four-vertex cells, each bonded to its right and upper neighbour
+    constexpr int Side = 20;
+    auto build = [](AdhesionGraph& graph, float spacing) {
+        graph.beginStep();
+        for (int row = 0; row < Side; row++) {
+            for (int col = 0; col < Side; col++) {
+                float x = (float)col * spacing;
+                float z = (float)row * spacing;
+                Vector3 v[4] = {{x - 0.1f, 0.0f, z}, {x + 0.1f, 0.0f, z}, {x, 0.0f, z - 0.1f}, {x, 0.0f, z + 0.1f}};
+                graph.addMembrane((uint64_t)(row * Side + col + 1), 1.0f, v, 4);
+            }
+        }
+    };
+    auto bondAll = [](AdhesionGraph& graph) {
+        for (int row = 0; row < Side; row++) {
+            for (int col = 0; col < Side; col++) {
+                uint64_t key = (uint64_t)(row * Side + col + 1);
+                if (col + 1 < Side) {
+                    graph.requestBond(key, 1, key + 1, 0);
+                }
+                if (row + 1 < Side) {
+                    graph.requestBond(key, 3, key + Side, 2);
+                }
+            }
+        }
+    };
+
+    AdhesionGraph inlineRun;
+    AdhesionGraph threaded;
+    build(inlineRun, 0.3f);
+    build(threaded, 0.3f);
+    bondAll(inlineRun);
+    bondAll(threaded);
+    int bonds = 2 * Side * (Side - 1);
+    REQUIRE(inlineRun.solve(Dt, nullptr) == bonds);
+    REQUIRE(threaded.solve(Dt, PhysicsRuntime::jobSystem()) == bonds);
+    for (int i = 0; i < inlineRun.getVertexCount(); i++) {
+        Vector3 a = inlineRun.getDisplacement(i);
+        Vector3 b = threaded.getDisplacement(i);
+        REQUIRE(a.x == b.x);
+        REQUIRE(a.y == b.y);
+        REQUIRE(a.z == b.z);
+    }
+
+    // Stepping the clump again keeps every bond
+    for (int step = 0; step < 30; step++) {
+        build(inlineRun, 0.25f);
+        REQUIRE(inlineRun.solve(Dt, nullptr) == bonds);
+        REQUIRE(inlineRun.getLastBroken() == 0);
+    }
+}
+
+TEST_CASE("MembraneContacts - contact events name a vertex of the other membrane", "[adhesion]") {
+    MembraneContacts contacts;
+    IcosphereMesh mesh = GenerateIcosphere(1, 1.0f);
+    std::vector<Vector3> shifted;
+    for (const Vector3& v : mesh.vertices) {
+        shifted.push_back({v.x + 1.6f, v.y, v.z});
+    }
+    contacts.addMembrane(Layers::SKIN, 1.0f, mesh.vertices.data(), nullptr, mesh.vertexCount);
+    contacts.addMembrane(Layers::SKIN, 1.0f, shifted.data(), nullptr, mesh.vertexCount);
+    REQUIRE(contacts.solve(nullptr) > 0);
+
+    int events = 0;
+    for (int i = 0; i < contacts.getVertexCount(); i++) {
+        int partner = contacts.getContact(i);
+        if (partner >= 0) {
+            REQUIRE(contacts.getMembraneOf(partner) != contacts.getMembraneOf(i));
+            events++;
+        }
+    }
+    REQUIRE(events > 0);
+}
+
+TEST_CASE("World - touching adhesive amoebas bond", "[adhesion]") {
+    World world;
+    flecs::entity a = world.createAmoeba({0.0f, 1.5f, 0.0f}, 0.28f, (Color){120, 200, 170, 255});
+    flecs::entity b = world.createAmoeba({0.3f, 1.5f, 0.0f}, 0.28f, (Color){90, 180, 140, 255});
+    world.update(Dt);
+    REQUIRE(world.getAdhesion().getBondCount() == 0);
+
+    a.add<components::Adhesive>();
+    b.add<components::Adhesive>();
+    world.update(Dt);
+    REQUIRE(world.getAdhesion().getBondCount() > 0);
+
+    // Destroying one side releases its bonds on the next step
+    b.destruct();
+    world.update(Dt);
+    REQUIRE(world.getAdhesion().getBondCount() == 0);
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include "src/components/MicrobeIndex.h"
+#include "src/physics/SpatialGrid.h"
+#include "src/swarm/BacteriaSwarm.h"
+#include "src/systems/PhysicsSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace micro_idle;
+
+TEST_CASE("SpatialGrid - circles are found from every cell they overlap", "[swarm]") {
+    std::vector<float> xs = {0.0f, 3.0f, -3.5f};
+    std::vector<float> zs = {0.0f, 1.0f, -1.5f};
+    std::vector<float> radii = {0.8f, 0.2f, 0.2f};
+
+    SpatialGrid grid;
+    REQUIRE(grid.cellAt(0.0f, 0.0f) == -1);
+    grid.build(xs.data(), zs.data(), radii.data(), 3, 0.5f, -4.0f, -2.0f, 4.0f, 2.0f);
+    REQUIRE(grid.itemCount() == 3);
+
+    // Any point inside circle 0 reaches it with a single cell lookup
+    const float probes[][2] = {{0.0f, 0.0f}, {0.7f, 0.0f}, {-0.5f, 0.5f}, {0.0f, -0.75f}};
+    for (const auto& p : probes) {
+        int count = 0;
+        const int* items = grid.cellItems(grid.cellAt(p[0], p[1]), count);
+        REQUIRE(std::find(items, items + count, 0) != items + count);
+    }
+
+    // Outside-of-grid queries clamp to the edge cells
+    REQUIRE(grid.cellAt(-100.0f, -100.0f) == grid.cellAt(-3.9f, -1.9f));
+    REQUIRE(grid.cellAt(100.0f, 0.1f) == grid.cellAt(3.9f, 0.1f));
+
+    int visits = 0;
+    grid.forEachNear(3.0f, 1.0f, 0.1f, [&](int item) { visits += item == 1 ? 1 : 0; });
+    REQUIRE(visits >= 1);
+}
+
+TEST_CASE("BacteriaSwarm - agents stay inside the dish", "[swarm]") {
+    BacteriaSwarm swarm(7);
+    swarm.setCount(5000, 4.0f, 2.0f);
+    REQUIRE(swarm.size() == 5000);
+
+    for (int t = 0; t < 300; t++) {
+        swarm.step(1.0f / 60.0f, 4.0f, 2.0f, nullptr, nullptr);
+    }
+    // A huge step still ends inside
+    swarm.step(50.0f, 4.0f, 2.0f, nullptr, nullptr);
+
+    float limitX = 2.0f - swarm.params.agentRadius;
+    float limitZ = 1.0f - swarm.params.agentRadius;
+    for (int i = 0; i < swarm.size(); i++) {
+        REQUIRE(std::fabs(swarm.positionsX()[i]) <= limitX + 1e-4f);
+        REQUIRE(std::fabs(swarm.positionsZ()[i]) <= limitZ + 1e-4f);
+        float len = std::hypot(swarm.headingsX()[i], swarm.headingsZ()[i]);
+        REQUIRE(std::fabs(len - 1.0f) < 1e-3f);
+    }
+}
+
+TEST_CASE("BacteriaSwarm - agents are pushed out of microbe footprints", "[swarm]") {
+    components::MicrobeIndex index;
+    index.entities = {1, 2};
+    index.x = {0.0f, 1.2f};
+    index.z = {0.0f, 0.4f};
+    index.radius = {0.6f, 0.3f};
+    index.grid.build(index.x.data(), index.z.data(), index.radius.data(), index.size(),
+                     0.6f, -2.0f, -1.0f, 2.0f, 1.0f);
+
+    BacteriaSwarm swarm(11);
+    swarm.setCount(4000, 4.0f, 2.0f);
+    for (int t = 0; t < 60; t++) {
+        swarm.step(1.0f / 60.0f, 4.0f, 2.0f, &index, nullptr);
+    }
+
+    for (int i = 0; i < swarm.size(); i++) {
+        for (int j = 0; j < index.size(); j++) {
+            float dx = swarm.positionsX()[i] - index.x[(size_t)j];
+            float dz = swarm.positionsZ()[i] - index.z[(size_t)j];
+            float reach = index.radius[(size_t)j] + swarm.params.agentRadius;
+            REQUIRE(dx * dx + dz * dz >= reach * reach * 0.999f);
+        }
+    }
+}
+
+TEST_CASE("BacteriaSwarm - result does not depend on worker threads", "[swarm]") {
+    PhysicsSystemState* physics = new PhysicsSystemState();
+
+    // Several chunks, the last one partial, and a resize partway through
+    const int count = BacteriaSwarm::ChunkSize * 3 + 77;
+    BacteriaSwarm inlineSwarm(42);
+    BacteriaSwarm threadedSwarm(42);
+    inlineSwarm.setCount(count, 6.0f, 3.0f);
+    threadedSwarm.setCount(count, 6.0f, 3.0f);
+
+    for (int t = 0; t < 120; t++) {
+        if (t == 60) {
+            inlineSwarm.setCount(count + 1000, 6.0f, 3.0f);
+            threadedSwarm.setCount(count + 1000, 6.0f, 3.0f);
+        }
+        inlineSwarm.step(1.0f / 60.0f, 6.0f, 3.0f, nullptr, nullptr);
+        threadedSwarm.step(1.0f / 60.0f, 6.0f, 3.0f, nullptr, physics->jobSystem);
+    }
+
+    size_t bytes = sizeof(float) * (size_t)inlineSwarm.size();
+    REQUIRE(std::memcmp(inlineSwarm.positionsX(), threadedSwarm.positionsX(), bytes) == 0);
+    REQUIRE(std::memcmp(inlineSwarm.positionsZ(), threadedSwarm.positionsZ(), bytes) == 0);
+    REQUIRE(std::memcmp(inlineSwarm.headingsX(), threadedSwarm.headingsX(), bytes) == 0);
+
+    delete physics;
+}
@@ -0,0 +1,143 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/World.h"
+#include "src/components/ECMLocomotion.h"
+#include "src/components/Microbe.h"
+#include "src/components/Rendering.h"
+#include "src/components/Transform.h"
+#include "src/components/WorldState.h"
+#include "src/systems/BodyPlanFactory.h"
+#include "src/systems/PhysicsSystem.h"
+#include <Jolt/Physics/Body/Body.h>
+#include <Jolt/Physics/Body/BodyInterface.h>
+#include <Jolt/Physics/Body/BodyLockInterface.h>
+#include <cmath>
+
+using namespace micro_idle;
+using Catch::Approx;
+
+namespace {
+
+const components::MicrobeType RigidTypes[] = {
+    components::MicrobeType::Coccus,
+    components::MicrobeType::Bacillus,
+    components::MicrobeType::Vibrio,
+    components::MicrobeType::Spirillum,
+    components::MicrobeType::Icosahedral,
+    components::MicrobeType::Bacteriophage
+};
+
+bool isRigidBody(World& world, JPH::BodyID bodyID) {
+    JPH::BodyLockRead lock(world.physics->physicsSystem->GetBodyLockInterface(), bodyID);
+    return lock.Succeeded() && lock.GetBody().IsRigidBody();
+}
+
+} // namespace
+
+TEST_CASE("BodyPlanFactory - protists are soft, bacteria and viruses rigid", "[body_plans]") {
+    for (int t = 0; t < components::MicrobeTypeCount; t++) {
+        auto type = (components::MicrobeType)t;
+        const BodyPlan& plan = BodyPlanFactory::GetPlan(type);
+        bool protist = t < (int)components::MicrobeType::Coccus;
+        REQUIRE(BodyPlanFactory::IsRigid(plan.kind) == !protist);
+
+        if (!protist) {
+            // Smaller than a protist, and the SDF path gets a bounded point set
+            REQUIRE(plan.sizeScale < 1.0f);
+            REQUIRE(plan.reach >= 1.0f);
+            size_t samples = BodyPlanFactory::GetSamplePoints(type).size();
+            REQUIRE(samples >= 4);
+            REQUIRE(samples <= 64);
+        }
+    }
+
+    // Rods reach past their radius along the spine
+    REQUIRE(BodyPlanFactory::GetPlan(components::MicrobeType::Bacillus).reach == Approx(2.5f));
+    REQUIRE(BodyPlanFactory::GetPlan(components::MicrobeType::Bacteriophage).reach == Approx(3.0f));
+}
+
+TEST_CASE("BodyPlanFactory - rigid microbes share the microbe components", "[body_plans]") {
+    World world;
+    world.createScreenBoundaries(20.0f, 20.0f);
+
+    float x = -7.5f;
+    for (auto type : RigidTypes) {
+        auto e = world.createMicrobe(type, {x, 1.0f, 0.0f}, 0.1f, RED);
+        x += 3.0f;
+
+        auto microbe = e.get<components::Microbe>();
+        REQUIRE(microbe != nullptr);
+        REQUIRE(microbe->type == type);
+        REQUIRE(BodyPlanFactory::IsRigid(microbe->plan));
+        REQUIRE(isRigidBody(world, microbe->softBody.bodyID));
+        REQUIRE(e.has<components::SDFRenderComponent>());
+        REQUIRE_FALSE(e.has<components::ECMLocomotion>());
+    }
+
+    for (int i = 0; i < 90; i++) {
+        world.update(1.0f / 60.0f);
+    }
+
+    world.getWorld().each([](const components::Microbe& microbe,
+                             const components::Transform& transform,
+                             const components::SDFRenderComponent& sdf) {
+        // Settled on the floor without tipping over
+        REQUIRE(transform.position.y < 0.6f);
+        REQUIRE(transform.position.y > 0.0f);
+        REQUIRE(std::fabs(transform.rotation.x) < 1e-3f);
+        REQUIRE(std::fabs(transform.rotation.z) < 1e-3f);
+
+        // Sample points follow the body
+        const auto& samples = BodyPlanFactory::GetSamplePoints(microbe.type);
+        REQUIRE(sdf.vertexCount == (int)samples.size());
+        float reach = microbe.stats.baseRadius * BodyPlanFactory::GetPlan(microbe.type).reach;
+        for (int i = 0; i < sdf.vertexCount; i++) {
+            float dx = sdf.vertexPositions[i].x - transform.position.x;
+            float dz = sdf.vertexPositions[i].z - transform.position.z;
+            REQUIRE(std::sqrt(dx * dx + dz * dz) <= reach * 1.5f);
+        }
+    });
+}
+
+TEST_CASE("BodyPlanFactory - removing a microbe frees its body", "[body_plans]") {
+    World world;
+    world.createScreenBoundaries(20.0f, 20.0f);
+    auto rod = world.createMicrobe(components::MicrobeType::Bacillus, {0.0f, 1.0f, 0.0f}, 0.1f, RED);
+    auto amoeba = world.createAmoeba({3.0f, 1.5f, 0.0f}, 0.3f, GREEN);
+    JPH::BodyID rodBody = rod.get<components::Microbe>()->softBody.bodyID;
+    JPH::BodyID amoebaBody = amoeba.get<components::Microbe>()->softBody.bodyID;
+
+    JPH::BodyInterface& bodies = world.physics->physicsSystem->GetBodyInterface();
+    REQUIRE(bodies.IsAdded(rodBody));
+    REQUIRE(bodies.IsAdded(amoebaBody));
+
+    rod.destruct();
+    amoeba.destruct();
+    REQUIRE_FALSE(bodies.IsAdded(rodBody));
+    REQUIRE_FALSE(bodies.IsAdded(amoebaBody));
+}
+
+TEST_CASE("BodyPlanFactory - populations of every type spawn", "[body_plans]") {
+    World world(7);
+    world.getWorld().get_mut<components::WorldState>()->spawnEnabled = false;
+    world.createScreenBoundaries(20.0f, 20.0f);
+
+    for (auto type : RigidTypes) {
+        REQUIRE(world.spawnPopulation(type, 20) == 20);
+    }
+    REQUIRE(world.spawnPopulation(components::MicrobeType::Amoeba, 2) == 2);
+    REQUIRE(world.getWorld().count<components::Microbe>() == 122);
+    REQUIRE(world.getWorld().count<components::ECMLocomotion>() == 2);
+
+    // Bacteria and viruses are scaled down from the protist spawn radius (0.2 - 0.35)
+    world.getWorld().each([](const components::Microbe& microbe) {
+        if (BodyPlanFactory::IsRigid(microbe.plan)) {
+            REQUIRE(microbe.stats.baseRadius < 0.35f * 0.35f + 1e-4f);
+        }
+    });
+
+    for (int i = 0; i < 10; i++) {
+        world.update(1.0f / 60.0f);
+    }
+    REQUIRE(world.getWorld().count<components::Microbe>() == 122);
+}
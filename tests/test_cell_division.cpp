@@ -0,0 +1,189 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/World.h"
+#include "src/components/ECMLocomotion.h"
+#include "src/physics/BodyPool.h"
+#include "src/systems/BodyPlanFactory.h"
+#include "src/systems/SoftBodyFactory.h"
+#include "src/systems/PhysicsSystem.h"
+#include "tests/test_fixtures.h"
+#include <Jolt/Physics/Body/BodyInterface.h>
+#include <Jolt/Physics/Body/BodyLockInterface.h>
+#include <Jolt/Physics/SoftBody/SoftBodyMotionProperties.h>
+#include <cmath>
+#include <vector>
+
+using namespace micro_idle;
+using Catch::Approx;
+using components::MicrobeType;
+
+namespace {
+
+components::Microbe makeAmoeba(PhysicsSystemState* physics, Vector3 position, float radius) {
+    components::Microbe microbe;
+    microbe.stats.seed = 0.25f;
+    microbe.stats.baseRadius = radius;
+    microbe.stats.color = WHITE;
+    microbe.stats.health = 100.0f;
+    microbe.stats.energy = 80.0f;
+    std::vector<JPH::BodyID> skeleton;
+    REQUIRE(BodyPlanFactory::CreateBody(physics, MicrobeType::Amoeba, position, radius, 0.0f, microbe, skeleton));
+    return microbe;
+}
+
+} // namespace
+
+TEST_CASE_METHOD(PhysicsFixture, "BodyPlanFactory - division makes two half-volume daughters", "[cell_division]") {
+    JPH::BodyInterface& bodies = physics->physicsSystem->GetBodyInterface();
+    components::Microbe parent = makeAmoeba(physics, {0.0f, 1.0f, 0.0f}, 0.6f);
+
+    components::Microbe a;
+    components::Microbe b;
+    REQUIRE(BodyPlanFactory::Divide(physics, parent, 0.0f, a, b));
+
+    float radius = 0.6f / std::cbrt(2.0f);
+    REQUIRE(a.stats.baseRadius == Approx(radius));
+    REQUIRE(b.stats.baseRadius == Approx(radius));
+    REQUIRE(a.stats.energy == Approx(40.0f));
+    REQUIRE(b.stats.energy == Approx(40.0f));
+    REQUIRE(a.stats.seed != b.stats.seed);
+    REQUIRE(a.softBody.vertexCount == parent.softBody.vertexCount);
+    REQUIRE(b.softBody.vertexCount == parent.softBody.vertexCount);
+
+    // Daughters are in the simulation on either side of the split; the parent is pooled
+    REQUIRE(bodies.IsAdded(a.softBody.bodyID));
+    REQUIRE(bodies.IsAdded(b.softBody.bodyID));
+    REQUIRE_FALSE(bodies.IsAdded(parent.softBody.bodyID));
+    REQUIRE(physics->bodyPool->size() == 1);
+    JPH::RVec3 ca = bodies.GetCenterOfMassPosition(a.softBody.bodyID);
+    JPH::RVec3 cb = bodies.GetCenterOfMassPosition(b.softBody.bodyID);
+    REQUIRE((float)(ca.GetX() - cb.GetX()) == Approx(2.0f * radius).margin(0.05f));
+
+    // Rigid plans do not divide
+    components::Microbe rod;
+    rod.stats = parent.stats;
+    std::vector<JPH::BodyID> skeleton;
+    REQUIRE(BodyPlanFactory::CreateBody(physics, MicrobeType::Bacillus, {2.0f, 1.0f, 0.0f}, 0.2f, 0.0f, rod, skeleton));
+    REQUIRE_FALSE(BodyPlanFactory::Divide(physics, rod, 0.0f, a, b));
+}
+
+TEST_CASE_METHOD(PhysicsFixture, "BodyPlanFactory - daughters start from the parent's current shape", "[cell_division]") {
+    components::Microbe parent = makeAmoeba(physics, {0.0f, 1.0f, 0.0f}, 0.5f);
+
+    // Stretch the parent along x, as a pseudopod would
+    {
+        JPH::BodyLockWrite lock(physics->physicsSystem->GetBodyLockInterface(), parent.softBody.bodyID);
+        REQUIRE(lock.Succeeded());
+        auto* motion = static_cast<JPH::SoftBodyMotionProperties*>(lock.GetBody().GetMotionProperties());
+        for (JPH::SoftBodyVertex& vertex : motion->GetVertices()) {
+            vertex.mPosition.SetX(vertex.mPosition.GetX() * 1.5f);
+            vertex.mVelocity = JPH::Vec3(0.2f, 0.0f, 0.0f);
+        }
+    }
+    std::vector<Vector3> before;
+    std::vector<Vector3> velocities;
+    Vector3 center;
+    int count = SoftBodyFactory::ReadVertexState(physics, parent.softBody.bodyID, before, velocities, center);
+    REQUIRE(count == parent.softBody.vertexCount);
+
+    components::Microbe a;
+    components::Microbe b;
+    REQUIRE(BodyPlanFactory::Divide(physics, parent, 1.0f, a, b));
+
+    std::vector<Vector3> after;
+    REQUIRE(SoftBodyFactory::ReadVertexState(physics, a.softBody.bodyID, after, velocities, center) == count);
+    float scale = 1.0f / std::cbrt(2.0f);
+    for (int i = 0; i < count; i++) {
+        REQUIRE(after[(size_t)i].x == Approx(before[(size_t)i].x * scale).margin(1e-4f));
+        REQUIRE(after[(size_t)i].z == Approx(before[(size_t)i].z * scale).margin(1e-4f));
+        REQUIRE(velocities[(size_t)i].x == Approx(0.2f));
+    }
+}
+
+TEST_CASE_METHOD(PhysicsFixture, "SoftBodyFactory - removed amoebas are reused from the pool", "[cell_division]") {
+    JPH::BodyInterface& bodies = physics->physicsSystem->GetBodyInterface();
+    std::vector<JPH::BodyID> skeleton;
+    JPH::BodyID first = SoftBodyFactory::CreateAmoeba(physics, {0.0f, 1.0f, 0.0f}, 0.4f, 1, skeleton);
+    JPH::uint bodyCount = physics->physicsSystem->GetNumBodies();
+
+    SoftBodyFactory::ReleaseAmoeba(physics, first);
+    REQUIRE_FALSE(bodies.IsAdded(first));
+    REQUIRE(physics->bodyPool->size() == 1);
+
+    // Same size: the pooled body comes back at rest in its new place
+    JPH::BodyID second = SoftBodyFactory::CreateAmoeba(physics, {3.0f, 1.0f, 0.0f}, 0.4f, 1, skeleton);
+    REQUIRE(second == first);
+    REQUIRE(bodies.IsAdded(second));
+    REQUIRE(physics->bodyPool->getReuseCount() == 1);
+    REQUIRE(physics->physicsSystem->GetNumBodies() == bodyCount);
+    REQUIRE((float)bodies.GetCenterOfMassPosition(second).GetX() == Approx(3.0f));
+
+    // Another size builds a new body
+    SoftBodyFactory::ReleaseAmoeba(physics, second);
+    JPH::BodyID third = SoftBodyFactory::CreateAmoeba(physics, {0.0f, 1.0f, 0.0f}, 0.3f, 1, skeleton);
+    REQUIRE(third != first);
+    REQUIRE(physics->bodyPool->size() == 1);
+}
+
+TEST_CASE("SoftBodyFactory - continuous spawn radii fall into a few size buckets", "[cell_division]") {
+    // SpawnSystem draws 0.2 to 0.35; every radius is built within 2% of itself
+    int lowest = SoftBodyFactory::SizeBucket(0.2f);
+    int highest = SoftBodyFactory::SizeBucket(0.35f);
+    REQUIRE(highest - lowest + 1 <= 16);
+    for (int i = 0; i <= 100; i++) {
+        float radius = 0.2f + 0.15f * (float)i / 100.0f;
+        int bucket = SoftBodyFactory::SizeBucket(radius);
+        REQUIRE(bucket >= lowest);
+        REQUIRE(bucket <= highest);
+        REQUIRE(SoftBodyFactory::BucketRadius(bucket) == Approx(radius).epsilon(0.021f));
+    }
+}
+
+TEST_CASE_METHOD(DishFixture, "World - spawn, death and spawn at a similar size reuses the body", "[cell_division]") {
+    float bucketRadius = SoftBodyFactory::BucketRadius(SoftBodyFactory::SizeBucket(0.3f));
+
+    flecs::entity first = world.createAmoeba({0.0f, 1.0f, 0.0f}, bucketRadius * 0.995f, WHITE);
+    step();
+    JPH::BodyID body = first.get<components::Microbe>()->softBody.bodyID;
+    int reused = world.physics->bodyPool->getReuseCount();
+    first.destruct();
+
+    // A different radius from the same bucket takes the pooled body back
+    flecs::entity second = world.createAmoeba({2.0f, 1.0f, 0.0f}, bucketRadius * 1.01f, WHITE);
+    REQUIRE(second.get<components::Microbe>()->softBody.bodyID == body);
+    REQUIRE(world.physics->bodyPool->getReuseCount() == reused + 1);
+    REQUIRE(second.get<components::Microbe>()->stats.baseRadius == Approx(bucketRadius * 1.01f));
+    step();
+    REQUIRE(world.physics->physicsSystem->GetBodyInterface().IsAdded(body));
+}
+
+TEST_CASE("World - a dividing microbe passes its cortex state to both daughters", "[cell_division]") {
+    World world;
+    flecs::entity parent = world.createAmoeba({0.0f, 1.0f, 0.0f}, 0.5f, (Color){120, 200, 170, 255});
+    world.update(1.0f / 60.0f);
+
+    components::ECMLocomotion before = *parent.get<components::ECMLocomotion>();
+    int microbes = world.getWorld().count<components::Microbe>();
+
+    flecs::entity daughter = world.divideMicrobe(parent, 0.5f);
+    REQUIRE(daughter.is_alive());
+    REQUIRE(world.getWorld().count<components::Microbe>() == microbes + 1);
+
+    for (flecs::entity e : {parent, daughter}) {
+        const auto* microbe = e.get<components::Microbe>();
+        const auto* locomotion = e.get<components::ECMLocomotion>();
+        REQUIRE(microbe->stats.baseRadius == Approx(0.5f / std::cbrt(2.0f)));
+        REQUIRE(locomotion != nullptr);
+        for (int i = 0; i < components::ECMLocomotion::CortexSamples; i++) {
+            REQUIRE(locomotion->memory[i] == before.memory[i]);
+            REQUIRE(locomotion->inhibitor[i] == before.inhibitor[i]);
+        }
+    }
+    REQUIRE(daughter.get<components::ECMLocomotion>()->rng.state != parent.get<components::ECMLocomotion>()->rng.state);
+
+    // Both keep simulating; destroying one pools its body
+    world.update(1.0f / 60.0f);
+    int pooled = world.physics->bodyPool->size();
+    daughter.destruct();
+    REQUIRE(world.physics->bodyPool->size() == pooled + 1);
+}
@@ -0,0 +1,211 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "src/components/ChainReaction.h"
+#include "src/components/Damage.h"
+#include "src/components/Input.h"
+#include "src/components/Microbe.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/Transform.h"
+#include "src/components/Upgrades.h"
+#include "src/systems/ChainReactionSystem.h"
+#include "tests/test_fixtures.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace micro_idle;
+using Catch::Approx;
+
+namespace {
+
+constexpr float Dt = 1.0f / 60.0f;
+
+// Side x side microbes 0.5 apart, centred on the origin; entity ids are 1-based slots
+void buildLattice(components::MicrobeIndex& index, int side) {
+    float half = (float)(side - 1) * 0.25f;
+    for (int row = 0; row < side; row++) {
+        for (int col = 0; col < side; col++) {
+            index.entities.push_back((flecs::entity_t)(row * side + col + 1));
+            index.x.push_back((float)col * 0.5f - half);
+            index.z.push_back((float)row * 0.5f - half);
+            index.radius.push_back(0.2f);
+        }
+    }
+    index.grid.build(index.x.data(), index.z.data(), index.radius.data(), index.size(), 0.4f,
+                     -half - 1.0f, -half - 1.0f, half + 1.0f, half + 1.0f);
+}
+
+// Every blast in the buffer kills: its target detonates, as DestructionSystem would do
+void killBlasted(components::ChainReactions& chains, const components::MicrobeIndex& index,
+                 components::DamageBuffer& buffer) {
+    for (flecs::entity_t e : buffer.entities) {
+        size_t slot = (size_t)e - 1;
+        REQUIRE(ChainReactionSystem::detonate(chains, e, index.x[slot], index.z[slot]));
+    }
+    buffer.clear();
+}
+
+} // namespace
+
+TEST_CASE("ChainReactionSystem - a wave reaches every microbe once, within the tick budget", "[chain_reaction]") {
+    components::MicrobeIndex index;
+    buildLattice(index, 30);
+    components::ChainReactions chains;
+    chains.hopsPerTick = 32;
+    components::DamageBuffer buffer;
+
+    flecs::entity_t centre = (flecs::entity_t)(15 * 30 + 15 + 1);
+    REQUIRE(ChainReactionSystem::trigger(chains, centre, index.x[centre - 1], index.z[centre - 1], 60.0f, 100) != 0);
+
+    std::vector<int> hits((size_t)index.size() + 1, 0);
+    int fired = 0;
+    int ticks = 0;
+    while (chains.pending() > 0 && ticks < 1000) {
+        int step = ChainReactionSystem::step(chains, index, Dt, buffer);
+        REQUIRE(step <= chains.hopsPerTick);
+        fired += step;
+        for (flecs::entity_t e : buffer.entities) {
+            hits[(size_t)e]++;
+        }
+        killBlasted(chains, index, buffer);
+        ticks++;
+    }
+    REQUIRE(fired == 2 * index.size() - 1);     // Every microbe detonates, all but the source are blasted
+    REQUIRE(ticks > 1799 / 32);                 // Spread over many ticks
+    REQUIRE(hits[(size_t)centre] == 0);         // The source is already dead
+    for (int e = 1; e <= index.size(); e++) {
+        if ((flecs::entity_t)e != centre) {
+            REQUIRE(hits[(size_t)e] == 1);
+        }
+    }
+    REQUIRE(chains.waves.empty());
+}
+
+TEST_CASE("ChainReactionSystem - hops wait their delay and lose damage with distance", "[chain_reaction]") {
+    components::MicrobeIndex index;
+    buildLattice(index, 5);
+    components::ChainReactions chains;
+    chains.hopDelay = 0.1f;
+    components::DamageBuffer buffer;
+
+    flecs::entity_t centre = 13;
+    ChainReactionSystem::trigger(chains, centre, 0.0f, 0.0f, 50.0f, 2);
+
+    // The source fires at once; its neighbours only after the delay
+    REQUIRE(ChainReactionSystem::step(chains, index, Dt, buffer) == 1);
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(ChainReactionSystem::step(chains, index, Dt, buffer) == 0);
+    for (int tick = 0; tick < 6 && buffer.size() == 0; tick++) {
+        ChainReactionSystem::step(chains, index, Dt, buffer);
+    }
+    // The four nearest (one lattice step away) take the full damage
+    REQUIRE(buffer.size() == chains.maxFanout);
+    std::vector<flecs::entity_t> first = buffer.entities;
+    std::sort(first.begin(), first.end());
+    REQUIRE(first == std::vector<flecs::entity_t>{8, 12, 14, 18});
+    REQUIRE(buffer.amounts[0] == Approx(50.0f));
+
+    // The first ring dies of it; the second takes the falloff, and the wave stops after its two hops
+    killBlasted(chains, index, buffer);
+    std::vector<float> second;
+    for (int tick = 0; tick < 60; tick++) {
+        ChainReactionSystem::step(chains, index, Dt, buffer);
+        second.insert(second.end(), buffer.amounts.begin(), buffer.amounts.end());
+        killBlasted(chains, index, buffer);
+    }
+    REQUIRE_FALSE(second.empty());
+    for (float amount : second) {
+        REQUIRE(amount == Approx(50.0f * chains.falloff));
+    }
+    REQUIRE(chains.pending() == 0);
+    REQUIRE(chains.waves.empty());
+}
+
+TEST_CASE("ChainReactionSystem - blasts that do not kill end the wave", "[chain_reaction]") {
+    components::MicrobeIndex index;
+    buildLattice(index, 5);
+    components::ChainReactions chains;
+    components::DamageBuffer buffer;
+
+    ChainReactionSystem::trigger(chains, 13, 0.0f, 0.0f, 50.0f, 4);
+    int blasted = 0;
+    for (int tick = 0; tick < 60; tick++) {
+        ChainReactionSystem::step(chains, index, Dt, buffer);
+        blasted += buffer.size();
+        buffer.clear();                         // Everyone survives
+    }
+    REQUIRE(blasted == chains.maxFanout);
+    REQUIRE_FALSE(ChainReactionSystem::detonate(chains, 8, 0.0f, -0.5f));
+    REQUIRE(chains.pending() == 0);
+    REQUIRE(chains.waves.empty());
+}
+
+TEST_CASE_METHOD(DishFixture, "World - a click kill with the Sodium upgrade sets off a chain reaction", "[chain_reaction]") {
+    ecs.get_mut<components::PlayerUpgrades>()->chainReaction = 1;
+
+    // A tight row: the clicked one dies and blasts the next, which dies too and
+    // blasts the third; that one survives, so the wave stops short of the fourth
+    std::vector<flecs::entity> row;
+    for (int i = 0; i < 5; i++) {
+        row.push_back(world.createMicrobe(components::MicrobeType::Coccus, {(float)i * 0.6f, 0.5f, 0.0f}, 0.2f, WHITE));
+    }
+    step();
+    row[0].get_mut<components::Microbe>()->stats.health = 1.0f;
+    row[1].get_mut<components::Microbe>()->stats.health = 1.0f;
+    Vector3 clicked = row[0].get<components::Transform>()->position;
+
+    auto input = ecs.get_mut<components::InputState>();
+    input->injected = true;
+    input->mouseWorld = {clicked.x, 0.0f, clicked.z};
+    input->mouseWorldValid = true;
+    input->mouseLeftPressed = true;
+    step();
+    input = ecs.get_mut<components::InputState>();
+    input->mouseLeftPressed = false;
+    input->mouseWorldValid = false;
+    REQUIRE_FALSE(row[0].is_alive());
+    REQUIRE(ecs.get<components::ChainReactions>()->pending() > 0);
+
+    step(60);
+    REQUIRE(ecs.get<components::ChainReactions>()->pending() == 0);
+    REQUIRE_FALSE(row[1].is_alive());
+    REQUIRE(row[2].get<components::Microbe>()->stats.health < 100.0f);
+    REQUIRE(row[3].get<components::Microbe>()->stats.health == 100.0f);
+}
+
+// Hidden: run with `tests "[.benchmark]"`
+TEST_CASE("ChainReactionSystem - a huge cascade stays within its tick budget", "[chain_reaction][.benchmark]") {
+    // hopsPerTick bounds the work per tick however large the wave gets; the
+    // worst tick must stay a small slice of a 60 Hz frame
+    constexpr double BudgetMs = 1.0;
+
+    components::MicrobeIndex index;
+    buildLattice(index, 100);
+    components::DamageBuffer buffer;
+
+    components::ChainReactions chains;
+    ChainReactionSystem::trigger(chains, 5051, 0.0f, 0.0f, 60.0f, 1000);
+    double worst = 0.0;
+    int ticks = 0;
+    while (chains.pending() > 0) {
+        auto start = std::chrono::steady_clock::now();
+        ChainReactionSystem::step(chains, index, Dt, buffer);
+        worst = std::max(worst, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        killBlasted(chains, index, buffer);
+        ticks++;
+    }
+    printf("Chain reaction: %d microbes over %d ticks, worst tick %.3f ms (budget %.1f ms)\n", index.size(), ticks,
+           worst, BudgetMs);
+    REQUIRE(worst < BudgetMs);
+
+    BENCHMARK("One budgeted tick of a 10000-microbe cascade") {
+        if (chains.pending() == 0) {
+            ChainReactionSystem::trigger(chains, 5051, 0.0f, 0.0f, 60.0f, 1000);
+        }
+        int fired = ChainReactionSystem::step(chains, index, Dt, buffer);
+        killBlasted(chains, index, buffer);
+        return fired;
+    };
+}
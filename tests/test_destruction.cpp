@@ -0,0 +1,154 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/components/Damage.h"
+#include "src/components/Input.h"
+#include "src/components/Microbe.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/RandomStreams.h"
+#include "src/components/Resource.h"
+#include "src/components/Transform.h"
+#include "src/components/Upgrades.h"
+#include "src/systems/DestructionSystem.h"
+#include "tests/test_fixtures.h"
+#include <vector>
+
+using namespace micro_idle;
+using Catch::Approx;
+using components::DamageSource;
+
+namespace {
+
+flecs::entity addMicrobe(flecs::world& world, float x, float z, float health) {
+    components::Microbe microbe{};
+    microbe.stats.baseRadius = 0.2f;
+    microbe.stats.health = health;
+    return world.entity()
+        .set<components::Microbe>(microbe)
+        .set<components::Transform>({.position = {x, 0.0f, z}, .rotation = {0.0f, 0.0f, 0.0f, 1.0f}, .scale = {1.0f, 1.0f, 1.0f}});
+}
+
+void buildIndex(components::MicrobeIndex& index, const std::vector<flecs::entity>& microbes) {
+    for (flecs::entity e : microbes) {
+        Vector3 p = e.get<components::Transform>()->position;
+        index.entities.push_back(e.id());
+        index.x.push_back(p.x);
+        index.z.push_back(p.z);
+        index.radius.push_back(0.2f);
+    }
+    index.grid.build(index.x.data(), index.z.data(), index.radius.data(), index.size(), 0.4f, -10.0f, -10.0f, 10.0f, 10.0f);
+}
+
+} // namespace
+
+TEST_CASE_METHOD(EcsFixture, "DestructionSystem - a disc queues each overlapped microbe once", "[destruction]") {
+    std::vector<flecs::entity> microbes = {
+        addMicrobe(world, 0.0f, 0.0f, 100.0f),
+        addMicrobe(world, 0.5f, 0.0f, 100.0f),
+        addMicrobe(world, 3.0f, 0.0f, 100.0f),
+    };
+    components::MicrobeIndex index;
+    buildIndex(index, microbes);
+
+    components::DamageBuffer buffer;
+    REQUIRE(DestructionSystem::queueDiscDamage(index, 0.2f, 0.0f, 0.6f, 5.0f, DamageSource::Hover, buffer) == 2);
+    REQUIRE(buffer.size() == 2);
+    REQUIRE(buffer.sources[0] == (uint8_t)DamageSource::Hover);
+
+    // A bigger disc reaches the far one too
+    buffer.clear();
+    REQUIRE(DestructionSystem::queueDiscDamage(index, 0.2f, 0.0f, 3.0f, 5.0f, DamageSource::Hover, buffer) == 3);
+}
+
+TEST_CASE_METHOD(EcsFixture, "DestructionSystem - the damage buffer is applied and deaths are batched", "[destruction]") {
+    world.component<components::ResourceDrops>();
+    world.set<components::ResourceDrops>({});
+    components::RandomStreams streams;
+    streams.reseed(7);
+    world.set<components::RandomStreams>(streams);
+
+    // More microbes than one lane block, with hits out of entity order
+    std::vector<flecs::entity> microbes;
+    for (int i = 0; i < 20; i++) {
+        microbes.push_back(addMicrobe(world, (float)i, 0.0f, 10.0f));
+    }
+    components::DamageBuffer buffer;
+    for (int i = 19; i >= 0; i--) {
+        buffer.add(microbes[(size_t)i].id(), 4.0f, DamageSource::Hover);
+    }
+    // Two more hits on every third microbe: summed, they are lethal
+    for (int i = 0; i < 20; i += 3) {
+        buffer.add(microbes[(size_t)i].id(), 3.0f, DamageSource::Click);
+        buffer.add(microbes[(size_t)i].id(), 3.0f, DamageSource::Effect);
+    }
+    // Hits on entities that are already gone are ignored
+    flecs::entity gone = addMicrobe(world, 0.0f, 5.0f, 1.0f);
+    buffer.add(gone.id(), 50.0f, DamageSource::Click);
+    gone.destruct();
+
+    REQUIRE(DestructionSystem::applyDamage(world, buffer) == 7);
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(world.get<components::ResourceDrops>()->size() == 7);
+    for (int i = 0; i < 20; i++) {
+        if (i % 3 == 0) {
+            REQUIRE_FALSE(microbes[(size_t)i].is_alive());
+        } else {
+            REQUIRE(microbes[(size_t)i].get<components::Microbe>()->stats.health == Approx(6.0f));
+        }
+    }
+}
+
+TEST_CASE_METHOD(DishFixture, "World - a wide hover disc damages a crowd over time", "[destruction]") {
+    populate(components::MicrobeType::Coccus, 40);
+    auto input = ecs.get_mut<components::InputState>();
+    input->injected = true;
+    input->mouseWorld = {0.0f, 0.0f, 0.0f};
+    input->mouseWorldValid = true;
+    ecs.get_mut<components::PlayerUpgrades>()->hoverRadius = 100;    // Covers the whole dish
+
+    int before = microbes();
+    step(180);
+    REQUIRE(microbes() < before);
+    REQUIRE(ecs.get<components::ResourceDrops>()->size() > 0);
+    REQUIRE(ecs.get<components::DamageBuffer>()->size() == 0);
+}
+
+TEST_CASE_METHOD(EcsFixture, "DestructionSystem - a fast swipe hits what lies between its samples", "[destruction]") {
+    // A row of microbes the cursor jumps across in two samples
+    std::vector<flecs::entity> microbes;
+    for (int i = 0; i < 9; i++) {
+        microbes.push_back(addMicrobe(world, -4.0f + (float)i, 0.0f, 100.0f));
+    }
+    microbes.push_back(addMicrobe(world, 0.0f, 2.0f, 100.0f));   // Off the path
+    components::MicrobeIndex index;
+    buildIndex(index, microbes);
+
+    components::DamageBuffer buffer;
+    Vector2 path[2] = {{-4.5f, 0.0f}, {4.5f, 0.0f}};
+    REQUIRE(DestructionSystem::queueDiscDamage(index, 4.2f, 0.0f, 0.3f, 1.0f, DamageSource::Hover, buffer) == 1);
+    buffer.clear();
+    REQUIRE(DestructionSystem::queueSweptDamage(index, path, 2, 0.3f, 1.0f, DamageSource::Hover, buffer) == 9);
+
+    // A bent path: down the row, then up to the stray one
+    buffer.clear();
+    Vector2 bent[3] = {{-4.5f, 0.0f}, {-1.5f, 0.0f}, {0.0f, 2.0f}};
+    REQUIRE(DestructionSystem::queueSweptDamage(index, bent, 3, 0.3f, 1.0f, DamageSource::Hover, buffer) == 5);
+}
+
+TEST_CASE_METHOD(EcsFixture, "DestructionSystem - the hover reticle finds each microbe under the cursor once", "[destruction]") {
+    // Neighbours close enough to share grid cells, so candidates repeat
+    std::vector<flecs::entity> microbes = {
+        addMicrobe(world, 0.3f, 0.0f, 100.0f),
+        addMicrobe(world, -0.3f, 0.0f, 100.0f),
+        addMicrobe(world, 0.0f, 0.3f, 100.0f),
+        addMicrobe(world, 2.0f, 2.0f, 100.0f),
+    };
+    components::MicrobeIndex index;
+    buildIndex(index, microbes);
+
+    std::vector<int> slots;
+    Vector2 cursor = {0.0f, 0.0f};
+    REQUIRE(DestructionSystem::findSwept(index, &cursor, 1, 0.3f, slots) == 3);
+    REQUIRE(slots == std::vector<int>{0, 1, 2});
+    REQUIRE(DestructionSystem::findSwept(index, &cursor, 0, 0.3f, slots) == 0);
+    REQUIRE(slots.empty());
+}
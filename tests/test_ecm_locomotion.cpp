@@ -2,6 +2,7 @@
 #include <cmath>
 #include "src/systems/ECMLocomotionSystem.h"
 #include "src/components/ECMLocomotion.h"
+#include "tests/test_fixtures.h"
 
 using namespace micro_idle;
 TEST_CASE("ECMLocomotion - Initialize locomotion state", "[ecm_locomotion]") {
@@ -27,3 +28,17 @@ TEST_CASE("ECMLocomotion - Initialize locomotion state", "[ecm_locomotion]") {
     REQUIRE(std::abs(locomotion.targetDirection.y) < 0.001f);
     REQUIRE((locomotion.zigzagSign == -1 || locomotion.zigzagSign == 1));
 }
+
+TEST_CASE_METHOD(DishFixture, "ECMLocomotion - coarse mode still tracks pod extents", "[ecm_locomotion]") {
+    flecs::entity amoeba = world.createAmoeba({0.0f, 1.0f, 0.0f}, 0.5f, WHITE);
+    world.setReducedFidelity(true);
+
+    bool extended = false;
+    for (int tick = 0; tick < 120 && !extended; tick++) {
+        step();
+        for (const auto& pod : amoeba.get<components::ECMLocomotion>()->pods) {
+            extended |= pod.extent > 0.0f;
+        }
+    }
+    REQUIRE(extended);
+}
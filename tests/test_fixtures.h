@@ -0,0 +1,71 @@
+#ifndef MICRO_IDLE_TEST_FIXTURES_H
+#define MICRO_IDLE_TEST_FIXTURES_H
+
+#include <flecs.h>
+#include "src/World.h"
+#include "src/systems/PhysicsSystem.h"
+#include "src/components/Microbe.h"
+#include "src/components/Transform.h"
+#include "src/components/Rendering.h"
+#include "src/components/WorldState.h"
+
+namespace micro_idle {
+
+// Lightweight fixtures for tests of a single system or factory, which don't
+// need a full World (pipelines, singletons, render helpers, boundary bodies)
+
+// Physics world with a small scratch allocator
+struct PhysicsFixture {
+    static constexpr size_t TempAllocatorBytes = 16 * 1024 * 1024;
+
+    PhysicsSystemState* physics;
+
+    PhysicsFixture() : physics(new PhysicsSystemState(TempAllocatorBytes)) {}
+    ~PhysicsFixture() { delete physics; }
+
+    PhysicsFixture(const PhysicsFixture&) = delete;
+    PhysicsFixture& operator=(const PhysicsFixture&) = delete;
+};
+
+// Bare ECS world with the components most systems read, plus physics.
+// The ECS world is destroyed first, so observers may still reach physics.
+struct EcsFixture : PhysicsFixture {
+    flecs::world world;
+
+    EcsFixture() {
+        world.component<components::Transform>();
+        world.component<components::Microbe>();
+        world.component<components::SDFRenderComponent>();
+        world.component<components::CameraState>();
+    }
+};
+
+// Full World with the spawner off, so a test sees only the microbes it adds
+struct DishFixture {
+    static constexpr float Dt = 1.0f / 60.0f;
+
+    World world;
+    flecs::world& ecs;
+
+    DishFixture() : ecs(world.getWorld()) {
+        ecs.get_mut<components::WorldState>()->spawnEnabled = false;
+    }
+
+    // Spawn a population and take one tick, so the MicrobeIndex covers it
+    void populate(components::MicrobeType type, int count) {
+        world.spawnPopulation(type, count);
+        step();
+    }
+
+    void step(int ticks = 1) {
+        for (int i = 0; i < ticks; i++) {
+            world.update(Dt);
+        }
+    }
+
+    int microbes() const { return ecs.count<components::Microbe>(); }
+};
+
+} // namespace micro_idle
+
+#endif
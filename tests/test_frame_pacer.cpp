@@ -0,0 +1,121 @@
+#include "engine/platform/frame_pacer.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+
+TEST_CASE("Frame pacer - first frame has zero delta", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 60);
+
+    REQUIRE(frame_pacer_begin_frame(&pacer, 10.0) == 0.0);
+    REQUIRE(pacer.stats.frames == 0);
+    REQUIRE(std::abs(frame_pacer_begin_frame(&pacer, 10.02) - 0.02) < 1e-9);
+    REQUIRE(pacer.stats.frames == 1);
+}
+
+TEST_CASE("Frame pacer - steady frames have zero variance", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 0);
+
+    double t = 0.0;
+    for (int i = 0; i < 200; i++) {
+        frame_pacer_begin_frame(&pacer, t);
+        t += 1.0 / 60.0;
+    }
+    REQUIRE(std::abs(pacer.stats.frame_time_mean - 1.0 / 60.0) < 1e-6);
+    REQUIRE(pacer.stats.frame_time_variance < 1e-12);
+}
+
+TEST_CASE("Frame pacer - alternating frames show variance", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 0);
+
+    double t = 0.0;
+    for (int i = 0; i < 400; i++) {
+        frame_pacer_begin_frame(&pacer, t);
+        t += (i % 2 == 0) ? 0.010 : 0.023;
+    }
+    REQUIRE(std::abs(pacer.stats.frame_time_mean - 0.0165) < 0.001);
+    // Samples sit 6.5 ms either side of the mean
+    REQUIRE(pacer.stats.frame_time_variance > 0.0055 * 0.0055);
+    REQUIRE(pacer.stats.frame_time_variance < 0.0075 * 0.0075);
+}
+
+TEST_CASE("Frame pacer - input latency measured to present", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 60);
+
+    frame_pacer_mark_input(&pacer, 1.000);
+    frame_pacer_mark_present(&pacer, 1.012);
+    REQUIRE(std::abs(pacer.stats.input_latency_mean - 0.012) < 1e-9);
+    REQUIRE(std::abs(pacer.stats.input_latency_max - 0.012) < 1e-9);
+
+    frame_pacer_mark_input(&pacer, 2.000);
+    frame_pacer_mark_present(&pacer, 2.030);
+    REQUIRE(pacer.stats.input_latency_mean > 0.012);
+    REQUIRE(pacer.stats.input_latency_mean < 0.030);
+    REQUIRE(std::abs(pacer.stats.input_latency_max - 0.030) < 1e-9);
+    REQUIRE(pacer.stats.presents == 2);
+}
+
+TEST_CASE("Frame pacer - cursor latch measured separately from input", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 60);
+
+    frame_pacer_mark_input(&pacer, 1.000);
+    frame_pacer_mark_latch(&pacer, 1.010);
+    frame_pacer_mark_present(&pacer, 1.012);
+    REQUIRE(std::abs(pacer.stats.input_latency_mean - 0.012) < 1e-9);
+    REQUIRE(std::abs(pacer.stats.latch_latency_mean - 0.002) < 1e-9);
+    REQUIRE(std::abs(pacer.stats.latch_latency_max - 0.002) < 1e-9);
+
+    // A frame without a latch leaves the latch stats alone
+    frame_pacer_mark_input(&pacer, 2.000);
+    frame_pacer_mark_present(&pacer, 2.020);
+    REQUIRE(pacer.stats.presents == 2);
+    REQUIRE(pacer.stats.latch_presents == 1);
+}
+
+TEST_CASE("Frame pacer - present without input is ignored", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 60);
+
+    frame_pacer_mark_present(&pacer, 5.0);
+    REQUIRE(pacer.stats.presents == 0);
+    REQUIRE(pacer.stats.input_latency_max == 0.0);
+}
+
+TEST_CASE("Frame pacer - deadlines advance by the cap interval", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 100);
+    frame_pacer_begin_frame(&pacer, 1.0);
+
+    REQUIRE(std::abs(frame_pacer_next_deadline(&pacer, 1.004) - 1.01) < 1e-9);
+    REQUIRE(std::abs(frame_pacer_next_deadline(&pacer, 1.012) - 1.02) < 1e-9);
+}
+
+TEST_CASE("Frame pacer - deadline resyncs after a long hitch", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 100);
+    frame_pacer_begin_frame(&pacer, 1.0);
+
+    REQUIRE(frame_pacer_next_deadline(&pacer, 1.5) == 1.5);
+    REQUIRE(std::abs(frame_pacer_next_deadline(&pacer, 1.503) - 1.51) < 1e-9);
+}
+
+TEST_CASE("Frame pacer - uncapped deadline is now", "[frame_pacer]") {
+    FramePacer pacer;
+    frame_pacer_init(&pacer, 0);
+
+    REQUIRE(pacer.target_interval == 0.0);
+    REQUIRE(frame_pacer_next_deadline(&pacer, 3.25) == 3.25);
+}
+
+TEST_CASE("Frame pacer - sleep lands on the deadline", "[frame_pacer]") {
+    double start = frame_pacer_now();
+    double deadline = start + 0.005;
+    frame_pacer_sleep_until(deadline, 0.002);
+    double woke = frame_pacer_now();
+
+    REQUIRE(woke >= deadline);
+    REQUIRE(woke - deadline < 0.050);
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/World.h"
+#include "src/physics/Icosphere.h"
+#include "src/physics/MembraneContacts.h"
+#include "src/physics/PhysicsRuntime.h"
+#include "src/systems/PhysicsSystem.h"
+#include <Jolt/Core/JobSystemThreadPool.h>
+#include <vector>
+
+using namespace micro_idle;
+using Catch::Approx;
+
+namespace {
+
+void addSphere(MembraneContacts& contacts, Vector3 center, float radius, float mobility = 1.0f,
+               int layer = Layers::SKIN) {
+    IcosphereMesh mesh = GenerateIcosphere(1, radius);
+    std::vector<Vector3> positions;
+    for (const Vector3& v : mesh.vertices) {
+        positions.push_back({v.x + center.x, v.y + center.y, v.z + center.z});
+    }
+    contacts.addMembrane(layer, mobility, positions.data(), nullptr, (int)positions.size());
+}
+
+// Mean x correction of one membrane's vertices
+float meanPushX(const MembraneContacts& contacts, int first, int count) {
+    float sum = 0.0f;
+    for (int i = first; i < first + count; i++) {
+        sum += contacts.getDisplacement(i).x;
+    }
+    return sum / (float)count;
+}
+
+} // namespace
+
+TEST_CASE("MembraneContacts - overlapping membranes are pushed apart", "[membrane_contacts]") {
+    MembraneContacts contacts;
+    addSphere(contacts, {0.0f, 0.0f, 0.0f}, 1.0f);
+    addSphere(contacts, {1.6f, 0.0f, 0.0f}, 1.0f);
+    REQUIRE(contacts.getMembraneCount() == 2);
+    int n = contacts.getVertexCount() / 2;
+
+    REQUIRE(contacts.solve(nullptr) > 0);
+    float left = meanPushX(contacts, 0, n);
+    float right = meanPushX(contacts, n, n);
+    REQUIRE(left < 0.0f);
+    REQUIRE(right > 0.0f);
+    REQUIRE(left == Approx(-right).margin(1e-4f));
+}
+
+TEST_CASE("MembraneContacts - separated or filtered membranes are left alone", "[membrane_contacts]") {
+    MembraneContacts contacts;
+    addSphere(contacts, {0.0f, 0.0f, 0.0f}, 1.0f);
+    addSphere(contacts, {2.5f, 0.0f, 0.0f}, 1.0f);
+    REQUIRE(contacts.solve(nullptr) == 0);
+
+    // A membrane never collides with itself, and disabled layer pairs are skipped
+    contacts.clear();
+    addSphere(contacts, {0.0f, 0.0f, 0.0f}, 1.0f);
+    REQUIRE(contacts.solve(nullptr) == 0);
+
+    REQUIRE(contacts.isLayerPairEnabled(Layers::SKIN, Layers::SKIN));
+    contacts.setLayerPair(Layers::SKIN, Layers::SKIN, false);
+    addSphere(contacts, {1.6f, 0.0f, 0.0f}, 1.0f);
+    REQUIRE(contacts.solve(nullptr) == 0);
+
+    contacts.clear();
+    contacts.setLayerPair(Layers::SKIN, Layers::MOVING, true);
+    REQUIRE(contacts.isLayerPairEnabled(Layers::MOVING, Layers::SKIN));
+    addSphere(contacts, {0.0f, 0.0f, 0.0f}, 1.0f, 1.0f, Layers::SKIN);
+    addSphere(contacts, {1.6f, 0.0f, 0.0f}, 1.0f, 1.0f, Layers::MOVING);
+    REQUIRE(contacts.solve(nullptr) > 0);
+}
+
+TEST_CASE("MembraneContacts - an immovable membrane pushes the other one out alone", "[membrane_contacts]") {
+    MembraneContacts shared;
+    addSphere(shared, {0.0f, 0.0f, 0.0f}, 1.0f);
+    addSphere(shared, {1.6f, 0.0f, 0.0f}, 1.0f);
+    shared.solve(nullptr);
+    int n = shared.getVertexCount() / 2;
+
+    MembraneContacts pinned;
+    addSphere(pinned, {0.0f, 0.0f, 0.0f}, 1.0f);
+    addSphere(pinned, {1.6f, 0.0f, 0.0f}, 1.0f, 0.0f);
+    REQUIRE(pinned.solve(nullptr) > 0);
+    for (int i = n; i < 2 * n; i++) {
+        REQUIRE(pinned.getDisplacement(i).x == 0.0f);
+    }
+    REQUIRE(meanPushX(pinned, 0, n) < meanPushX(shared, 0, n));
+}
+
+TEST_CASE("MembraneContacts - results do not depend on the thread count", "[membrane_contacts]") {
+    auto build = [](MembraneContacts& contacts) {
+        for (int i = 0; i < 24; i++) {
+            addSphere(contacts, {(float)(i % 6) * 0.5f, 0.0f, (float)(i / 6) * 0.5f}, 0.3f);
+        }
+    };
+    MembraneContacts inlineRun;
+    MembraneContacts threaded;
+    build(inlineRun);
+    build(threaded);
+    int pushed = inlineRun.solve(nullptr);
+    REQUIRE(pushed > 0);
+    REQUIRE(threaded.solve(PhysicsRuntime::jobSystem()) == pushed);
+    for (int i = 0; i < inlineRun.getVertexCount(); i++) {
+        Vector3 a = inlineRun.getDisplacement(i);
+        Vector3 b = threaded.getDisplacement(i);
+        REQUIRE(a.x == b.x);
+        REQUIRE(a.y == b.y);
+        REQUIRE(a.z == b.z);
+    }
+}
+
+TEST_CASE("World - overlapping amoebas register membrane contacts", "[membrane_contacts]") {
+    World world;
+    REQUIRE(world.getWorld().lookup("MembraneContactSystem").is_valid());
+
+    world.createAmoeba({0.0f, 1.5f, 0.0f}, 0.28f, (Color){120, 200, 170, 255});
+    world.createAmoeba({0.3f, 1.5f, 0.0f}, 0.28f, (Color){90, 180, 140, 255});
+    world.update(1.0f / 60.0f);
+
+    const MembraneContacts& contacts = world.getMembraneContacts();
+    REQUIRE(contacts.getMembraneCount() == 2);
+    REQUIRE(contacts.getLastContactCount() > 0);
+}
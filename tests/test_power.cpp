@@ -0,0 +1,85 @@
+#include "engine/platform/power.h"
+#include "engine/platform/engine.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+
+TEST_CASE("Power - focused window stays active", "[power]") {
+    PowerState state;
+    power_init(&state, 10, 30.0);
+
+    REQUIRE(power_update(&state, false, true, 1.0 / 60.0) == POWER_MODE_ACTIVE);
+    REQUIRE(power_idle_interval(&state) == 0.0);
+}
+
+TEST_CASE("Power - focus loss enters background", "[power]") {
+    PowerState state;
+    power_init(&state, 10, 30.0);
+
+    REQUIRE(power_update(&state, false, false, 1.0 / 60.0) == POWER_MODE_BACKGROUND);
+    REQUIRE(std::abs(power_idle_interval(&state) - 0.1) < 1e-9);
+}
+
+TEST_CASE("Power - unfocused visible window never goes hidden", "[power]") {
+    PowerState state;
+    power_init(&state, 10, 1.0);
+
+    for (int i = 0; i < 100; i++) {
+        power_update(&state, false, false, 0.1);
+    }
+    REQUIRE(state.mode == POWER_MODE_BACKGROUND);
+    REQUIRE(power_take_hidden_time(&state) == 0.0);
+}
+
+TEST_CASE("Power - minimized window goes hidden after threshold", "[power]") {
+    PowerState state;
+    power_init(&state, 10, 1.0);
+
+    REQUIRE(power_update(&state, true, false, 0.5) == POWER_MODE_BACKGROUND);
+    REQUIRE(power_update(&state, true, false, 0.5) == POWER_MODE_HIDDEN);
+    REQUIRE(power_update(&state, true, false, 2.0) == POWER_MODE_HIDDEN);
+    REQUIRE(power_update(&state, true, false, 3.0) == POWER_MODE_HIDDEN);
+
+    // Only time spent while already hidden is banked for fast-forward
+    REQUIRE(std::abs(power_take_hidden_time(&state) - 5.0) < 1e-9);
+    REQUIRE(power_take_hidden_time(&state) == 0.0);
+}
+
+TEST_CASE("Power - restore returns to active and resets background clock", "[power]") {
+    PowerState state;
+    power_init(&state, 10, 1.0);
+
+    power_update(&state, true, false, 5.0);
+    REQUIRE(power_update(&state, false, true, 0.016) == POWER_MODE_ACTIVE);
+    REQUIRE(state.background_time == 0.0);
+    REQUIRE(power_update(&state, true, false, 0.5) == POWER_MODE_BACKGROUND);
+}
+
+TEST_CASE("Power - invalid config falls back to defaults", "[power]") {
+    PowerState state;
+    power_init(&state, 0, -5.0);
+
+    REQUIRE(state.background_tick_hz > 0);
+    REQUIRE(state.hidden_after == 0.0);
+}
+
+TEST_CASE("Power - engine switches tick rate with power mode", "[power][engine]") {
+    EngineContext ctx = {0};
+    EngineConfig cfg = {
+        .window_w = 640,
+        .window_h = 360,
+        .target_fps = 60,
+        .tick_hz = 60,
+        .vsync = false,
+        .dev_mode = false,
+        .background_tick_hz = 10,
+        .hidden_after_s = 60.0
+    };
+    engine_init(&ctx, cfg);
+
+    engine_power_update(&ctx, false, false, 0.016);
+    REQUIRE(std::abs(ctx.time.tick_dt - 0.1) < 1e-9);
+    REQUIRE(engine_time_update(&ctx, 0.1) == 1);
+
+    engine_power_update(&ctx, false, true, 0.016);
+    REQUIRE(std::abs(ctx.time.tick_dt - 1.0 / 60.0) < 1e-9);
+}
@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/World.h"
+#include "src/components/Microbe.h"
+#include "src/components/RenderPacket.h"
+#include "src/systems/RenderPacketSystem.h"
+#include <unordered_map>
+#include <vector>
+
+using namespace micro_idle;
+using Catch::Approx;
+
+TEST_CASE("RenderPacketSystem - one packet per microbe after a tick", "[render_packets]") {
+    World world;
+    world.createMicrobe(components::MicrobeType::Amoeba, {-2.0f, 1.0f, 0.0f}, 0.5f, RED);
+    world.createMicrobe(components::MicrobeType::Coccus, {2.0f, 1.0f, 1.0f}, 0.1f, BLUE);
+    world.createMicrobe(components::MicrobeType::Icosahedral, {0.0f, 1.0f, -2.0f}, 0.1f, GREEN);
+
+    auto packets = world.getWorld().get<components::RenderPackets>();
+    REQUIRE(packets != nullptr);
+    REQUIRE(packets->size() == 0);
+
+    world.update(1.0f / 60.0f);
+    packets = world.getWorld().get<components::RenderPackets>();
+    REQUIRE(packets->size() == 3);
+
+    for (const auto& packet : packets->packets) {
+        flecs::entity e = world.getWorld().entity(packet.entity);
+        REQUIRE(e.is_alive());
+        auto microbe = e.get<components::Microbe>();
+        REQUIRE(microbe != nullptr);
+        REQUIRE(packet.type == (int32_t)microbe->type);
+        REQUIRE(packet.radius == Approx(microbe->stats.baseRadius));
+    }
+}
+
+TEST_CASE("RenderPacketSystem - snapshot fills SoA arrays up to capacity", "[render_packets]") {
+    World world;
+    REQUIRE(world.spawnPopulation(components::MicrobeType::Coccus, 40) == 40);
+    REQUIRE(world.spawnPopulation(components::MicrobeType::Amoeba, 2) == 2);
+    world.update(1.0f / 60.0f);
+
+    // Counting only: no arrays, no capacity
+    REQUIRE(RenderPacketSystem::snapshot(world.getWorld(), MicrobeSnapshot{}, 0) == 42);
+
+    std::vector<uint64_t> ids(42);
+    std::vector<float> x(42), radius(42), health(42);
+    MicrobeSnapshot out;
+    out.entity = ids.data();
+    out.x = x.data();
+    out.radius = radius.data();
+    out.health = health.data();
+    REQUIRE(RenderPacketSystem::snapshot(world.getWorld(), out, 42) == 42);
+
+    // Snapshot agrees with the packets of the same tick
+    auto packets = world.getWorld().get<components::RenderPackets>();
+    REQUIRE(packets->size() == 42);
+    std::unordered_map<uint64_t, const components::RenderPacket*> byEntity;
+    for (const auto& packet : packets->packets) {
+        byEntity[packet.entity] = &packet;
+    }
+    for (int i = 0; i < 42; i++) {
+        auto it = byEntity.find(ids[(size_t)i]);
+        REQUIRE(it != byEntity.end());
+        REQUIRE(x[(size_t)i] == Approx(it->second->position.x));
+        REQUIRE(radius[(size_t)i] == Approx(it->second->radius));
+        REQUIRE(health[(size_t)i] > 0.0f);
+    }
+
+    // A short buffer is never overrun, but the total is still reported
+    std::vector<uint64_t> few(5, 0);
+    MicrobeSnapshot truncated;
+    truncated.entity = few.data();
+    REQUIRE(RenderPacketSystem::snapshot(world.getWorld(), truncated, 4) == 42);
+    REQUIRE(few[3] != 0);
+    REQUIRE(few[4] == 0);
+}
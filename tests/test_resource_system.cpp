@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/World.h"
+#include "src/components/Resource.h"
+#include "src/components/Upgrades.h"
+#include "src/systems/ResourceSystem.h"
+#include <cmath>
+
+using namespace micro_idle;
+using Catch::Approx;
+
+namespace {
+
+PickupParams cursorAt(float x, float z, float attractRadius = 0.0f) {
+    PickupParams pickup;
+    pickup.cursorX = x;
+    pickup.cursorZ = z;
+    pickup.cursorValid = true;
+    pickup.attractRadius = attractRadius;
+    return pickup;
+}
+
+} // namespace
+
+TEST_CASE("ResourceSystem - drops are padded SoA and age out", "[resources]") {
+    components::ResourceDrops drops;
+    components::ResourceInventory inventory;
+    for (int i = 0; i < 13; i++) {
+        ResourceSystem::addDrop(drops, components::ResourceType::Glucose, 1.0f, (float)i, 0.0f);
+    }
+    REQUIRE(drops.size() == 13);
+    REQUIRE(drops.x.size() == 16);
+    REQUIRE(drops.life.size() == 16);
+
+    // No cursor: nothing moves or is collected
+    PickupParams none;
+    for (int i = 0; i < 120; i++) {
+        REQUIRE(ResourceSystem::step(drops, 0.1f, none, inventory) == 0);
+        if (drops.size() == 0) {
+            break;
+        }
+    }
+    REQUIRE(drops.size() == 0);
+    REQUIRE(drops.x.empty());
+    REQUIRE(inventory.glucose == 0.0f);
+}
+
+TEST_CASE("ResourceSystem - the cursor collects drops it touches", "[resources]") {
+    components::ResourceDrops drops;
+    components::ResourceInventory inventory;
+    ResourceSystem::addDrop(drops, components::ResourceType::Iron, 2.0f, 0.1f, 0.0f);
+    ResourceSystem::addDrop(drops, components::ResourceType::Lipids, 3.0f, 5.0f, 0.0f);
+    ResourceSystem::addDrop(drops, components::ResourceType::Iron, 1.5f, 0.0f, -0.2f);
+
+    REQUIRE(ResourceSystem::step(drops, 1.0f / 60.0f, cursorAt(0.0f, 0.0f), inventory) == 2);
+    REQUIRE(drops.size() == 1);
+    REQUIRE(drops.x[0] == Approx(5.0f));
+    REQUIRE(inventory.iron == Approx(3.5f));
+    REQUIRE(inventory.lipids == 0.0f);
+
+    // Without the upgrade, a drop out of reach stays put
+    for (int i = 0; i < 30; i++) {
+        ResourceSystem::step(drops, 1.0f / 60.0f, cursorAt(3.0f, 0.0f), inventory);
+    }
+    REQUIRE(drops.size() == 1);
+    REQUIRE(drops.x[0] == Approx(5.0f));
+}
+
+TEST_CASE("ResourceSystem - pickup attraction pulls drops within the upgrade radius", "[resources]") {
+    components::PlayerUpgrades upgrades;
+    REQUIRE(ResourceSystem::attractionRadius(upgrades) == 0.0f);
+    upgrades.pickupAttraction = 1;
+    float radius = ResourceSystem::attractionRadius(upgrades);
+    REQUIRE(radius > 1.0f);
+    upgrades.pickupAttraction = 3;
+    REQUIRE(ResourceSystem::attractionRadius(upgrades) > radius);
+
+    components::ResourceDrops drops;
+    components::ResourceInventory inventory;
+    ResourceSystem::addDrop(drops, components::ResourceType::Oxygen, 1.0f, radius * 0.8f, 0.0f);
+    ResourceSystem::addDrop(drops, components::ResourceType::Sodium, 1.0f, 0.0f, radius * 1.5f);
+
+    int collected = 0;
+    for (int i = 0; i < 120 && collected == 0; i++) {
+        collected += ResourceSystem::step(drops, 1.0f / 60.0f, cursorAt(0.0f, 0.0f, radius), inventory);
+    }
+    REQUIRE(collected == 1);
+    REQUIRE(inventory.oxygen == Approx(1.0f));
+    REQUIRE(drops.size() == 1);
+    REQUIRE(drops.z[0] == Approx(radius * 1.5f));
+}
+
+TEST_CASE("ResourceSystem - thousands of drops collect exactly once", "[resources]") {
+    components::ResourceDrops drops;
+    components::ResourceInventory inventory;
+    for (int i = 0; i < 3001; i++) {
+        float angle = (float)i * 0.618f;
+        float r = 0.3f * (float)(i % 7) / 7.0f;
+        ResourceSystem::addDrop(drops, (components::ResourceType)(i % components::ResourceTypeCount),
+                                1.0f, r * std::cos(angle), r * std::sin(angle));
+    }
+    for (int i = 0; i < 500; i++) {
+        ResourceSystem::addDrop(drops, components::ResourceType::Calcium, 1.0f, 10.0f, (float)i * 0.01f);
+    }
+
+    REQUIRE(ResourceSystem::step(drops, 1.0f / 60.0f, cursorAt(0.0f, 0.0f), inventory) == 3001);
+    REQUIRE(drops.size() == 500);
+    float total = 0.0f;
+    for (int t = 0; t < components::ResourceTypeCount; t++) {
+        total += inventory.get((components::ResourceType)t);
+    }
+    REQUIRE(total == Approx(3001.0f));
+    for (int i = 0; i < drops.size(); i++) {
+        REQUIRE(drops.x[(size_t)i] == Approx(10.0f));
+    }
+}
+
+TEST_CASE("World - destroyed microbes drop resources that fast-forward ages out", "[resources]") {
+    World world;
+    ResourceSystem::spawnResource(world.getWorld(), components::ResourceType::Sodium, 2.0f, {1.0f, 0.5f, 2.0f});
+    auto drops = world.getWorld().get<components::ResourceDrops>();
+    REQUIRE(drops->size() == 1);
+    REQUIRE(drops->z[0] == Approx(2.0f));
+
+    world.fastForward(components::ResourceDrops::Lifetime + 1.0f);
+    REQUIRE(world.getWorld().get<components::ResourceDrops>()->size() == 0);
+}
@@ -55,3 +55,107 @@ TEST_CASE("RNG - inverted int range returns min", "[rng]") {
     int same = rng_range_i(&rng, 5, 4);
     REQUIRE(same == 5);
 }
+
+TEST_CASE("RNG - streams are deterministic and independent", "[rng]") {
+    Rng a, b, c;
+    rng_seed_stream(&a, 99u, 1u);
+    rng_seed_stream(&b, 99u, 1u);
+    rng_seed_stream(&c, 99u, 2u);
+
+    bool anyDifferent = false;
+    for (int i = 0; i < 16; i++) {
+        uint32_t va = rng_next_u32(&a);
+        REQUIRE(va == rng_next_u32(&b));
+        anyDifferent |= va != rng_next_u32(&c);
+    }
+    REQUIRE(anyDifferent);
+}
+
+TEST_CASE("RNG - split does not advance the parent", "[rng]") {
+    Rng parent;
+    rng_seed(&parent, 7u);
+    uint64_t before = parent.state;
+
+    Rng child1, child2;
+    rng_split(&parent, 5u, &child1);
+    rng_split(&parent, 5u, &child2);
+
+    REQUIRE(parent.state == before);
+    REQUIRE(child1.state == child2.state);
+    REQUIRE(child1.state != parent.state);
+}
+
+TEST_CASE("RNG - 8-lane generator matches scalar xoshiro128+", "[rng]") {
+    Rng8 rng;
+    rng8_seed(&rng, 1234u, 0u);
+
+    // Reference: step lane 3 by hand
+    uint32_t s0 = rng.s[0][3], s1 = rng.s[1][3], s2 = rng.s[2][3], s3 = rng.s[3][3];
+    for (int i = 0; i < 8; i++) {
+        uint32_t expected = s0 + s3;
+        uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = (s3 << 11) | (s3 >> 21);
+
+        uint32_t out[8];
+        rng8_next_u32(&rng, out);
+        REQUIRE(out[3] == expected);
+    }
+}
+
+TEST_CASE("RNG - 8-lane lanes are distinct", "[rng]") {
+    Rng8 rng;
+    rng8_seed(&rng, 0u, 0u);
+
+    uint32_t out[8];
+    rng8_next_u32(&rng, out);
+    for (int i = 0; i < 8; i++) {
+        for (int j = i + 1; j < 8; j++) {
+            REQUIRE(out[i] != out[j]);
+        }
+    }
+}
+
+TEST_CASE("RNG - bulk float fill bounds and determinism", "[rng]") {
+    Rng8 a, b;
+    rng8_seed(&a, 42u, 3u);
+    rng8_seed(&b, 42u, 3u);
+
+    // Odd count exercises the partial tail block
+    float fa[37];
+    float fb[37];
+    rng8_fill_range(&a, fa, 37, -2.0f, 3.0f);
+    rng8_fill_range(&b, fb, 37, -2.0f, 3.0f);
+
+    float sum = 0.0f;
+    for (int i = 0; i < 37; i++) {
+        REQUIRE(fa[i] >= -2.0f);
+        REQUIRE(fa[i] < 3.0f);
+        REQUIRE(fa[i] == fb[i]);
+        sum += fa[i];
+    }
+    REQUIRE(std::abs(sum / 37.0f - 0.5f) < 1.0f);
+}
+
+TEST_CASE("RNG - bulk f01 distribution is roughly uniform", "[rng]") {
+    Rng8 rng;
+    rng8_seed(&rng, 77u, 0u);
+
+    float values[4096];
+    rng8_fill_f01(&rng, values, 4096);
+
+    int buckets[4] = {0, 0, 0, 0};
+    for (float v : values) {
+        REQUIRE(v >= 0.0f);
+        REQUIRE(v < 1.0f);
+        buckets[(int)(v * 4.0f)]++;
+    }
+    for (int count : buckets) {
+        REQUIRE(count > 900);
+        REQUIRE(count < 1150);
+    }
+}
@@ -0,0 +1,184 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/World.h"
+#include "src/components/Appendage.h"
+#include "src/components/Microbe.h"
+#include "src/physics/RodSolver.h"
+#include "src/systems/PhysicsSystem.h"
+#include <cmath>
+#include <cstring>
+
+using namespace micro_idle;
+using Catch::Approx;
+
+namespace {
+
+float distance(Vector3 a, Vector3 b) {
+    float dx = a.x - b.x;
+    float dy = a.y - b.y;
+    float dz = a.z - b.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+float maxStretch(const RodView& rod, float segment) {
+    float worst = 0.0f;
+    for (int i = 1; i < rod.nodes; i++) {
+        worst = std::fmax(worst, std::fabs(distance(rod.node(i), rod.node(i - 1)) - segment) / segment);
+    }
+    return worst;
+}
+
+void stepFor(RodSolver& solver, int steps, JPH::JobSystem* jobs = nullptr) {
+    for (int i = 0; i < steps; i++) {
+        solver.step(1.0f / 60.0f, jobs);
+    }
+}
+
+} // namespace
+
+TEST_CASE("RodSolver - straight rod follows its clamped base", "[rod_solver]") {
+    RodSolver solver;
+    RodParams params;
+    params.nodes = 11;
+    params.length = 2.0f;
+    params.bendStiffness = 0.8f;
+    int rod = solver.addRod(params, {0.0f, 0.5f, 0.0f}, {1.0f, 0.0f, 0.0f});
+
+    RodView view = solver.getRod(rod);
+    REQUIRE(view.nodes == 11);
+    REQUIRE(view.node(10).x == Approx(2.0f));
+
+    // Swing the base round to +Z and drag it sideways
+    solver.setAnchor(rod, {1.0f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f});
+    stepFor(solver, 240);
+
+    view = solver.getRod(rod);
+    REQUIRE(view.node(0).x == Approx(1.0f));
+    REQUIRE(maxStretch(view, 0.2f) < 0.02f);
+    REQUIRE(view.node(10).z > 1.8f);
+    REQUIRE(std::fabs(view.node(10).x - 1.0f) < 0.2f);
+}
+
+TEST_CASE("RodSolver - rest curvature bends the rod in the dish plane", "[rod_solver]") {
+    RodSolver solver;
+    RodParams params;
+    params.nodes = 16;
+    params.length = 3.0f;
+    params.curvature = 3.14159265f;     // Half a circle
+    params.bendStiffness = 1.0f;
+    int rod = solver.addRod(params, {0.0f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f});
+    stepFor(solver, 300);
+
+    RodView view = solver.getRod(rod);
+    float chord = distance(view.node(0), view.node(view.nodes - 1));
+    REQUIRE(chord < 3.0f * 0.8f);
+    REQUIRE(chord > 3.0f * 0.5f);
+    REQUIRE(maxStretch(view, 0.2f) < 0.02f);
+    for (int i = 0; i < view.nodes; i++) {
+        REQUIRE(view.node(i).y == Approx(0.5f).margin(1e-3f));
+    }
+}
+
+TEST_CASE("RodSolver - beating rods stay above the floor and keep their length", "[rod_solver]") {
+    RodSolver solver;
+    solver.floorHeight = 0.2f;
+    RodParams params;
+    params.nodes = 12;
+    params.length = 1.1f;
+    params.curvature = 4.0f;
+    params.twist = 8.0f;
+    params.beatAmplitude = 3.0f;
+    params.beatFrequency = 4.0f;
+    int rod = solver.addRod(params, {0.0f, 0.25f, 0.0f}, {-1.0f, 0.0f, 0.0f});
+    stepFor(solver, 120);
+
+    RodView view = solver.getRod(rod);
+    REQUIRE(maxStretch(view, 0.1f) < 0.05f);
+    for (int i = 0; i < view.nodes; i++) {
+        REQUIRE(view.node(i).y >= 0.2f);
+        REQUIRE(std::isfinite(view.node(i).x));
+    }
+}
+
+TEST_CASE("RodSolver - lanes are packed and reused", "[rod_solver]") {
+    RodSolver solver;
+    RodParams params;
+    int rods[9];
+    for (int i = 0; i < 9; i++) {
+        rods[i] = solver.addRod(params, {(float)i, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f});
+    }
+    REQUIRE(solver.getRodCount() == 9);
+    REQUIRE(solver.getPacketCount() == 2);
+
+    // A different node count never shares a packet
+    RodParams longer;
+    longer.nodes = 20;
+    solver.addRod(longer, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f});
+    REQUIRE(solver.getPacketCount() == 3);
+
+    solver.removeRod(rods[3]);
+    REQUIRE_FALSE(solver.isAlive(rods[3]));
+    int reused = solver.addRod(params, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f});
+    REQUIRE(reused == rods[3]);
+    REQUIRE(solver.getPacketCount() == 3);
+    REQUIRE(solver.getRodCount() == 10);
+}
+
+TEST_CASE("RodSolver - threaded stepping matches inline stepping", "[rod_solver]") {
+    PhysicsSystemState physics;
+    RodSolver inlineSolver;
+    RodSolver threadedSolver;
+    for (int i = 0; i < 40; i++) {
+        RodParams params;
+        params.nodes = 8 + (i % 3) * 4;
+        params.length = 1.0f + 0.05f * (float)i;
+        params.beatAmplitude = 2.0f;
+        params.beatFrequency = 1.0f + 0.1f * (float)i;
+        Vector3 anchor = {(float)i * 0.3f, 0.3f, 0.0f};
+        inlineSolver.addRod(params, anchor, {1.0f, 0.0f, 0.5f});
+        threadedSolver.addRod(params, anchor, {1.0f, 0.0f, 0.5f});
+    }
+
+    stepFor(inlineSolver, 60);
+    stepFor(threadedSolver, 60, physics.jobSystem);
+
+    for (int i = 0; i < 40; i++) {
+        RodView a = inlineSolver.getRod(i);
+        RodView b = threadedSolver.getRod(i);
+        for (int n = 0; n < a.nodes; n++) {
+            Vector3 pa = a.node(n);
+            Vector3 pb = b.node(n);
+            REQUIRE(std::memcmp(&pa, &pb, sizeof(Vector3)) == 0);
+        }
+    }
+}
+
+TEST_CASE("Appendages - microbes grow rods pinned to their body", "[rod_solver]") {
+    World world;
+    world.createScreenBoundaries(20.0f, 20.0f);
+    auto lacrymaria = world.createMicrobe(components::MicrobeType::Lacrymaria, {-4.0f, 1.5f, 0.0f}, 0.3f, GREEN);
+    auto spirillum = world.createMicrobe(components::MicrobeType::Spirillum, {4.0f, 1.0f, 0.0f}, 0.08f, RED);
+    auto coccus = world.createMicrobe(components::MicrobeType::Coccus, {0.0f, 1.0f, 4.0f}, 0.1f, RED);
+
+    REQUIRE(lacrymaria.get<components::Appendages>()->count == 1);
+    REQUIRE(spirillum.get<components::Appendages>()->count == 2);
+    REQUIRE_FALSE(coccus.has<components::Appendages>());
+
+    for (int i = 0; i < 60; i++) {
+        world.update(1.0f / 60.0f);
+    }
+
+    // The neck stays about 7 body lengths long and above the dish
+    const RodSolver& rods = world.getRods();
+    RodView neck = rods.getRod(lacrymaria.get<components::Appendages>()->rods[0]);
+    float segment = 14.0f * 0.3f / (float)(neck.nodes - 1);
+    REQUIRE(maxStretch(neck, segment) < 0.1f);
+    for (int i = 0; i < neck.nodes; i++) {
+        REQUIRE(neck.node(i).y >= 0.2f);
+    }
+
+    // Removing the microbe frees its lanes
+    REQUIRE(rods.getRodCount() == 3);
+    spirillum.destruct();
+    REQUIRE(rods.getRodCount() == 1);
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+#include "src/replay/InputRecording.h"
+#include "src/replay/ReplayRunner.h"
+#include "src/replay/Scenario.h"
+#include <string>
+#include <vector>
+
+using namespace micro_idle::replay;
+
+TEST_CASE("Scenario - parses keys, populations and events", "[scenario]") {
+    const std::string text =
+        "# comment line\n"
+        "name = swarm\n"
+        "seed = 0x2A\n"
+        "dish = 12 6.5\n"
+        "tick_hz = 30\n"
+        "duration = 2   # seconds\n"
+        "spawn_rate = 0.5\n"
+        "spawn = on\n"
+        "starters = off\n"
+        "population.amoeba = 7\n"
+        "event = 1.0 press left\n"
+        "event = 0.5 cursor 1.25 -2\n"
+        "event = 1.0 release left\n";
+
+    Scenario scenario;
+    std::string error;
+    REQUIRE(parseScenario(text, scenario, &error));
+    REQUIRE(scenario.name == "swarm");
+    REQUIRE(scenario.seed == 42u);
+    REQUIRE(scenario.dishWidth == 12.0f);
+    REQUIRE(scenario.dishHeight == 6.5f);
+    REQUIRE(scenario.durationTicks == 60);
+    REQUIRE(scenario.spawnEnabled);
+    REQUIRE_FALSE(scenario.starters);
+    REQUIRE(scenario.populations.size() == 1);
+    REQUIRE(scenario.populations[0].type == components::MicrobeType::Amoeba);
+    REQUIRE(scenario.populations[0].count == 7);
+
+    // Sorted by tick, file order kept within a tick
+    REQUIRE(scenario.events.size() == 3);
+    REQUIRE(scenario.events[0].type == ScenarioEventType::Cursor);
+    REQUIRE(scenario.events[0].tick == 15);
+    REQUIRE(scenario.events[1].type == ScenarioEventType::Press);
+    REQUIRE(scenario.events[2].type == ScenarioEventType::Release);
+    REQUIRE(scenario.events[2].tick == 30);
+}
+
+TEST_CASE("Scenario - reports the offending line", "[scenario]") {
+    Scenario scenario;
+    std::string error;
+    REQUIRE_FALSE(parseScenario("seed = 1\npopulation.dragon = 3\n", scenario, &error));
+    REQUIRE(error.find("line 2") == 0);
+    REQUIRE_FALSE(parseScenario("event = 1.0 teleport\n", scenario, &error));
+    REQUIRE_FALSE(parseScenario("dish = -1 4\n", scenario, &error));
+}
+
+TEST_CASE("Scenario - format round-trips exactly", "[scenario]") {
+    Scenario scenario;
+    scenario.name = "roundtrip";
+    scenario.seed = 0xDEADBEEFCAFEull;
+    scenario.dishWidth = 10.8f;
+    scenario.dishHeight = 3.8f;
+    scenario.tickHz = 60;
+    scenario.durationTicks = 1234;
+    scenario.populations.push_back({components::MicrobeType::Amoeba, 5});
+    scenario.events.push_back({7, ScenarioEventType::Cursor, 0, 0.1f, -3.3333333f});
+    scenario.events.push_back({7, ScenarioEventType::Press, ScenarioButtonRight, 0.0f, 0.0f});
+    scenario.events.push_back({601, ScenarioEventType::SimMode, 1, 0.0f, 0.0f});
+    scenario.events.push_back({900, ScenarioEventType::FastForward, 0, 61.5f, 0.0f});
+
+    Scenario parsed;
+    std::string error;
+    REQUIRE(parseScenario(formatScenario(scenario), parsed, &error));
+    REQUIRE(parsed.seed == scenario.seed);
+    REQUIRE(parsed.dishWidth == scenario.dishWidth);
+    REQUIRE(parsed.durationTicks == scenario.durationTicks);
+    REQUIRE(parsed.events.size() == scenario.events.size());
+    for (size_t i = 0; i < parsed.events.size(); i++) {
+        REQUIRE(parsed.events[i].tick == scenario.events[i].tick);
+        REQUIRE(parsed.events[i].type == scenario.events[i].type);
+        REQUIRE(parsed.events[i].button == scenario.events[i].button);
+        REQUIRE(parsed.events[i].x == scenario.events[i].x);
+        REQUIRE(parsed.events[i].z == scenario.events[i].z);
+    }
+}
+
+TEST_CASE("Scenario - recorded input plays back tick for tick", "[scenario]") {
+    std::vector<components::InputState> ticks(6);
+    ticks[1].mouseWorldValid = true;
+    ticks[1].mouseWorld = {1.0f, 0.0f, 2.0f};
+    ticks[2] = ticks[1];
+    ticks[2].mouseLeftDown = true;
+    ticks[2].mouseLeftPressed = true;
+    ticks[3] = ticks[2];
+    ticks[3].mouseLeftPressed = false;
+    ticks[3].mouseWorld = {1.5f, 0.0f, 2.0f};
+    ticks[4] = ticks[3];
+    ticks[4].mouseLeftDown = false;
+    ticks[5] = ticks[4];
+    ticks[5].mouseWorldValid = false;
+
+    InputRecorder recorder;
+    recorder.begin(Scenario{});
+    for (int t = 0; t < (int)ticks.size(); t++) {
+        recorder.recordTick(t, ticks[t]);
+    }
+    recorder.recordDish(5, 8.0f, 3.0f);
+    const Scenario& recording = recorder.finish((int)ticks.size());
+    REQUIRE(recording.durationTicks == 6);
+
+    InputPlayback playback(recording);
+    components::InputState replayed;
+    std::vector<ScenarioEvent> other;
+    for (int t = 0; t < (int)ticks.size(); t++) {
+        playback.applyTick(t, replayed, other);
+        REQUIRE(replayed.injected);
+        REQUIRE(replayed.mouseWorldValid == ticks[t].mouseWorldValid);
+        REQUIRE(replayed.mouseLeftDown == ticks[t].mouseLeftDown);
+        REQUIRE(replayed.mouseLeftPressed == ticks[t].mouseLeftPressed);
+        if (ticks[t].mouseWorldValid) {
+            REQUIRE(replayed.mouseWorld.x == ticks[t].mouseWorld.x);
+            REQUIRE(replayed.mouseWorld.z == ticks[t].mouseWorld.z);
+        }
+    }
+    REQUIRE(playback.finished());
+    REQUIRE(other.size() == 1);
+    REQUIRE(other[0].type == ScenarioEventType::Dish);
+}
+
+TEST_CASE("Scenario - headless runs are deterministic", "[scenario]") {
+    Scenario scenario;
+    std::string error;
+    REQUIRE(parseScenario(
+        "name = determinism\n"
+        "ticks = 45\n"
+        "spawn = on\n"
+        "spawn_rate = 20\n"
+        "population.amoeba = 2\n"
+        "event = 0.2 cursor 0.5 0.25\n"
+        "event = 0.5 sim_mode reduced\n", scenario, &error));
+
+    ReplayMetrics first, second;
+    REQUIRE(runScenario(scenario, first, nullptr, &error));
+    REQUIRE(runScenario(scenario, second, nullptr, &error));
+    REQUIRE(first.ticks == 45);
+    REQUIRE(first.microbes > 4);
+    REQUIRE(metricsEqual(first, second));
+}
@@ -7,8 +7,10 @@
 #include "src/components/Rendering.h"
 #include "src/rendering/SDFShader.h"
 #include "src/rendering/RaymarchBounds.h"
+#include "src/rendering/DeferredSDF.h"
 #include "src/systems/SoftBodyFactory.h"
 #include "src/systems/PhysicsSystem.h"
+#include "src/World.h"
 
 using namespace micro_idle;
 using Catch::Approx;
@@ -146,6 +148,46 @@ TEST_CASE("SDFRenderSystem - Registers without errors", "[rendering]") {
     REQUIRE(system != 0);
 }
 
+TEST_CASE("SDFRenderSystem - Deferred passes wrap the proxy draw", "[rendering]") {
+    flecs::world world;
+    world.component<components::Transform>();
+    world.component<components::Microbe>();
+    world.component<components::SDFRenderComponent>();
+    world.component<components::CameraState>();
+
+    // Without a GL context the G-buffer never becomes ready and every pass is a no-op
+    rendering::DeferredSDF deferred;
+    REQUIRE_FALSE(deferred.isReady());
+    SDFRenderSystem::registerSystem(world, &deferred);
+
+    auto geometry = world.lookup("SDFGeometryPass");
+    auto draw = world.lookup("SDFRenderSystem");
+    auto lighting = world.lookup("SDFLightingPass");
+    REQUIRE(geometry != 0);
+    REQUIRE(draw != 0);
+    REQUIRE(lighting != 0);
+    // Same phase: systems run in creation order
+    REQUIRE(geometry.id() < draw.id());
+    REQUIRE(draw.id() < lighting.id());
+
+    world.progress();
+    REQUIRE_FALSE(deferred.isReady());
+}
+
+TEST_CASE("World - Raymarch debugging is off and has no stats by default", "[rendering]") {
+    World world;
+    auto debug = world.getWorld().get<components::RaymarchDebug>();
+    REQUIRE(debug != nullptr);
+    REQUIRE_FALSE(debug->heatmap);
+    REQUIRE_FALSE(debug->relaxedTracing);
+    REQUIRE_FALSE(debug->collectStats);
+
+    // Turning collection on headless still reports nothing: there is no G-buffer to read
+    world.getWorld().set<components::RaymarchDebug>({false, true, true});
+    world.update(1.0f / 60.0f);
+    REQUIRE_FALSE(world.getRaymarchStats().valid);
+}
+
 TEST_CASE("Rendering utilities - calculateBoundRadius", "[rendering]") {
     float baseRadius = 1.0f;
     float expected = baseRadius * 2.5f; // Default multiplier
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/World.h"
+#include "src/components/Microbe.h"
+#include "src/components/Rendering.h"
+#include "src/components/Transform.h"
+#include "src/rendering/InstancedShells.h"
+#include "src/systems/ShellRenderSystem.h"
+#include "raymath.h"
+#include <cmath>
+
+using namespace micro_idle;
+using Catch::Approx;
+
+namespace {
+
+components::Microbe makeMicrobe(components::MicrobeType type, float radius) {
+    components::Microbe microbe{};
+    microbe.type = type;
+    microbe.stats.seed = 0.25f;
+    microbe.stats.baseRadius = radius;
+    microbe.stats.color = {200, 100, 50, 255};
+    return microbe;
+}
+
+// Instance matrix with the packed colour row restored, as the vertex shader does
+Matrix unpack(Matrix m) {
+    m.m3 = 0.0f;
+    m.m7 = 0.0f;
+    m.m11 = 0.0f;
+    m.m15 = 1.0f;
+    return m;
+}
+
+} // namespace
+
+TEST_CASE("ShellRenderSystem - rigid shells replace the membrane, spines pierce it", "[shell_render]") {
+    components::ShellRender shell;
+    REQUIRE(ShellRenderSystem::shellFor(components::MicrobeType::Icosahedral, shell));
+    REQUIRE(shell.replacesMembrane);
+    REQUIRE(ShellRenderSystem::shellFor(components::MicrobeType::Bacteriophage, shell));
+    REQUIRE(shell.kind == components::ShellKind::Phage);
+    REQUIRE(ShellRenderSystem::shellFor(components::MicrobeType::Diatom, shell));
+    REQUIRE(shell.replacesMembrane);
+    REQUIRE(ShellRenderSystem::shellFor(components::MicrobeType::Radiolarian, shell));
+    REQUIRE(shell.kind == components::ShellKind::Spines);
+    REQUIRE_FALSE(shell.replacesMembrane);
+
+    REQUIRE_FALSE(ShellRenderSystem::shellFor(components::MicrobeType::Amoeba, shell));
+    REQUIRE_FALSE(ShellRenderSystem::shellFor(components::MicrobeType::Bacillus, shell));
+}
+
+TEST_CASE("InstancedShells - colour rides in the bottom row", "[shell_render]") {
+    Matrix transform = MatrixMultiply(MatrixScale(2.0f, 2.0f, 2.0f), MatrixTranslate(1.0f, 2.0f, 3.0f));
+    Matrix packed = rendering::InstancedShells::packInstance(transform, {255, 0, 51, 255});
+
+    REQUIRE(packed.m3 == Approx(1.0f));
+    REQUIRE(packed.m7 == Approx(0.0f));
+    REQUIRE(packed.m11 == Approx(0.2f));
+
+    Matrix restored = unpack(packed);
+    Vector3 p = Vector3Transform({1.0f, 0.0f, 0.0f}, restored);
+    REQUIRE(p.x == Approx(3.0f));
+    REQUIRE(p.y == Approx(2.0f));
+    REQUIRE(p.z == Approx(3.0f));
+}
+
+TEST_CASE("ShellRenderSystem - instances follow the body transform", "[shell_render]") {
+    rendering::InstancedShells shells;
+    components::Transform transform;
+    transform.position = {4.0f, 0.5f, -2.0f};
+    transform.rotation = QuaternionFromAxisAngle({0.0f, 1.0f, 0.0f}, 0.5f * PI);
+
+    SECTION("Phage head and tail") {
+        auto microbe = makeMicrobe(components::MicrobeType::Bacteriophage, 0.1f);
+        components::ShellRender shell;
+        ShellRenderSystem::shellFor(microbe.type, shell);
+        REQUIRE(ShellRenderSystem::addInstances(shells, shell, microbe, transform) == 2);
+        REQUIRE(shells.queued(rendering::ShellPart::Icosahedron).size() == 1);
+        REQUIRE(shells.queued(rendering::ShellPart::Cylinder).size() == 1);
+
+        Matrix head = unpack(shells.queued(rendering::ShellPart::Icosahedron)[0]);
+        Vector3 centre = Vector3Transform({0.0f, 0.0f, 0.0f}, head);
+        REQUIRE(centre.x == Approx(4.0f));
+        REQUIRE(centre.z == Approx(-2.0f));
+
+        // Body -X turned a quarter about +Y ends up along +Z
+        Matrix tail = unpack(shells.queued(rendering::ShellPart::Cylinder)[0]);
+        Vector3 tip = Vector3Transform({0.0f, 1.0f, 0.0f}, tail);
+        REQUIRE(tip.x == Approx(4.0f).margin(1e-4f));
+        REQUIRE(tip.y == Approx(0.5f).margin(1e-4f));
+        REQUIRE(tip.z == Approx(-2.0f + 0.3f).margin(1e-4f));
+    }
+
+    SECTION("Spines start inside the membrane and radiate outwards") {
+        auto microbe = makeMicrobe(components::MicrobeType::Radiolarian, 0.3f);
+        components::ShellRender shell;
+        ShellRenderSystem::shellFor(microbe.type, shell);
+        int count = ShellRenderSystem::addInstances(shells, shell, microbe, transform);
+        REQUIRE(count >= 8);
+        REQUIRE((int)shells.queued(rendering::ShellPart::Cone).size() == count);
+
+        for (const Matrix& packed : shells.queued(rendering::ShellPart::Cone)) {
+            Matrix spine = unpack(packed);
+            float base = Vector3Distance(Vector3Transform({0.0f, 0.0f, 0.0f}, spine), transform.position);
+            float tip = Vector3Distance(Vector3Transform({0.0f, 1.0f, 0.0f}, spine), transform.position);
+            REQUIRE(base < 0.3f);
+            REQUIRE(tip > 0.3f * 2.0f);
+        }
+    }
+}
+
+TEST_CASE("World - shelled microbes get a ShellRender component", "[shell_render]") {
+    World world;
+    world.createScreenBoundaries(20.0f, 20.0f);
+    auto capsid = world.createMicrobe(components::MicrobeType::Icosahedral, {0.0f, 1.0f, 0.0f}, 0.1f, RED);
+    auto amoeba = world.createAmoeba({3.0f, 1.5f, 0.0f}, 0.3f, GREEN);
+
+    REQUIRE(capsid.has<components::ShellRender>());
+    REQUIRE(capsid.get<components::ShellRender>()->kind == components::ShellKind::Capsid);
+    REQUIRE_FALSE(amoeba.has<components::ShellRender>());
+
+    // Still sampled for hover tests and appendage anchors
+    world.update(1.0f / 60.0f);
+    REQUIRE(capsid.get<components::SDFRenderComponent>()->vertexCount > 0);
+}
@@ -0,0 +1,191 @@
+#include "src/math/BatchKernels.h"
+#include "src/math/Quat.h"
+#include "src/math/QuatA.h"
+#include "src/math/Vec3A.h"
+#include "src/math/Vec3x8.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+static bool approxEq(float a, float b, float eps = 1e-4f) {
+    return std::fabs(a - b) <= eps;
+}
+
+TEST_CASE("SIMD math - Vec3A matches scalar Vec3", "[simd]") {
+    math::Vec3 a(1.0f, -2.0f, 3.5f);
+    math::Vec3 b(-0.5f, 4.0f, 2.0f);
+    math::Vec3A va(a);
+    math::Vec3A vb(b);
+
+    REQUIRE(approxEq(va.dot(vb), a.dot(b)));
+
+    math::Vec3 c = a.cross(b);
+    math::Vec3A vc = va.cross(vb);
+    REQUIRE(approxEq(vc.x(), c.x));
+    REQUIRE(approxEq(vc.y(), c.y));
+    REQUIRE(approxEq(vc.z(), c.z));
+
+    Vector3 sum = (va + vb * 2.0f).to_vector3();
+    REQUIRE(approxEq(sum.x, a.x + b.x * 2.0f));
+    REQUIRE(approxEq(sum.y, a.y + b.y * 2.0f));
+    REQUIRE(approxEq(sum.z, a.z + b.z * 2.0f));
+    REQUIRE(approxEq(va.length(), a.length()));
+}
+
+TEST_CASE("SIMD math - QuatA rotation matches scalar Quat", "[simd]") {
+    math::Quat q = math::Quat::from_euler_angles(0.7f, -0.3f, 1.1f).normalized();
+    math::QuatA qa(q);
+    math::Vec3 p(0.25f, 1.5f, -2.0f);
+
+    math::Vec3 expected = q.rotate(p);
+    math::Vec3A actual = qa.rotate(math::Vec3A(p));
+    REQUIRE(approxEq(actual.x(), expected.x));
+    REQUIRE(approxEq(actual.y(), expected.y));
+    REQUIRE(approxEq(actual.z(), expected.z));
+
+    math::Quat composed = q * q.conjugate();
+    math::Quat composedA = (qa * qa.conjugate()).to_quat();
+    REQUIRE(approxEq(composedA.x, composed.x));
+    REQUIRE(approxEq(composedA.w, composed.w));
+}
+
+TEST_CASE("SIMD math - Vec3x8 partial loads and stores", "[simd]") {
+    std::vector<Vector3> points(5);
+    for (int i = 0; i < 5; i++) {
+        points[i] = {(float)i, (float)(i * 2), (float)(-i)};
+    }
+
+    math::Vec3x8 batch = math::Vec3x8::load(math::strided(points.data()), 0, 5);
+    // Padding lanes repeat the first element
+    REQUIRE(batch.x.lane(7) == 0.0f);
+    REQUIRE(batch.y.lane(4) == 8.0f);
+
+    std::vector<Vector3> out(6, Vector3{99.0f, 99.0f, 99.0f});
+    (batch * 2.0f).store(math::strided(out.data()), 0, 5);
+    REQUIRE(out[4].x == 8.0f);
+    REQUIRE(out[4].z == -8.0f);
+    REQUIRE(out[5].x == 99.0f);
+}
+
+TEST_CASE("SIMD math - batch transform matches per-point rotation", "[simd]") {
+    math::Quat q = math::Quat::from_axis_angle(math::Vec3(0.0f, 1.0f, 0.0f), 0.9f);
+    math::RigidTransformA xf{math::QuatA(q), math::Vec3A(1.0f, 2.0f, 3.0f)};
+
+    const size_t count = 19; // two full batches plus a tail
+    std::vector<Vector3> src(count);
+    for (size_t i = 0; i < count; i++) {
+        src[i] = {(float)i * 0.1f, 0.5f - (float)i, (float)(i % 3)};
+    }
+    std::vector<Vector3> out(count);
+    math::transform_points(xf, math::strided(src.data()), count, math::strided(out.data()));
+
+    for (size_t i = 0; i < count; i++) {
+        math::Vec3 expected = q.rotate(math::Vec3(src[i])) + math::Vec3(1.0f, 2.0f, 3.0f);
+        REQUIRE(approxEq(out[i].x, expected.x));
+        REQUIRE(approxEq(out[i].y, expected.y));
+        REQUIRE(approxEq(out[i].z, expected.z));
+    }
+
+    // Sampled transform picks the first and last points at the ends
+    std::vector<Vector3> sampled(4);
+    math::transform_points_sampled(xf, math::strided(src.data()), count, math::strided(sampled.data()), 4);
+    REQUIRE(approxEq(sampled[0].x, out[0].x));
+    REQUIRE(approxEq(sampled[3].z, out[count - 1].z));
+}
+
+TEST_CASE("SIMD math - bounds reduction over strided data", "[simd]") {
+    // 16-byte stride with a padding lane, like JPH::Vec3 arrays
+    struct Padded { float x, y, z, w; };
+    std::vector<Padded> pts;
+    for (int i = 0; i < 11; i++) {
+        pts.push_back({(float)(i - 5), (float)(i * i), (float)(10 - i), 1000.0f});
+    }
+
+    math::Vec3A lo, hi;
+    REQUIRE(math::compute_bounds(math::ConstStrided3(&pts[0].x, sizeof(Padded)), pts.size(), lo, hi));
+    REQUIRE(lo.x() == -5.0f);
+    REQUIRE(hi.x() == 5.0f);
+    REQUIRE(lo.y() == 0.0f);
+    REQUIRE(hi.y() == 100.0f);
+    REQUIRE(lo.z() == 0.0f);
+    REQUIRE(hi.z() == 10.0f);
+
+    REQUIRE_FALSE(math::compute_bounds(math::ConstStrided3(&pts[0].x, sizeof(Padded)), 0, lo, hi));
+}
+
+TEST_CASE("SIMD math - fused transform and bounds match separate passes", "[simd]") {
+    math::Quat q = math::Quat::from_axis_angle(math::Vec3(0.3f, 1.0f, -0.2f).normalized(), 1.3f);
+    math::RigidTransformA xf{math::QuatA(q), math::Vec3A(-2.0f, 0.5f, 4.0f)};
+
+    const size_t count = 21; // two full batches plus a tail of five
+    std::vector<Vector3> src(count);
+    for (size_t i = 0; i < count; i++) {
+        src[i] = {std::sin((float)i), (float)(i % 4) - 1.5f, 0.2f * (float)i - 2.0f};
+    }
+
+    for (float scale : {1.0f, 0.35f}) {
+        std::vector<Vector3> scaled(count), expected(count), fused(count);
+        for (size_t i = 0; i < count; i++) {
+            scaled[i] = {src[i].x * scale, src[i].y * scale, src[i].z * scale};
+        }
+        math::transform_points(xf, math::strided(scaled.data()), count, math::strided(expected.data()));
+
+        math::PointBounds bounds;
+        REQUIRE(math::transform_points_sampled_bounds(xf, math::strided(src.data()), count,
+                                                      math::strided(fused.data()), count, bounds, scale));
+
+        math::Vec3A lo, hi;
+        REQUIRE(math::compute_bounds(math::strided(expected.data()), count, lo, hi));
+        math::Vec3 sum(0.0f, 0.0f, 0.0f);
+        float maxRadius = 0.0f;
+        for (size_t i = 0; i < count; i++) {
+            REQUIRE(approxEq(fused[i].x, expected[i].x));
+            REQUIRE(approxEq(fused[i].y, expected[i].y));
+            REQUIRE(approxEq(fused[i].z, expected[i].z));
+            math::Vec3 p(expected[i]);
+            sum = sum + p;
+            maxRadius = std::fmax(maxRadius, (p - math::Vec3(-2.0f, 0.5f, 4.0f)).length());
+        }
+
+        REQUIRE(approxEq(bounds.min.x(), lo.x()));
+        REQUIRE(approxEq(bounds.min.z(), lo.z()));
+        REQUIRE(approxEq(bounds.max.y(), hi.y()));
+        // The tail's repeated lanes must not be counted in the centroid
+        REQUIRE(approxEq(bounds.centroid.x(), sum.x / (float)count));
+        REQUIRE(approxEq(bounds.centroid.y(), sum.y / (float)count));
+        REQUIRE(approxEq(bounds.centroid.z(), sum.z / (float)count));
+        REQUIRE(approxEq(bounds.maxRadius, maxRadius));
+    }
+
+    // Subsampled output reduces only the points it writes
+    std::vector<Vector3> sampled(5);
+    math::PointBounds bounds;
+    REQUIRE(math::transform_points_sampled_bounds(xf, math::strided(src.data()), count,
+                                                  math::strided(sampled.data()), 5, bounds));
+    math::Vec3A lo, hi;
+    REQUIRE(math::compute_bounds(math::strided(sampled.data()), 5, lo, hi));
+    REQUIRE(approxEq(bounds.min.y(), lo.y()));
+    REQUIRE(approxEq(bounds.max.x(), hi.x()));
+
+    REQUIRE_FALSE(math::transform_points_sampled_bounds(xf, math::strided(src.data()), count,
+                                                        math::strided(sampled.data()), 0, bounds));
+}
+
+TEST_CASE("SIMD math - weighted force application", "[simd]") {
+    struct Padded { float x, y, z, w; };
+    std::vector<Padded> vel(10, Padded{0.0f, 0.0f, 0.0f, 0.0f});
+    std::vector<float> weights(10);
+    for (int i = 0; i < 10; i++) {
+        weights[i] = (float)i;
+    }
+
+    math::Strided3 dst(&vel[0].x, sizeof(Padded), true);
+    math::apply_scaled(dst, vel.size(), math::Vec3A(1.0f, 0.0f, -2.0f), weights.data());
+    REQUIRE(vel[9].x == 9.0f);
+    REQUIRE(vel[9].z == -18.0f);
+    REQUIRE(vel[9].w == -18.0f); // mirrored like JPH::Vec3
+
+    math::apply_scaled(dst, vel.size(), math::Vec3A(0.0f, 1.0f, 0.0f), nullptr);
+    REQUIRE(vel[0].y == 1.0f);
+    REQUIRE(vel[9].y == 1.0f);
+}
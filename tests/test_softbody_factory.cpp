@@ -3,6 +3,7 @@
 #include <cmath>
 #include "src/systems/SoftBodyFactory.h"
 #include "src/systems/PhysicsSystem.h"
+#include "tests/test_fixtures.h"
 #include "raylib.h"
 #include <Jolt/Physics/Body/BodyInterface.h>
 #include <Jolt/Physics/SoftBody/SoftBodyMotionProperties.h>
@@ -32,9 +33,7 @@ static void cleanupBodies(PhysicsSystemState* physics, JPH::BodyID bodyID, std::
     }
 }
 
-TEST_CASE("SoftBodyFactory - Create amoeba soft body", "[softbody_factory]") {
-    PhysicsSystemState* physics = new PhysicsSystemState();
-
+TEST_CASE_METHOD(PhysicsFixture, "SoftBodyFactory - Create amoeba soft body", "[softbody_factory]") {
     Vector3 position = {0.0f, 5.0f, 0.0f};
     float radius = 2.0f;
     int subdivisions = 1; // 42 vertices
@@ -49,12 +48,9 @@ TEST_CASE("SoftBodyFactory - Create amoeba soft body", "[softbody_factory]") {
     REQUIRE(bodyInterface.IsAdded(bodyID));
 
     cleanupBodies(physics, bodyID, skeletonBodyIDs);
-    delete physics;
 }
 
-TEST_CASE("SoftBodyFactory - Verify vertex count", "[softbody_factory]") {
-    PhysicsSystemState* physics = new PhysicsSystemState();
-
+TEST_CASE_METHOD(PhysicsFixture, "SoftBodyFactory - Verify vertex count", "[softbody_factory]") {
     Vector3 position = {0.0f, 5.0f, 0.0f};
     float radius = 1.5f;
 
@@ -76,12 +72,9 @@ TEST_CASE("SoftBodyFactory - Verify vertex count", "[softbody_factory]") {
     cleanupBodies(physics, bodyID0, skeleton0);
     cleanupBodies(physics, bodyID1, skeleton1);
     cleanupBodies(physics, bodyID2, skeleton2);
-    delete physics;
 }
 
-TEST_CASE("SoftBodyFactory - Extract vertex positions", "[softbody_factory]") {
-    PhysicsSystemState* physics = new PhysicsSystemState();
-
+TEST_CASE_METHOD(PhysicsFixture, "SoftBodyFactory - Extract vertex positions", "[softbody_factory]") {
     Vector3 position = {0.0f, 5.0f, 0.0f};
     float radius = 2.0f;
     int subdivisions = 1; // 42 vertices
@@ -114,12 +107,9 @@ TEST_CASE("SoftBodyFactory - Extract vertex positions", "[softbody_factory]") {
     REQUIRE(maxDistance <= radius * 1.5f);
 
     cleanupBodies(physics, bodyID, skeletonBodyIDs);
-    delete physics;
 }
 
-TEST_CASE("SoftBodyFactory - Soft body properties", "[softbody_factory]") {
-    PhysicsSystemState* physics = new PhysicsSystemState();
-
+TEST_CASE_METHOD(PhysicsFixture, "SoftBodyFactory - Soft body properties", "[softbody_factory]") {
     Vector3 position = {0.0f, 5.0f, 0.0f};
     float radius = 2.0f;
 
@@ -151,12 +141,9 @@ TEST_CASE("SoftBodyFactory - Soft body properties", "[softbody_factory]") {
     } // Lock released here
 
     cleanupBodies(physics, bodyID, skeletonBodyIDs);
-    delete physics;
 }
 
-TEST_CASE("SoftBodyFactory - Invalid body ID handling", "[softbody_factory]") {
-    PhysicsSystemState* physics = new PhysicsSystemState();
-
+TEST_CASE_METHOD(PhysicsFixture, "SoftBodyFactory - Invalid body ID handling", "[softbody_factory]") {
     JPH::BodyID invalidID;
 
     // Should return 0 for invalid body
@@ -165,13 +152,9 @@ TEST_CASE("SoftBodyFactory - Invalid body ID handling", "[softbody_factory]") {
     // Should return 0 for extraction
     Vector3 positions[256];
     REQUIRE(SoftBodyFactory::ExtractVertexPositions(physics, invalidID, positions, 256) == 0);
-
-    delete physics;
 }
 
-TEST_CASE("SoftBodyFactory - Simulation step", "[softbody_factory]") {
-    PhysicsSystemState* physics = new PhysicsSystemState();
-
+TEST_CASE_METHOD(PhysicsFixture, "SoftBodyFactory - Simulation step", "[softbody_factory]") {
     Vector3 position = {0.0f, 10.0f, 0.0f}; // Start high up
     float radius = 1.5f;
 
@@ -197,5 +180,4 @@ TEST_CASE("SoftBodyFactory - Simulation step", "[softbody_factory]") {
     REQUIRE(finalPos.GetY() < initialPos.GetY() - 0.01f);
 
     cleanupBodies(physics, bodyID, skeletonBodyIDs);
-    delete physics;
 }
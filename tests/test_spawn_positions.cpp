@@ -63,3 +63,28 @@ TEST_CASE("SpawnSystem - Microbes spawn at different positions", "[spawn_positio
 
     CloseWindow();
 }
+
+TEST_CASE("SpawnSystem - Same seed spawns identical microbes", "[spawn_positions]") {
+    auto collectSpawns = [](uint64_t seed) {
+        micro_idle::World world(seed);
+        float dt = 1.0f / 60.0f;
+        for (int i = 0; i < 150; i++) {
+            world.update(dt);
+        }
+
+        std::vector<float> values;
+        world.getWorld().each([&](flecs::entity e, const components::Microbe& microbe) {
+            values.push_back(microbe.stats.seed);
+            values.push_back(microbe.stats.baseRadius);
+        });
+        return values;
+    };
+
+    std::vector<float> first = collectSpawns(1234u);
+    std::vector<float> second = collectSpawns(1234u);
+    std::vector<float> other = collectSpawns(4321u);
+
+    REQUIRE(first.size() > 0);
+    REQUIRE(first == second);
+    REQUIRE(first != other);
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "src/components/Damage.h"
+#include "src/components/Microbe.h"
+#include "src/components/StatusEffects.h"
+#include "src/systems/StatusEffectSystem.h"
+#include "tests/test_fixtures.h"
+#include <algorithm>
+
+using namespace micro_idle;
+using Catch::Approx;
+using components::EffectType;
+
+TEST_CASE("StatusEffectSystem - damage over time is summed per entity and stops at expiry", "[status_effects]") {
+    components::StatusEffects effects;
+    components::DamageBuffer buffer;
+
+    // Two sources on each of 20 entities (more than one lane block), applied out of order
+    for (flecs::entity_t e = 20; e >= 1; e--) {
+        effects.apply(e, EffectType::DamageOverTime, 1.0f, 10.0f, 1);
+        effects.apply(e, EffectType::DamageOverTime, 0.5f, 4.0f, 2);
+    }
+    REQUIRE(StatusEffectSystem::tick(effects, 0.25f, buffer) == 0);
+    REQUIRE(buffer.size() == 20);
+    REQUIRE(buffer.entities[0] == 1);
+    REQUIRE(buffer.amounts[0] == Approx(3.5f));
+    REQUIRE(buffer.sources[0] == (uint8_t)components::DamageSource::Effect);
+
+    // Source 2 has 0.25 s left, source 1 0.75 s: only the time still running deals damage
+    buffer.clear();
+    REQUIRE(StatusEffectSystem::tick(effects, 0.25f, buffer) == 20);
+    REQUIRE(effects.expired.size() == 20);
+    REQUIRE(effects.expired[0].tag == 2);
+    buffer.clear();
+    REQUIRE(StatusEffectSystem::tick(effects, 1.0f, buffer) == 20);
+    REQUIRE(buffer.amounts[0] == Approx(5.0f));
+    REQUIRE(effects.bucket(EffectType::DamageOverTime).size() == 0);
+}
+
+TEST_CASE("StatusEffectSystem - re-applying refreshes, armor blocks damage over time", "[status_effects]") {
+    components::StatusEffects effects;
+    components::DamageBuffer buffer;
+    effects.apply(5, EffectType::DamageOverTime, 1.0f, 10.0f, 1);
+    effects.apply(5, EffectType::DamageOverTime, 3.0f, 2.0f, 1);   // Same source: longer, not stronger
+    effects.apply(5, EffectType::Armor, 2.0f, 0.5f, 1);
+    effects.apply(5, EffectType::Armor, 2.0f, 0.25f, 2);
+    effects.apply(5, EffectType::Slow, 1.0f, 0.3f);
+
+    StatusEffectSystem::tick(effects, 0.5f, buffer);
+    REQUIRE(effects.bucket(EffectType::DamageOverTime).size() == 1);
+    REQUIRE(StatusEffectSystem::remaining(effects, 5, EffectType::DamageOverTime, 1) == Approx(2.5f));
+    REQUIRE(buffer.amounts[0] == Approx(10.0f * 0.5f * 0.5f));      // Strongest armor only
+    REQUIRE(StatusEffectSystem::strongest(effects, 5, EffectType::Armor) == Approx(0.5f));
+    REQUIRE(StatusEffectSystem::strongest(effects, 5, EffectType::Slow) == Approx(0.3f));
+    REQUIRE(StatusEffectSystem::has(effects, 5, EffectType::Slow));
+    REQUIRE_FALSE(StatusEffectSystem::has(effects, 6, EffectType::Slow));
+    REQUIRE_FALSE(StatusEffectSystem::has(effects, 5, EffectType::Stun));
+}
+
+TEST_CASE("StatusEffectSystem - cooldowns expire into ready abilities", "[status_effects]") {
+    components::StatusEffects effects;
+    components::DamageBuffer buffer;
+    constexpr uint32_t Pulse = 3;
+    REQUIRE(StatusEffectSystem::isReady(effects, 0, Pulse));
+
+    effects.apply(0, EffectType::Cooldown, 0.3f, 0.0f, Pulse);
+    StatusEffectSystem::tick(effects, 0.2f, buffer);
+    REQUIRE_FALSE(StatusEffectSystem::isReady(effects, 0, Pulse));
+    REQUIRE(StatusEffectSystem::isReady(effects, 0, Pulse + 1));
+    StatusEffectSystem::tick(effects, 0.2f, buffer);
+    REQUIRE(StatusEffectSystem::isReady(effects, 0, Pulse));
+    REQUIRE(effects.expired.size() == 1);
+    REQUIRE(effects.expired[0].type == EffectType::Cooldown);
+    REQUIRE(buffer.size() == 0);
+}
+
+TEST_CASE("StatusEffectSystem - effects on dead entities are dropped, not expired", "[status_effects]") {
+    components::StatusEffects effects;
+    components::DamageBuffer buffer;
+    for (flecs::entity_t e = 1; e <= 12; e++) {
+        effects.apply(e, EffectType::DamageOverTime, 1.0f, 10.0f);
+        effects.apply(e, EffectType::Slow, 1.0f, 0.5f);
+    }
+    StatusEffectSystem::tick(effects, 0.1f, buffer);
+    effects.apply(4, EffectType::Stun, 1.0f, 0.0f);
+
+    StatusEffectSystem::removeEntities(effects, {2, 4, 11});
+    REQUIRE(effects.bucket(EffectType::DamageOverTime).size() == 9);
+    REQUIRE(effects.bucket(EffectType::Slow).size() == 9);
+    REQUIRE_FALSE(StatusEffectSystem::has(effects, 4, EffectType::Slow));
+    REQUIRE(StatusEffectSystem::has(effects, 5, EffectType::Slow));
+
+    buffer.clear();
+    StatusEffectSystem::tick(effects, 0.1f, buffer);
+    REQUIRE(buffer.size() == 9);
+    REQUIRE(std::find(buffer.entities.begin(), buffer.entities.end(), 4) == buffer.entities.end());
+    REQUIRE_FALSE(StatusEffectSystem::has(effects, 4, EffectType::Stun));     // Pending request dropped too
+    REQUIRE(effects.expired.empty());
+}
+
+TEST_CASE_METHOD(DishFixture, "World - a toxin kills microbes through the damage buffer", "[status_effects]") {
+    populate(components::MicrobeType::Coccus, 10);
+    int before = microbes();
+    auto effects = ecs.get_mut<components::StatusEffects>();
+    ecs.each([&](flecs::entity e, const components::Microbe&) {
+        effects->apply(e.id(), EffectType::DamageOverTime, 2.0f, 1000.0f);
+    });
+    step(60);
+    REQUIRE(microbes() < before);
+    REQUIRE(ecs.get<components::DamageBuffer>()->size() == 0);
+
+    // The dead took their effects with them
+    const components::EffectBucket& dot = ecs.get<components::StatusEffects>()->bucket(EffectType::DamageOverTime);
+    REQUIRE(dot.size() == microbes());
+    for (int i = 0; i < dot.size(); i++) {
+        REQUIRE(ecs.is_alive(dot.entities[(size_t)i]));
+    }
+}
@@ -0,0 +1,234 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "src/components/Damage.h"
+#include "src/components/Killers.h"
+#include "src/components/Microbe.h"
+#include "src/components/MicrobeIndex.h"
+#include "src/components/Upgrades.h"
+#include "src/physics/PhysicsRuntime.h"
+#include "src/physics/TargetIndex.h"
+#include "src/systems/KillerSystem.h"
+#include "tests/test_fixtures.h"
+#include "engine/util/rng.h"
+#include <Jolt/Core/JobSystemThreadPool.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+using namespace micro_idle;
+
+namespace {
+
+struct Points {
+    std::vector<float> x, z, score;
+};
+
+Points scatter(uint64_t seed, int count, float halfW, float halfH) {
+    Rng rng;
+    rng_seed(&rng, seed);
+    Points p;
+    for (int i = 0; i < count; i++) {
+        p.x.push_back(rng_range(&rng, -halfW, halfW));
+        p.z.push_back(rng_range(&rng, -halfH, halfH));
+        p.score.push_back((float)rng_range_i(&rng, 0, 4));
+    }
+    return p;
+}
+
+// Every point by (distance, slot), optionally only those within `radius`
+std::vector<int> bruteNearest(const Points& p, float x, float z, float radius) {
+    std::vector<std::pair<float, int>> all;
+    for (int i = 0; i < (int)p.x.size(); i++) {
+        float dx = p.x[(size_t)i] - x;
+        float dz = p.z[(size_t)i] - z;
+        float d2 = dx * dx + dz * dz;
+        if (radius <= 0.0f || d2 <= radius * radius) {
+            all.push_back({d2, i});
+        }
+    }
+    std::sort(all.begin(), all.end());
+    std::vector<int> slots;
+    for (auto& entry : all) {
+        slots.push_back(entry.second);
+    }
+    return slots;
+}
+
+} // namespace
+
+TEST_CASE("TargetIndex - k-nearest matches a full scan", "[target_index]") {
+    Points p = scatter(11, 300, 8.0f, 4.0f);
+    TargetIndex index;
+    index.build(p.x.data(), p.z.data(), p.score.data(), (int)p.x.size(), 0.5f, nullptr);
+    REQUIRE(index.size() == 300);
+
+    Rng rng;
+    rng_seed(&rng, 12);
+    for (int q = 0; q < 200; q++) {
+        // Some queries from well outside the targets' bounds
+        float x = rng_range(&rng, -12.0f, 12.0f);
+        float z = rng_range(&rng, -8.0f, 8.0f);
+        int k = 1 + q % TargetIndex::MaxK;
+        float radius = q % 3 == 0 ? 1.5f : 0.0f;
+
+        std::vector<int> expected = bruteNearest(p, x, z, radius);
+        int slots[TargetIndex::MaxK];
+        int found = index.nearest(x, z, k, radius, slots, nullptr);
+        REQUIRE(found == std::min(k, (int)expected.size()));
+        for (int j = 0; j < found; j++) {
+            REQUIRE(slots[j] == expected[(size_t)j]);
+        }
+    }
+
+    TargetIndex empty;
+    int slot;
+    REQUIRE(empty.nearest(0.0f, 0.0f, 4, 0.0f, &slot, nullptr) == 0);
+    REQUIRE(empty.bestInRadius(0.0f, 0.0f, 10.0f) == -1);
+}
+
+TEST_CASE("TargetIndex - best score within a radius, nearer first on ties", "[target_index]") {
+    float xs[] = {0.5f, -0.5f, 0.2f, 3.0f};
+    float zs[] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float scores[] = {2.0f, 5.0f, 5.0f, 9.0f};
+    TargetIndex index;
+    index.build(xs, zs, scores, 4, 0.4f, nullptr);
+
+    REQUIRE(index.bestInRadius(0.0f, 0.0f, 1.0f) == 2);     // 1 and 2 tie on score; 2 is nearer
+    REQUIRE(index.bestInRadius(0.0f, 0.0f, 3.0f) == 3);     // Reaches the far, high-scoring one
+    REQUIRE(index.bestInRadius(0.45f, 0.0f, 0.1f) == 0);
+    REQUIRE(index.bestInRadius(0.0f, 5.0f, 1.0f) == -1);
+}
+
+TEST_CASE("TargetIndex - assignment never hands a target to two agents", "[target_index]") {
+    Points targets = scatter(21, 120, 6.0f, 6.0f);
+    Points agents = scatter(22, 200, 6.0f, 6.0f);
+    TargetIndex index;
+    index.build(targets.x.data(), targets.z.data(), nullptr, 120, 0.5f, nullptr);
+
+    std::vector<int> assigned(200);
+    int count = index.assignTargets(agents.x.data(), agents.z.data(), 200, 4, 0.0f, 1, assigned.data(), nullptr);
+    std::vector<int> claims(120, 0);
+    int withTarget = 0;
+    for (int slot : assigned) {
+        if (slot >= 0) {
+            claims[(size_t)slot]++;
+            withTarget++;
+        }
+    }
+    REQUIRE(count == withTarget);
+    REQUIRE(count <= 120);
+    REQUIRE(*std::max_element(claims.begin(), claims.end()) == 1);
+
+    // The agent closest to any target gets its nearest one
+    int closest = 0;
+    float closestD2 = 1e30f;
+    for (int a = 0; a < 200; a++) {
+        int slot;
+        float d2;
+        index.nearest(agents.x[(size_t)a], agents.z[(size_t)a], 1, 0.0f, &slot, &d2);
+        if (d2 < closestD2) {
+            closestD2 = d2;
+            closest = a;
+        }
+    }
+    std::vector<int> nearestSlot = bruteNearest(targets, agents.x[(size_t)closest], agents.z[(size_t)closest], 0.0f);
+    REQUIRE(assigned[(size_t)closest] == nearestSlot[0]);
+
+    // Two claims per target, and the same answer on the worker threads
+    std::vector<int> threaded(200);
+    index.build(targets.x.data(), targets.z.data(), nullptr, 120, 0.5f, PhysicsRuntime::jobSystem());
+    int shared = index.assignTargets(agents.x.data(), agents.z.data(), 200, 4, 0.0f, 2, threaded.data(),
+                                     PhysicsRuntime::jobSystem());
+    REQUIRE(shared > count);
+    std::vector<int> inlineRun(200);
+    index.assignTargets(agents.x.data(), agents.z.data(), 200, 4, 0.0f, 2, inlineRun.data(), nullptr);
+    REQUIRE(threaded == inlineRun);
+}
+
+TEST_CASE_METHOD(DishFixture, "World - killer agents hunt down microbes", "[target_index]") {
+    populate(components::MicrobeType::Coccus, 30);
+    ecs.get_mut<components::PlayerUpgrades>()->killers = 2;
+    step();
+    const auto* agents = ecs.get<components::KillerAgents>();
+    REQUIRE(agents->size() == 2 * KillerSystem::AgentsPerLevel);
+
+    // No two agents chase the same microbe
+    std::vector<flecs::entity_t> chased;
+    for (flecs::entity_t target : agents->target) {
+        if (target != 0) {
+            chased.push_back(target);
+        }
+    }
+    REQUIRE_FALSE(chased.empty());
+    std::sort(chased.begin(), chased.end());
+    REQUIRE(std::unique(chased.begin(), chased.end()) == chased.end());
+
+    int before = microbes();
+    step(600);
+    REQUIRE(microbes() < before);
+    REQUIRE(ecs.get<components::DamageBuffer>()->size() == 0);
+
+    // Selling the upgrade removes them
+    ecs.get_mut<components::PlayerUpgrades>()->killers = 0;
+    step();
+    REQUIRE(ecs.get<components::KillerAgents>()->size() == 0);
+}
+
+// Hidden: run with `tests "[.benchmark]"`
+TEST_CASE("TargetIndex - retargeting hundreds of agents beats a full scan", "[target_index][.benchmark]") {
+    constexpr int Targets = 5000;
+    constexpr int Agents = 500;
+    Points targets = scatter(31, Targets, 25.0f, 25.0f);
+    Points agents = scatter(32, Agents, 25.0f, 25.0f);
+    TargetIndex index;
+    std::vector<int> assigned(Agents);
+
+    auto indexed = [&]() {
+        index.build(targets.x.data(), targets.z.data(), nullptr, Targets, 0.7f, PhysicsRuntime::jobSystem());
+        return index.assignTargets(agents.x.data(), agents.z.data(), Agents, 4, 0.0f, 1, assigned.data(),
+                                   PhysicsRuntime::jobSystem());
+    };
+    // Nearest target only, without claims: less work than the index does
+    auto fullScan = [&]() {
+        int total = 0;
+        for (int a = 0; a < Agents; a++) {
+            float best = 1e30f;
+            int bestSlot = -1;
+            for (int t = 0; t < Targets; t++) {
+                float dx = targets.x[(size_t)t] - agents.x[(size_t)a];
+                float dz = targets.z[(size_t)t] - agents.z[(size_t)a];
+                float d2 = dx * dx + dz * dz;
+                if (d2 < best) {
+                    best = d2;
+                    bestSlot = t;
+                }
+            }
+            total += bestSlot;
+        }
+        return total;
+    };
+    auto msPerTick = [](auto&& tick) {
+        constexpr int Ticks = 50;
+        volatile int sink = tick();                 // Warm; the sink keeps the scan from being elided
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < Ticks; i++) {
+            sink = tick();
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / Ticks;
+    };
+
+    double indexMs = msPerTick(indexed);
+    double scanMs = msPerTick(fullScan);
+    printf("Target index: %d agents over %d targets, %.3f ms per tick (full scan %.3f ms)\n", Agents, Targets,
+           indexMs, scanMs);
+    REQUIRE(indexMs < scanMs);
+
+    BENCHMARK("Build + assign, worker threads") {
+        return indexed();
+    };
+    BENCHMARK("Full scan per agent") {
+        return fullScan();
+    };
+}
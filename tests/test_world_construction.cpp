@@ -0,0 +1,65 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "src/World.h"
+#include "src/physics/PhysicsRuntime.h"
+#include "src/systems/PhysicsSystem.h"
+#include "tests/test_fixtures.h"
+#include <chrono>
+#include <cstdio>
+
+using namespace micro_idle;
+
+TEST_CASE("PhysicsSystemState - scratch allocator is taken on the first step and recycled", "[world_construction]") {
+    constexpr size_t Bytes = 3 * 1024 * 1024;     // Unique to this test, so the pool holds none yet
+    JPH::TempAllocatorImpl* first = nullptr;
+    {
+        PhysicsSystemState physics(Bytes);
+        REQUIRE(physics.tempAllocator == nullptr);
+        physics.update(1.0f / 60.0f);
+        REQUIRE(physics.tempAllocator != nullptr);
+        first = physics.tempAllocator;
+    }
+
+    // The next world of the same size reuses the released block
+    PhysicsSystemState physics(Bytes);
+    physics.update(1.0f / 60.0f);
+    REQUIRE(physics.tempAllocator == first);
+
+    // Different sizes never share
+    JPH::TempAllocatorImpl* other = PhysicsRuntime::acquireTempAllocator(Bytes + 4096);
+    REQUIRE(other != first);
+    PhysicsRuntime::releaseTempAllocator(other, Bytes + 4096);
+}
+
+TEST_CASE_METHOD(EcsFixture, "EcsFixture - bare world with physics", "[world_construction]") {
+    auto e = world.entity().set<components::Transform>({});
+    REQUIRE(e.has<components::Transform>());
+    REQUIRE(physics->physicsSystem != nullptr);
+    physics->update(1.0f / 60.0f);
+}
+
+// Hidden: run with `tests "[.benchmark]"`
+TEST_CASE("World - construction after first init", "[world_construction][.benchmark]") {
+    // A WorldGroup adds dishes and tests build worlds freely, so a warm World
+    // has to stay well under a millisecond
+    constexpr double BudgetMs = 1.0;
+
+    // First World pays for Jolt type registration and the worker pool
+    {
+        World warm;
+    }
+
+    constexpr int Worlds = 50;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < Worlds; i++) {
+        World world((uint64_t)i);
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / Worlds;
+    printf("World construction + destruction: %.3f ms each (budget %.1f ms)\n", ms, BudgetMs);
+    REQUIRE(ms < BudgetMs);
+
+    BENCHMARK("World construction + destruction") {
+        World world;
+        return world.getWorld().count<components::Microbe>();
+    };
+}
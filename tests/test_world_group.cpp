@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+#include "src/World.h"
+#include "src/WorldGroup.h"
+#include "src/components/Input.h"
+#include "src/components/Microbe.h"
+#include "src/components/Transform.h"
+#include "src/components/WorldState.h"
+#include "src/physics/ParallelFor.h"
+#include "src/physics/PhysicsRuntime.h"
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace micro_idle;
+
+namespace {
+
+void setupDish(World& world) {
+    world.getWorld().get_mut<components::WorldState>()->spawnEnabled = false;
+    world.createScreenBoundaries(10.8f, 3.8f);
+    world.createStarterMicrobes(10.8f, 3.8f);
+    world.spawnPopulation(components::MicrobeType::Amoeba, 3);
+}
+
+std::vector<Vector3> microbePositions(World& world) {
+    std::vector<Vector3> positions;
+    world.getWorld().each([&](components::Microbe&, components::Transform& transform) {
+        positions.push_back(transform.position);
+    });
+    return positions;
+}
+
+bool samePositions(const std::vector<Vector3>& a, const std::vector<Vector3>& b) {
+    return a.size() == b.size() &&
+           (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(Vector3)) == 0);
+}
+
+} // namespace
+
+TEST_CASE("WorldGroup - worlds coexist and outlive each other", "[world_group]") {
+    auto first = std::make_unique<World>(1);
+    auto second = std::make_unique<World>(2);
+    setupDish(*first);
+    setupDish(*second);
+    first->update(1.0f / 60.0f);
+    second->update(1.0f / 60.0f);
+
+    // Destroying one world must leave the shared Jolt state usable for the other
+    first.reset();
+    for (int i = 0; i < 30; i++) {
+        second->update(1.0f / 60.0f);
+    }
+    REQUIRE(second->getWorld().count<components::Microbe>() == 5);
+
+    World third(3);
+    setupDish(third);
+    third.update(1.0f / 60.0f);
+    REQUIRE(third.getWorld().count<components::Microbe>() == 5);
+}
+
+TEST_CASE("WorldGroup - concurrent stepping matches stepping alone", "[world_group]") {
+    const uint64_t seeds[] = {11, 22, 33};
+
+    WorldGroup group(2);
+    for (uint64_t seed : seeds) {
+        setupDish(group.getWorld(group.addWorld(seed)));
+    }
+    group.stepTicks(45);
+
+    for (int i = 0; i < 3; i++) {
+        World alone(seeds[i]);
+        setupDish(alone);
+        for (int t = 0; t < 45; t++) {
+            alone.update(1.0f / 60.0f);
+        }
+        REQUIRE(group.getTime(i).tick == 45);
+        REQUIRE(samePositions(microbePositions(group.getWorld(i)), microbePositions(alone)));
+    }
+}
+
+TEST_CASE("WorldGroup - each world keeps its own tick clock", "[world_group]") {
+    WorldGroup group(1);
+    int fast = group.addWorld(5, 60);
+    int slow = group.addWorld(6, 20);
+
+    int most = group.update(0.105);
+    REQUIRE(most == 6);
+    REQUIRE(group.getTime(fast).tick == 6);
+    REQUIRE(group.getTime(slow).tick == 2);
+
+    group.setTickHz(slow, 60);
+    group.update(0.05);
+    REQUIRE(group.getTime(fast).tick == 9);
+    REQUIRE(group.getTime(slow).tick == 5);
+
+    // Only the focused world takes live input
+    group.setFocused(fast);
+    REQUIRE_FALSE(group.getWorld(fast).getWorld().get<components::InputState>()->injected);
+    REQUIRE(group.getWorld(slow).getWorld().get<components::InputState>()->injected);
+}
+
+TEST_CASE("WorldGroup - the most worlds allowed step at once on the shared job pool", "[world_group]") {
+    // Running out of jobs or barriers would assert inside Jolt or stall here
+    constexpr int Worlds = PhysicsRuntime::MaxConcurrentWorlds;
+    WorldGroup group(Worlds + 8);       // Clamped to Worlds - 1 helpers
+    for (int i = 0; i < Worlds; i++) {
+        setupDish(group.getWorld(group.addWorld(100 + (uint64_t)i)));
+    }
+    group.stepTicks(20);
+    for (int i = 0; i < Worlds; i++) {
+        REQUIRE(group.getTime(i).tick == 20);
+        REQUIRE(group.getWorld(i).getWorld().count<components::Microbe>() == 5);
+    }
+
+    // parallelFor at full batch width from as many threads at once
+    std::vector<long long> sums((size_t)Worlds, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < Worlds; t++) {
+        threads.emplace_back([&sums, t]() {
+            std::vector<int> hits(ParallelForMaxJobs * 8, 0);
+            for (int round = 0; round < 10; round++) {
+                parallelFor(PhysicsRuntime::jobSystem(), (int)hits.size(), [&](int i) { hits[(size_t)i]++; });
+            }
+            for (int h : hits) {
+                sums[(size_t)t] += h;
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (long long sum : sums) {
+        REQUIRE(sum == 10LL * ParallelForMaxJobs * 8);
+    }
+}